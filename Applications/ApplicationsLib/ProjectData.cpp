@@ -14,6 +14,7 @@
 #include "ProjectData.h"
 
 #include <algorithm>
+#include <exception>
 #include <set>
 
 #include <logog/include/logog.hpp>
@@ -25,6 +26,7 @@
 #include "BaseLib/Algorithm.h"
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/RunTime.h"
 
 #include "GeoLib/GEOObjects.h"
 #include "MaterialLib/MPL/CreateMedium.h"
@@ -125,38 +127,105 @@ void readGeometry(std::string const& fname, GeoLib::GEOObjects& geo_objects)
     gml_reader.readFile(fname);
 }
 
-std::unique_ptr<MeshLib::Mesh> readSingleMesh(
-    BaseLib::ConfigTree const& mesh_config_parameter,
-    std::string const& project_directory)
+/// The input of a single mesh given in the project file.
+struct MeshInput
 {
-    std::string const mesh_file = BaseLib::copyPathToFileName(
-        mesh_config_parameter.getValue<std::string>(), project_directory);
-    DBUG("Reading mesh file '%s'.", mesh_file.c_str());
+    std::string file_name;
+    boost::optional<bool> axially_symmetric;
+};
 
-    auto mesh = std::unique_ptr<MeshLib::Mesh>(
-        MeshLib::IO::readMeshFromFile(mesh_file));
-    if (!mesh)
-    {
-        OGS_FATAL("Could not read mesh from '%s' file. No mesh added.",
-                  mesh_file.c_str());
-    }
+MeshInput parseMeshInput(BaseLib::ConfigTree const& mesh_config_parameter,
+                         std::string const& project_directory)
+{
+    MeshInput input;
+    input.file_name = BaseLib::copyPathToFileName(
+        mesh_config_parameter.getValue<std::string>(), project_directory);
 
 #ifdef DOXYGEN_DOCU_ONLY
     //! \ogs_file_attr{prj__meshes__mesh__axially_symmetric}
     mesh_config_parameter.getConfigAttributeOptional<bool>("axially_symmetric");
 #endif  // DOXYGEN_DOCU_ONLY
 
-    if (auto const axially_symmetric =
-            //! \ogs_file_attr{prj__mesh__axially_symmetric}
+    input.axially_symmetric =
+        //! \ogs_file_attr{prj__mesh__axially_symmetric}
         mesh_config_parameter.getConfigAttributeOptional<bool>(
-            "axially_symmetric"))
+            "axially_symmetric");
+
+    return input;
+}
+
+std::unique_ptr<MeshLib::Mesh> readSingleMesh(MeshInput const& input)
+{
+    BaseLib::RunTime time_read;
+    time_read.start();
+    DBUG("Reading mesh file '%s'.", input.file_name.c_str());
+
+    auto mesh = std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::IO::readMeshFromFile(input.file_name));
+    if (!mesh)
     {
-        mesh->setAxiallySymmetric(*axially_symmetric);
+        OGS_FATAL("Could not read mesh from '%s' file. No mesh added.",
+                  input.file_name.c_str());
     }
 
+    if (input.axially_symmetric)
+    {
+        mesh->setAxiallySymmetric(*input.axially_symmetric);
+    }
+
+    INFO("[time] Reading mesh '%s' took %g s.", input.file_name.c_str(),
+         time_read.elapsed());
     return mesh;
 }
 
+/// Reads the bulk mesh, which is the first and usually by far the largest
+/// one, on its own, such that its conversion uses all threads. The remaining
+/// meshes, e.g. the boundary meshes, are independent of each other and are
+/// read concurrently.
+std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshesInParallel(
+    std::vector<MeshInput> const& inputs)
+{
+    auto const n = static_cast<std::ptrdiff_t>(inputs.size());
+    std::vector<std::unique_ptr<MeshLib::Mesh>> meshes(inputs.size());
+    if (n == 0)
+    {
+        return meshes;
+    }
+    meshes[0] = readSingleMesh(inputs[0]);
+
+    std::exception_ptr exception;
+    // With PETSc each mesh is read collectively by all processes, which
+    // requires the same order of the reads on all of them.
+#ifndef USE_PETSC
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::ptrdiff_t i = 1; i < n; i++)
+    {
+        try
+        {
+            meshes[i] = readSingleMesh(inputs[i]);
+        }
+        catch (...)
+        {
+#pragma omp critical(ogs_read_meshes_exception)
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    // The ids of the concurrently constructed meshes depend on the order of
+    // the threads; they are reassigned in the order of the input.
+    MeshLib::sortMeshIDs(meshes);
+    return meshes;
+}
+
 std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
     BaseLib::ConfigTree const& config, std::string const& project_directory)
 {
@@ -167,12 +236,16 @@ std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
     if (optional_meshes)
     {
         DBUG("Reading multiple meshes.");
+        // The configuration is parsed sequentially, only the mesh files are
+        // read in parallel.
+        std::vector<MeshInput> inputs;
         for (auto mesh_config :
              //! \ogs_file_param{prj__meshes__mesh}
              optional_meshes->getConfigParameterList("mesh"))
         {
-            meshes.push_back(readSingleMesh(mesh_config, project_directory));
+            inputs.push_back(parseMeshInput(mesh_config, project_directory));
         }
+        meshes = readMeshesInParallel(inputs);
     }
     else
     {  // Read single mesh with geometry.
@@ -181,9 +254,9 @@ std::vector<std::unique_ptr<MeshLib::Mesh>> readMeshes(
             "meshes input. See "
             "https://www.opengeosys.org/docs/tools/model-preparation/"
             "constructmeshesfromgeometry/ tool for conversion.");
-        //! \ogs_file_param{prj__mesh}
-        meshes.push_back(readSingleMesh(config.getConfigParameter("mesh"),
-                                        project_directory));
+        meshes.push_back(readSingleMesh(parseMeshInput(
+            //! \ogs_file_param{prj__mesh}
+            config.getConfigParameter("mesh"), project_directory)));
 
         std::string const geometry_file = BaseLib::copyPathToFileName(
             //! \ogs_file_param{prj__geometry}
@@ -270,7 +343,11 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
                          std::string const& project_directory,
                          std::string const& output_directory)
 {
+    BaseLib::RunTime time_read_meshes;
+    time_read_meshes.start();
     _mesh_vec = readMeshes(project_config, project_directory);
+    INFO("[time] Reading %d meshes took %g s.", _mesh_vec.size(),
+         time_read_meshes.elapsed());
 
     if (auto const python_script =
             //! \ogs_file_param{prj__python_script}
@@ -498,6 +575,18 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             //! \ogs_file_param{prj__processes__process__jacobian_assembler}
             process_config.getConfigSubtreeOptional("jacobian_assembler"));
 
+        auto const cached_scatter =
+            //! \ogs_file_param{prj__processes__process__cached_scatter}
+            process_config.getConfigParameter<bool>("cached_scatter", false);
+        auto const residual_only_assembly =
+            //! \ogs_file_param{prj__processes__process__residual_only_assembly}
+            process_config.getConfigParameter<bool>("residual_only_assembly",
+                                                    false);
+        auto const compact_deactivated_subdomains =
+            //! \ogs_file_param{prj__processes__process__compact_deactivated_subdomains}
+            process_config.getConfigParameter<bool>(
+                "compact_deactivated_subdomains", false);
+
 #ifdef OGS_BUILD_PROCESS_GROUNDWATERFLOW
         if (type == "GROUNDWATER_FLOW")
         {
@@ -930,6 +1019,10 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             OGS_FATAL("The process name '%s' is not unique.", name.c_str());
         }
+        process->setCachedScatter(cached_scatter);
+        process->setResidualOnlyAssembly(residual_only_assembly);
+        process->setCompactDeactivatedSubdomains(
+            compact_deactivated_subdomains);
         _processes.push_back(std::move(process));
     }
 }
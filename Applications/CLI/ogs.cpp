@@ -108,6 +108,22 @@ int main(int argc, char* argv[])
                                          "use unbuffered standard output");
     cmd.add(unbuffered_cout_arg);
 
+    TCLAP::ValueArg<std::string> restart_arg(
+        "", "restart",
+        "restart the simulation from the given checkpoint file written by "
+        "the <checkpoint> configuration of the time loop; with MPI each rank "
+        "reads its own file",
+        false, "", "PATH");
+    cmd.add(restart_arg);
+
+#ifdef OGS_USE_PARALLEL_ASSEMBLY
+    TCLAP::SwitchArg nondeterministic_assembly_arg(
+        "", "nondeterministic-assembly",
+        "do not enforce the serial summation order in the parallel global "
+        "assembly; faster, but the results are not bitwise reproducible");
+    cmd.add(nondeterministic_assembly_arg);
+#endif  // OGS_USE_PARALLEL_ASSEMBLY
+
 #ifndef _WIN32  // TODO: On windows floating point exceptions are not handled
                 // currently
     TCLAP::SwitchArg enable_fpe_arg("", "enable-fpe",
@@ -141,6 +157,13 @@ int main(int argc, char* argv[])
     }
 #endif  // _WIN32
 
+#ifdef OGS_USE_PARALLEL_ASSEMBLY
+    GlobalExecutor::deterministic = !nondeterministic_assembly_arg.getValue();
+    INFO("Global assembly runs on up to %d threads (%s).",
+         omp_get_max_threads(),
+         GlobalExecutor::deterministic ? "deterministic" : "nondeterministic");
+#endif  // OGS_USE_PARALLEL_ASSEMBLY
+
 #ifdef OGS_USE_PYTHON
     pybind11::scoped_interpreter guard = ApplicationsLib::setupEmbeddedPython();
     (void)guard;
@@ -183,9 +206,13 @@ int main(int argc, char* argv[])
             BaseLib::setProjectDirectory(
                 BaseLib::extractPath(project_arg.getValue()));
 
+            BaseLib::RunTime time_project;
+            time_project.start();
             ProjectData project(*project_config,
                                 BaseLib::getProjectDirectory(),
                                 outdir_arg.getValue());
+            INFO("[time] Constructing the project took %g s.",
+                 time_project.elapsed());
 
             if (!reference_path_arg.isSet())
             {  // Ignore the test_definition section.
@@ -219,10 +246,14 @@ int main(int argc, char* argv[])
 #endif
 
             INFO("Initialize processes.");
+            BaseLib::RunTime time_initialize;
+            time_initialize.start();
             for (auto& p : project.getProcesses())
             {
                 p->initialize();
             }
+            INFO("[time] Initializing the processes took %g s.",
+                 time_initialize.elapsed());
 
             // Check intermediately that config parsing went fine.
             project_config.checkAndInvalidate();
@@ -235,7 +266,7 @@ int main(int argc, char* argv[])
             INFO("Solve processes.");
 
             auto& time_loop = project.getTimeLoop();
-            time_loop.initialize();
+            time_loop.initialize(restart_arg.getValue());
             solver_succeeded = time_loop.loop();
 
 #ifdef USE_INSITU
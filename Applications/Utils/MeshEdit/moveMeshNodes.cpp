@@ -185,7 +185,7 @@ int main (int argc, char* argv[])
 
         for (std::size_t i=0; i<nNodes; i++)
         {
-            const std::vector<MeshLib::Node*> conn_nodes (nodes[i]->getConnectedNodes());
+            auto const conn_nodes = nodes[i]->getConnectedNodes();
             const unsigned nConnNodes (conn_nodes.size());
             elevation[i] = (2*(*nodes[i])[2]);
             for (std::size_t j = 0; j < nConnNodes; ++j)
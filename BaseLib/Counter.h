@@ -10,20 +10,25 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 
 namespace BaseLib
 {
+/// Counts the constructed objects of type X. Objects may be constructed
+/// concurrently.
 template <typename X>
 struct Counter
 {
-    Counter()
-    {
-        _counter_value++;
-    }
-    static std::size_t _counter_value;
+    Counter() : _counter_id(_counter_value++) {}
+
+    /// Number of objects of type X constructed before this one.
+    std::size_t const _counter_id;
+
+    static std::atomic<std::size_t> _counter_value;
 };
 
-template <typename X> std::size_t Counter<X>::_counter_value(0);
+template <typename X>
+std::atomic<std::size_t> Counter<X>::_counter_value(0);
 
 } // end namespace BaseLib
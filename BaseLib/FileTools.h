@@ -70,6 +70,32 @@ T readBinaryValue(std::istream& in)
     return v;
 }
 
+/**
+ * \brief write an array of values as binary into the given output stream
+ *
+ * \param out    output stream, have to be opened in binary mode
+ * \param values pointer to the first of the \c n values
+ * \param n      number of values
+ */
+template <typename T>
+void writeArrayBinary(std::ostream& out, T const* values, std::size_t const n)
+{
+    out.write(reinterpret_cast<const char*>(values), n * sizeof(T));
+}
+
+/**
+ * \brief read an array of binary values from the given input stream
+ *
+ * \param in     input stream, have to be opened in binary mode
+ * \param values preallocated array for the \c n values
+ * \param n      number of values
+ */
+template <typename T>
+void readArrayBinary(std::istream& in, T* values, std::size_t const n)
+{
+    in.read(reinterpret_cast<char*>(values), n * sizeof(T));
+}
+
 template <typename T>
 std::vector<T> readBinaryArray(std::string const& filename, std::size_t const n)
 {
@@ -111,4 +111,31 @@ std::string format(const char* format_str, ... )
     return std::string(buffer.data());
 }
 
+std::string escapeXml(std::string const& text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char const c : text)
+    {
+        switch (c)
+        {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
 } // end namespace BaseLib
@@ -89,4 +89,8 @@ std::string const& tostring(std::string const& value);
 //! returns printf-like formatted string
 std::string format(const char* format_string, ... );
 
+//! Replaces the characters with special meaning in XML, i.e. &, <, >, and ",
+//! by their entity references.
+std::string escapeXml(std::string const& text);
+
 } // end namespace BaseLib
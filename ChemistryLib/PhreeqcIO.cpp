@@ -8,9 +8,16 @@
  *
  */
 
-#include <boost/algorithm/string.hpp>
+#include <algorithm>
 #include <cmath>
-#include <iostream>
+#include <exception>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "BaseLib/Algorithm.h"
 #include "BaseLib/ConfigTreeUtil.h"
@@ -39,8 +46,7 @@ std::ostream& operator<<(std::ostream& os,
 }
 }  // namespace
 
-PhreeqcIO::PhreeqcIO(std::string const project_file_name,
-                     std::string&& database,
+PhreeqcIO::PhreeqcIO(std::string&& database,
                      std::vector<AqueousSolution>&& aqueous_solutions,
                      std::vector<EquilibriumPhase>&& equilibrium_phases,
                      std::vector<KineticReactant>&& kinetic_reactants,
@@ -48,8 +54,7 @@ PhreeqcIO::PhreeqcIO(std::string const project_file_name,
                      std::unique_ptr<Output>&& output,
                      std::vector<std::pair<int, std::string>> const&
                          process_id_to_component_name_map)
-    : _phreeqc_input_file(project_file_name + "_phreeqc.inp"),
-      _database(std::move(database)),
+    : _database(std::move(database)),
       _aqueous_solutions(std::move(aqueous_solutions)),
       _equilibrium_phases(std::move(equilibrium_phases)),
       _kinetic_reactants(std::move(kinetic_reactants)),
@@ -57,28 +62,52 @@ PhreeqcIO::PhreeqcIO(std::string const project_file_name,
       _output(std::move(output)),
       _process_id_to_component_name_map(process_id_to_component_name_map)
 {
-    // initialize phreeqc instance
-    if (CreateIPhreeqc() != phreeqc_instance_id)
+#ifdef _OPENMP
+    std::size_t const num_threads = omp_get_max_threads();
+#else
+    std::size_t const num_threads = 1;
+#endif
+    std::size_t const num_instances = std::max<std::size_t>(
+        1, std::min(num_threads, _aqueous_solutions.size()));
+    INFO("Phreeqc: Using %d IPhreeqc instances.", num_instances);
+
+    for (std::size_t i = 0; i < num_instances; ++i)
     {
-        OGS_FATAL(
-            "Failed to initialize phreeqc instance, due to lack of memory.");
-    }
+        // initialize phreeqc instance
+        int const instance_id = CreateIPhreeqc();
+        if (instance_id < 0)
+        {
+            OGS_FATAL(
+                "Failed to initialize phreeqc instance, due to lack of "
+                "memory.");
+        }
+        _phreeqc_instance_ids.push_back(instance_id);
 
-    // load specified thermodynamic database
-    if (LoadDatabase(phreeqc_instance_id, _database.c_str()) != IPQ_OK)
-    {
-        OGS_FATAL(
-            "Failed in loading the specified thermodynamic database file: "
-            "%s.",
-            _database.c_str());
+        // load specified thermodynamic database
+        if (LoadDatabase(instance_id, _database.c_str()) != IPQ_OK)
+        {
+            OutputErrorString(instance_id);
+            OGS_FATAL(
+                "Failed in loading the specified thermodynamic database file: "
+                "%s.",
+                _database.c_str());
+        }
+
+        // The results are read from the selected output kept in memory.
+        if (SetSelectedOutputFileOn(instance_id, 0) != IPQ_OK)
+        {
+            OGS_FATAL(
+                "Failed to switch off writing of the phreeqc selected output "
+                "file.");
+        }
     }
+}
 
-    if (SetSelectedOutputFileOn(phreeqc_instance_id, 1) != IPQ_OK)
+PhreeqcIO::~PhreeqcIO()
+{
+    for (auto const instance_id : _phreeqc_instance_ids)
     {
-        OGS_FATAL(
-            "Failed to fly the flag for the specified file %s where phreeqc "
-            "will write output.",
-            _output->basic_output_setups.output_file.c_str());
+        DestroyIPhreeqc(instance_id);
     }
 }
 
@@ -88,11 +117,7 @@ void PhreeqcIO::doWaterChemistryCalculation(
     setAqueousSolutionsOrUpdateProcessSolutions(
         process_solutions, Status::SettingAqueousSolutions);
 
-    writeInputsToFile(dt);
-
-    execute();
-
-    readOutputsFromFile();
+    execute(dt);
 
     setAqueousSolutionsOrUpdateProcessSolutions(
         process_solutions, Status::UpdatingProcessSolutions);
@@ -174,186 +199,175 @@ void PhreeqcIO::setAqueousSolutionsOrUpdateProcessSolutions(
     }
 }
 
-void PhreeqcIO::writeInputsToFile(double const dt)
+void PhreeqcIO::execute(double const dt)
 {
-    DBUG("Writing phreeqc inputs into file '%s'.", _phreeqc_input_file.c_str());
-    std::ofstream out(_phreeqc_input_file, std::ofstream::out);
+    INFO("Phreeqc: Executing chemical calculation.");
 
-    if (!out)
+    auto const num_chemical_systems = _aqueous_solutions.size();
+    auto const num_instances =
+        static_cast<std::ptrdiff_t>(_phreeqc_instance_ids.size());
+    std::exception_ptr exception;
+
+#pragma omp parallel for schedule(static, 1)
+    for (std::ptrdiff_t i = 0; i < num_instances; ++i)
+    {
+        // Contiguous ranges of chemical systems of similar size.
+        std::size_t const first = num_chemical_systems * i / num_instances;
+        std::size_t const last = num_chemical_systems * (i + 1) / num_instances;
+        try
+        {
+            executeChemicalSystems(_phreeqc_instance_ids[i], first, last, dt);
+        }
+        catch (...)
+        {
+#pragma omp critical(ogs_phreeqc_io_exception)
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception)
     {
-        OGS_FATAL("Could not open file '%s' for writing phreeqc inputs.",
-                  _phreeqc_input_file.c_str());
+        std::rethrow_exception(exception);
+    }
+}
+
+void PhreeqcIO::executeChemicalSystems(int const instance_id,
+                                       std::size_t const first,
+                                       std::size_t const last,
+                                       double const dt)
+{
+    if (first == last)
+    {
+        return;
     }
 
-    out << (*this << dt);
+    std::ostringstream input;
+    writeInputs(input, first, last, dt);
 
-    if (!out)
+    if (RunString(instance_id, input.str().c_str()) != 0)
     {
-        OGS_FATAL("Failed in generating phreeqc input file '%s'.",
-                  _phreeqc_input_file.c_str());
+        OGS_FATAL(
+            "Failed in performing speciation calculation of the chemical "
+            "systems %d to %d: %s",
+            first, last - 1, GetErrorString(instance_id));
     }
 
-    out.close();
+    readOutputs(instance_id, first, last);
 }
 
-std::ostream& operator<<(std::ostream& os, PhreeqcIO const& phreeqc_io)
+void PhreeqcIO::writeInputs(std::ostream& os, std::size_t const first,
+                            std::size_t const last, double const dt) const
 {
     os << "SELECTED_OUTPUT" << "\n";
-    os << *phreeqc_io._output << "\n";
+    os << *_output << "\n";
 
-    auto const& reaction_rates = phreeqc_io._reaction_rates;
-    if (!reaction_rates.empty())
+    if (!_reaction_rates.empty())
     {
         os << "RATES" << "\n";
-        os << reaction_rates << "\n";
+        os << _reaction_rates << "\n";
     }
 
-    std::size_t const num_chemical_systems =
-        phreeqc_io._aqueous_solutions.size();
-    for (std::size_t chemical_system_id = 0;
-         chemical_system_id < num_chemical_systems;
+    for (std::size_t chemical_system_id = first; chemical_system_id < last;
          ++chemical_system_id)
     {
-        auto const& aqueous_solution =
-            phreeqc_io._aqueous_solutions[chemical_system_id];
+        auto const& aqueous_solution = _aqueous_solutions[chemical_system_id];
         os << "SOLUTION " << chemical_system_id + 1 << "\n";
         os << aqueous_solution << "\n";
 
-        auto const& equilibrium_phases = phreeqc_io._equilibrium_phases;
-        if (!equilibrium_phases.empty())
+        if (!_equilibrium_phases.empty())
         {
             os << "EQUILIBRIUM_PHASES " << chemical_system_id + 1 << "\n";
-            for (auto const& equilibrium_phase : equilibrium_phases)
+            for (auto const& equilibrium_phase : _equilibrium_phases)
             {
                 equilibrium_phase.print(os, chemical_system_id);
             }
         }
 
-        auto const& kinetic_reactants = phreeqc_io._kinetic_reactants;
-        if (!kinetic_reactants.empty())
+        if (!_kinetic_reactants.empty())
         {
             os << "KINETICS " << chemical_system_id + 1 << "\n";
-            for (auto const& kinetic_reactant : kinetic_reactants)
+            for (auto const& kinetic_reactant : _kinetic_reactants)
             {
                 kinetic_reactant.print(os, chemical_system_id);
             }
-            os << "-steps " << phreeqc_io._dt << "\n" << "\n";
+            os << "-steps " << dt << "\n" << "\n";
         }
 
         os << "END" << "\n" << "\n";
     }
-
-    return os;
-}
-
-void PhreeqcIO::execute()
-{
-    INFO("Phreeqc: Executing chemical calculation.");
-    if (RunFile(phreeqc_instance_id, _phreeqc_input_file.c_str()) != IPQ_OK)
-    {
-        OutputErrorString(phreeqc_instance_id);
-        OGS_FATAL(
-            "Failed in performing speciation calculation with the generated "
-            "phreeqc input file '%s'.",
-            _phreeqc_input_file.c_str());
-    }
 }
 
-void PhreeqcIO::readOutputsFromFile()
+void PhreeqcIO::readOutputs(int const instance_id, std::size_t const first,
+                            std::size_t const last)
 {
-    auto const& basic_output_setups = _output->basic_output_setups;
-    auto const& phreeqc_result_file = basic_output_setups.output_file;
-    DBUG("Reading phreeqc results from file '%s'.",
-         phreeqc_result_file.c_str());
-    std::ifstream in(phreeqc_result_file);
-
-    if (!in)
-    {
-        OGS_FATAL("Could not open phreeqc result file '%s'.",
-                  phreeqc_result_file.c_str());
-    }
-
-    in >> *this;
+    auto const& output = *_output;
+    auto const& dropped_item_ids = output.dropped_item_ids;
 
-    if (!in)
+    // The first row holds the headings. Each chemical system has one row for
+    // the equilibrium calculation of the initial solution and one for the
+    // solution after the reaction.
+    int const num_rows = GetSelectedOutputRowCount(instance_id);
+    int const num_columns = GetSelectedOutputColumnCount(instance_id);
+    if (num_rows != 1 + 2 * static_cast<int>(last - first))
     {
-        OGS_FATAL("Error when reading phreeqc result file '%s'",
-                  phreeqc_result_file.c_str());
+        OGS_FATAL(
+            "Expected %d rows of phreeqc results for the chemical systems %d "
+            "to %d, but got %d.",
+            1 + 2 * (last - first), first, last - 1, num_rows);
     }
 
-    in.close();
-}
-
-std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
-{
-    // Skip the headline
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-    std::string line;
-    auto const& output = *phreeqc_io._output;
-    auto const& dropped_item_ids = output.dropped_item_ids;
-    std::size_t const num_chemical_systems =
-        phreeqc_io._aqueous_solutions.size();
-    for (std::size_t chemical_system_id = 0;
-         chemical_system_id < num_chemical_systems;
+    std::vector<double> accepted_items;
+    accepted_items.reserve(output.accepted_items.size());
+    VAR value;
+    VarInit(&value);
+    for (std::size_t chemical_system_id = first; chemical_system_id < last;
          ++chemical_system_id)
     {
-        // Skip equilibrium calculation result of initial solution
-        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
         // Get calculation result of the solution after the reaction
-        if (!std::getline(in, line))
-        {
-            OGS_FATAL(
-                "Error when reading calculation result of Solution %u after "
-                "the reaction.",
-                chemical_system_id);
-        }
+        int const row = 2 * static_cast<int>(chemical_system_id - first) + 2;
 
-        std::vector<double> accepted_items;
-        std::vector<std::string> items;
-        boost::trim_if(line, boost::is_any_of("\t "));
-        boost::algorithm::split(items, line, boost::is_any_of("\t "),
-                                boost::token_compress_on);
-        for (int item_id = 0; item_id < static_cast<int>(items.size());
-             ++item_id)
+        accepted_items.clear();
+        for (int item_id = 0; item_id < num_columns; ++item_id)
         {
             if (std::find(dropped_item_ids.begin(), dropped_item_ids.end(),
-                          item_id) == dropped_item_ids.end())
+                          item_id) != dropped_item_ids.end())
             {
-                double value;
-                try
-                {
-                    value = std::stod(items[item_id]);
-                }
-                catch (const std::invalid_argument& e)
-                {
-                    OGS_FATAL(
-                        "Invalid argument. Could not convert string '%s' to "
-                        "double for chemical system %d, column %d. Exception "
-                        "'%s' was thrown.",
-                        items[item_id].c_str(), chemical_system_id, item_id,
-                        e.what());
-                }
-                catch (const std::out_of_range& e)
-                {
+                continue;
+            }
+
+            if (GetSelectedOutputValue(instance_id, row, item_id, &value) !=
+                IPQ_OK)
+            {
+                OGS_FATAL(
+                    "Could not get the phreeqc result for chemical system %d, "
+                    "column %d.",
+                    chemical_system_id, item_id);
+            }
+            switch (value.type)
+            {
+                case TT_DOUBLE:
+                    accepted_items.push_back(value.dVal);
+                    break;
+                case TT_LONG:
+                    accepted_items.push_back(value.lVal);
+                    break;
+                default:
                     OGS_FATAL(
-                        "Out of range error. Could not convert string '%s' to "
-                        "double for chemical system %d, column %d. Exception "
-                        "'%s' was thrown.",
-                        items[item_id].c_str(), chemical_system_id, item_id,
-                        e.what());
-                }
-                accepted_items.push_back(value);
+                        "The phreeqc result for chemical system %d, column %d "
+                        "is not a number.",
+                        chemical_system_id, item_id);
             }
+            VarClear(&value);
         }
         assert(accepted_items.size() == output.accepted_items.size());
 
-        auto& aqueous_solution =
-            phreeqc_io._aqueous_solutions[chemical_system_id];
+        auto& aqueous_solution = _aqueous_solutions[chemical_system_id];
         auto& components = aqueous_solution.components;
-        auto& equilibrium_phases = phreeqc_io._equilibrium_phases;
-        auto& kinetic_reactants = phreeqc_io._kinetic_reactants;
+        auto& equilibrium_phases = _equilibrium_phases;
+        auto& kinetic_reactants = _kinetic_reactants;
         for (int item_id = 0; item_id < static_cast<int>(accepted_items.size());
              ++item_id)
         {
@@ -413,8 +427,6 @@ std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io)
             }
         }
     }
-
-    return in;
 }
 }  // namespace PhreeqcIOData
 }  // namespace ChemistryLib
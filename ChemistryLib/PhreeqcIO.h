@@ -10,7 +10,9 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <memory>
+#include <vector>
 
 #include "ChemicalSolverInterface.h"
 
@@ -30,11 +32,16 @@ enum class Status
     UpdatingProcessSolutions
 };
 
+/// Performs the chemical calculations with IPhreeqc.
+///
+/// The chemical systems are split into contiguous ranges of similar size, one
+/// for each OpenMP thread. Each range is calculated by a separate IPhreeqc
+/// instance from an input string, which is built in memory, and its results
+/// are read from the instance's selected output without file round-trips.
 class PhreeqcIO final : public ChemicalSolverInterface
 {
 public:
-    PhreeqcIO(std::string const project_file_name,
-              std::string&& database,
+    PhreeqcIO(std::string&& database,
               std::vector<AqueousSolution>&& aqueous_solutions,
               std::vector<EquilibriumPhase>&& equilibrium_phases,
               std::vector<KineticReactant>&& kinetic_reactants,
@@ -43,6 +50,8 @@ public:
               std::vector<std::pair<int, std::string>> const&
                   process_id_to_component_name_map);
 
+    ~PhreeqcIO() override;
+
     void doWaterChemistryCalculation(
         std::vector<GlobalVector*>& process_solutions,
         double const dt) override;
@@ -51,25 +60,24 @@ public:
         std::vector<GlobalVector*> const& process_solutions,
         Status const status);
 
-    void writeInputsToFile(double const dt);
-
-    void execute();
-
-    void readOutputsFromFile();
+    /// Calculates all chemical systems, each range of them by one IPhreeqc
+    /// instance in its own thread.
+    void execute(double const dt);
 
-    friend std::ostream& operator<<(std::ostream& os,
-                                    PhreeqcIO const& phreeqc_io);
-
-    friend std::istream& operator>>(std::istream& in, PhreeqcIO& phreeqc_io);
+private:
+    /// Writes the phreeqc input for the chemical systems in [first, last).
+    void writeInputs(std::ostream& os, std::size_t const first,
+                     std::size_t const last, double const dt) const;
 
-    std::string const _phreeqc_input_file;
+    /// Runs the phreeqc input for the chemical systems in [first, last) with
+    /// the given IPhreeqc instance and updates them with the results.
+    void executeChemicalSystems(int const instance_id, std::size_t const first,
+                                std::size_t const last, double const dt);
 
-private:
-    PhreeqcIO& operator<<(double const dt)
-    {
-        _dt = dt;
-        return *this;
-    }
+    /// Reads the results of the chemical systems in [first, last) from the
+    /// selected output of the given IPhreeqc instance.
+    void readOutputs(int const instance_id, std::size_t const first,
+                     std::size_t const last);
 
     std::string const _database;
     std::vector<AqueousSolution> _aqueous_solutions;
@@ -79,8 +87,8 @@ private:
     std::unique_ptr<Output> const _output;
     std::vector<std::pair<int, std::string>> const&
         _process_id_to_component_name_map;
-    double _dt = std::numeric_limits<double>::quiet_NaN();
-    const int phreeqc_instance_id = 0;
+    /// IPhreeqc instances with loaded database, one for each thread.
+    std::vector<int> _phreeqc_instance_ids;
 };
 }  // namespace PhreeqcIOData
 }  // namespace ChemistryLib
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
+#include <utility>
 #include <vector>
 
 #include <logog/include/logog.hpp>
@@ -99,6 +101,17 @@ public:
         MathLib::Point3d const& max_pnt,
         std::vector<std::vector<POINT*> const*>& pnts) const;
 
+    /**
+     * Returns the ids of the points located in the grid cells intersecting
+     * at least one of the given axis aligned cuboids. Each cuboid is given by
+     * its points with minimal and maximal coordinates. The ids are sorted and
+     * unique. The points are only candidates, i.e., they may lie outside of
+     * the cuboids.
+     */
+    std::vector<std::size_t> getPointIDsInGridCellsIntersectingCuboids(
+        std::vector<std::pair<MathLib::Point3d, MathLib::Point3d>> const&
+            cuboids) const;
+
 #ifndef NDEBUG
     /**
      * Method creates a geometry for every mesh grid box. Additionally it
@@ -283,6 +296,34 @@ void Grid<POINT>::getPntVecsOfGridCellsIntersectingCuboid(
     }
 }
 
+template <typename POINT>
+std::vector<std::size_t> Grid<POINT>::getPointIDsInGridCellsIntersectingCuboids(
+    std::vector<std::pair<MathLib::Point3d, MathLib::Point3d>> const& cuboids)
+    const
+{
+    std::vector<std::vector<POINT*> const*> vec_pnts;
+    for (auto const& cuboid : cuboids)
+    {
+        getPntVecsOfGridCellsIntersectingCuboid(cuboid.first, cuboid.second,
+                                                vec_pnts);
+    }
+    // Neighbouring cuboids share grid cells.
+    std::sort(vec_pnts.begin(), vec_pnts.end());
+    vec_pnts.erase(std::unique(vec_pnts.begin(), vec_pnts.end()),
+                   vec_pnts.end());
+
+    std::vector<std::size_t> ids;
+    for (auto const* const vec : vec_pnts)
+    {
+        for (auto const* const p : *vec)
+        {
+            ids.push_back(p->getID());
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
 #ifndef NDEBUG
 template <typename POINT>
 void Grid<POINT>::createGridGeometry(GeoLib::GEOObjects* geo_obj) const
@@ -390,9 +431,10 @@ std::array<std::size_t,3> Grid<POINT>::getGridCoords(T const& pnt) const
             else
             {
                 coords[k] = static_cast<std::size_t>(
-                    std::floor((pnt[k] - _min_pnt[k])) /
-                    std::nextafter(_step_sizes[k],
-                                   std::numeric_limits<double>::max()));
+                    std::floor((pnt[k] - _min_pnt[k]) /
+                               std::nextafter(
+                                   _step_sizes[k],
+                                   std::numeric_limits<double>::max())));
             }
         }
     }
@@ -0,0 +1,113 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "findPointsWithinRadius.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Grid.h"
+#include "MathLib/MathTools.h"
+
+namespace
+{
+/// Estimates the number of points in a cube with the edge length \c radius
+/// assuming the points are distributed uniformly in their bounding box.
+std::size_t estimateNumberOfPointsPerCube(GeoLib::AABB const& aabb,
+                                          std::size_t const n_points,
+                                          double const radius)
+{
+    auto const& min = aabb.getMinPoint();
+    auto const& max = aabb.getMaxPoint();
+    double const max_extension =
+        std::max({max[0] - min[0], max[1] - min[1], max[2] - min[2]});
+
+    double fraction = 1;
+    for (int k = 0; k < 3; ++k)
+    {
+        // Same criterion for degenerated dimensions as in GeoLib::Grid.
+        double const extension = max[k] - min[k];
+        if (extension >= 1e-4 * max_extension)
+        {
+            fraction *= std::min(radius, extension) / extension;
+        }
+    }
+    return std::max<std::size_t>(1, std::ceil(n_points * fraction));
+}
+}  // namespace
+
+namespace GeoLib
+{
+PointNeighbourhoods findPointsWithinRadius(
+    std::vector<MathLib::Point3d> const& points, double const radius_squared)
+{
+    PointNeighbourhoods neighbourhoods;
+    auto const n_points = static_cast<std::ptrdiff_t>(points.size());
+    neighbourhoods.offsets.assign(n_points + 1, 0);
+    if (n_points == 0)
+    {
+        return neighbourhoods;
+    }
+
+    double const radius = std::sqrt(radius_squared);
+    GeoLib::Grid<MathLib::Point3d> const grid(
+        points.begin(), points.end(),
+        estimateNumberOfPointsPerCube(
+            GeoLib::AABB(points.begin(), points.end()), points.size(),
+            radius));
+
+    // Calls f(j, distance2) for all neighbours j of the i-th point.
+    auto for_each_neighbour = [&](std::ptrdiff_t const i, auto const& f) {
+        auto const& point = points[i];
+        for (auto const* cell :
+             grid.getPntVecsOfGridCellsIntersectingCube(point, radius))
+        {
+            for (auto const* neighbour : *cell)
+            {
+                double const distance2 = MathLib::sqrDist(point, *neighbour);
+                if (distance2 < radius_squared)
+                {
+                    f(static_cast<std::size_t>(neighbour - points.data()),
+                      distance2);
+                }
+            }
+        }
+    };
+
+    // The neighbours are counted first to allocate the compressed storage,
+    // then the same queries are repeated to fill it.
+#pragma omp parallel for schedule(dynamic, 256)
+    for (std::ptrdiff_t i = 0; i < n_points; ++i)
+    {
+        std::size_t n_neighbours = 0;
+        for_each_neighbour(i, [&](std::size_t, double) { n_neighbours++; });
+        neighbourhoods.offsets[i + 1] = n_neighbours;
+    }
+    for (std::ptrdiff_t i = 0; i < n_points; ++i)
+    {
+        neighbourhoods.offsets[i + 1] += neighbourhoods.offsets[i];
+    }
+
+    neighbourhoods.indices.resize(neighbourhoods.offsets.back());
+    neighbourhoods.squared_distances.resize(neighbourhoods.offsets.back());
+#pragma omp parallel for schedule(dynamic, 256)
+    for (std::ptrdiff_t i = 0; i < n_points; ++i)
+    {
+        auto position = neighbourhoods.offsets[i];
+        for_each_neighbour(i, [&](std::size_t const j, double const distance2) {
+            neighbourhoods.indices[position] = j;
+            neighbourhoods.squared_distances[position] = distance2;
+            position++;
+        });
+    }
+
+    return neighbourhoods;
+}
+}  // namespace GeoLib
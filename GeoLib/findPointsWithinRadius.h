@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+namespace GeoLib
+{
+/// The neighbourhoods of a set of points in compressed sparse row format. The
+/// neighbours of the i-th point are stored in the entries [offsets[i],
+/// offsets[i+1]) of \c indices and \c squared_distances.
+struct PointNeighbourhoods
+{
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> indices;
+    std::vector<double> squared_distances;
+};
+
+/// Finds for each of the given points the indices of all points with a squared
+/// distance less than \c radius_squared, including the point itself.
+///
+/// The points are sorted into a GeoLib::Grid whose cells hold about as many
+/// points as a cube with the edge length of the radius. Each query examines
+/// only the grid cells intersecting the cube around the point. The queries are
+/// run in parallel if OpenMP is enabled; the result does not depend on the
+/// number of threads.
+PointNeighbourhoods findPointsWithinRadius(
+    std::vector<MathLib::Point3d> const& points, double const radius_squared);
+}  // namespace GeoLib
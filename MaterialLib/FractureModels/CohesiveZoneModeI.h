@@ -42,19 +42,21 @@ struct MaterialPropertiesParameters
     /// Assuming initially stress-free state.
     double fracture_opening_at_peak_traction(double const t, X const& x) const
     {
-        return peak_normal_traction(t, x)[0] / normal_stiffness(t, x)[0];
+        return peak_normal_traction.scalarValue(t, x) /
+               normal_stiffness.scalarValue(t, x);
     }
 
     /// Assuming initially stress-free state.
     double fracture_opening_at_residual_traction(double const t,
                                                  X const& x) const
     {
-        if (peak_normal_traction(t, x)[0] == 0.0)
+        if (peak_normal_traction.scalarValue(t, x) == 0.0)
         {
             return 0.0;
         }
 
-        return 2 * fracture_toughness(t, x)[0] / peak_normal_traction(t, x)[0];
+        return 2 * fracture_toughness.scalarValue(t, x) /
+               peak_normal_traction.scalarValue(t, x);
     }
 
     /// Normal stiffness given in units of stress per length.
@@ -86,10 +88,10 @@ struct MaterialProperties final
 {
     MaterialProperties(double const t, ParameterLib::SpatialPosition const& x,
                        MaterialPropertiesParameters const& mp)
-        : Kn(mp.normal_stiffness(t, x)[0]),
-          Ks(mp.shear_stiffness(t, x)[0]),
-          Gc(mp.fracture_toughness(t, x)[0]),
-          t_np(mp.peak_normal_traction(t, x)[0]),
+        : Kn(mp.normal_stiffness.scalarValue(t, x)),
+          Ks(mp.shear_stiffness.scalarValue(t, x)),
+          Gc(mp.fracture_toughness.scalarValue(t, x)),
+          t_np(mp.peak_normal_traction.scalarValue(t, x)),
           w_np(mp.fracture_opening_at_peak_traction(t, x)),
           w_nf(mp.fracture_opening_at_residual_traction(t, x))
     {
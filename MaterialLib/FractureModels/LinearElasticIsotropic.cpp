@@ -41,7 +41,7 @@ void LinearElasticIsotropic<DisplacementDim>::computeConstitutiveRelation(
     C.setZero();
     for (int i = 0; i < index_ns; i++)
     {
-        C(i, i) = _mp.shear_stiffness(t, x)[0];
+        C(i, i) = _mp.shear_stiffness.scalarValue(t, x);
     }
 
     sigma.noalias() = C * w;
@@ -49,11 +49,11 @@ void LinearElasticIsotropic<DisplacementDim>::computeConstitutiveRelation(
     double const aperture = w[index_ns] + aperture0;
 
     sigma.coeffRef(index_ns) =
-        _mp.normal_stiffness(t, x)[0] * w[index_ns] *
+        _mp.normal_stiffness.scalarValue(t, x) * w[index_ns] *
         logPenalty(aperture0, aperture, _penalty_aperture_cutoff);
 
     C(index_ns, index_ns) =
-        _mp.normal_stiffness(t, x)[0] *
+        _mp.normal_stiffness.scalarValue(t, x) *
         logPenaltyDerivative(aperture0, aperture, _penalty_aperture_cutoff);
 
     sigma.noalias() += sigma0;
@@ -35,11 +35,11 @@ struct MaterialPropertyValues
                            double const t,
                            ParameterLib::SpatialPosition const& x)
     {
-        Kn = mp.normal_stiffness(t,x)[0];
-        Ks = mp.shear_stiffness(t,x)[0];
-        phi = MathLib::to_radians(mp.friction_angle(t,x)[0]);
-        psi = MathLib::to_radians(mp.dilatancy_angle(t,x)[0]);
-        c = mp.cohesion(t,x)[0];
+        Kn = mp.normal_stiffness.scalarValue(t, x);
+        Ks = mp.shear_stiffness.scalarValue(t, x);
+        phi = MathLib::to_radians(mp.friction_angle.scalarValue(t, x));
+        psi = MathLib::to_radians(mp.dilatancy_angle.scalarValue(t, x));
+        c = mp.cohesion.scalarValue(t, x);
     }
 };
 
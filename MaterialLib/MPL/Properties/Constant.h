@@ -25,5 +25,20 @@ public:
     /// PropertyDataType definition and sets the protected attribute _value of
     /// the base class Property to that value.
     explicit Constant(PropertyDataType const& v);
+
+    double scalarValue(VariableArray const& /*variable_array*/,
+                       ParameterLib::SpatialPosition const& /*pos*/,
+                       double const /*t*/) const override
+    {
+        return std::get<double>(_value);
+    }
+
+    double scalarDValue(VariableArray const& /*variable_array*/,
+                        Variable const /*variable*/,
+                        ParameterLib::SpatialPosition const& /*pos*/,
+                        double const /*t*/) const override
+    {
+        return std::get<double>(_dvalue);
+    }
 };
 }  // namespace MaterialPropertyLib
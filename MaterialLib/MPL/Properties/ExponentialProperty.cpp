@@ -23,6 +23,14 @@ ExponentialProperty::ExponentialProperty(
 }
 
 PropertyDataType ExponentialProperty::value(
+    VariableArray const& variable_array,
+    ParameterLib::SpatialPosition const& pos,
+    double const t) const
+{
+    return scalarValue(variable_array, pos, t);
+}
+
+double ExponentialProperty::scalarValue(
     VariableArray const& variable_array,
     ParameterLib::SpatialPosition const& /*pos*/,
     double const /*t*/) const
@@ -36,6 +44,13 @@ PropertyDataType ExponentialProperty::value(
 }
 
 PropertyDataType ExponentialProperty::dValue(
+    VariableArray const& variable_array, Variable const primary_variable,
+    ParameterLib::SpatialPosition const& pos, double const t) const
+{
+    return scalarDValue(variable_array, primary_variable, pos, t);
+}
+
+double ExponentialProperty::scalarDValue(
     VariableArray const& variable_array, Variable const primary_variable,
     ParameterLib::SpatialPosition const& /*pos*/, double const /*t*/) const
 {
@@ -47,7 +62,7 @@ PropertyDataType ExponentialProperty::dValue(
                          (std::get<double>(variable_array[static_cast<int>(
                               _exponent_data.type)]) -
                           std::get<double>(_exponent_data.reference_condition)))
-               : decltype(_value){};
+               : 0.0;
 }
 
 PropertyDataType ExponentialProperty::d2Value(
@@ -23,8 +23,15 @@ LinearProperty::LinearProperty(PropertyDataType const& property_reference_value,
 
 PropertyDataType LinearProperty::value(
     VariableArray const& variable_array,
-    ParameterLib::SpatialPosition const& /*pos*/,
-    double const /*t*/) const
+    ParameterLib::SpatialPosition const& pos,
+    double const t) const
+{
+    return scalarValue(variable_array, pos, t);
+}
+
+double LinearProperty::scalarValue(VariableArray const& variable_array,
+                                   ParameterLib::SpatialPosition const& /*pos*/,
+                                   double const /*t*/) const
 {
     auto calculate_linearized_ratio = [&variable_array](
                                           double const initial_linearized_ratio,
@@ -46,6 +53,15 @@ PropertyDataType LinearProperty::value(
 }
 
 PropertyDataType LinearProperty::dValue(
+    VariableArray const& variable_array,
+    Variable const primary_variable,
+    ParameterLib::SpatialPosition const& pos,
+    double const t) const
+{
+    return scalarDValue(variable_array, primary_variable, pos, t);
+}
+
+double LinearProperty::scalarDValue(
     VariableArray const& /*variable_array*/,
     Variable const primary_variable,
     ParameterLib::SpatialPosition const& /*pos*/,
@@ -61,7 +77,7 @@ PropertyDataType LinearProperty::dValue(
     return independent_variable != _independent_variables.end()
                ? std::get<double>(_value) *
                      std::get<double>(independent_variable->slope)
-               : decltype(_value){};
+               : 0.0;
 }
 
 PropertyDataType LinearProperty::d2Value(
@@ -54,6 +54,15 @@ public:
                              ParameterLib::SpatialPosition const& /*pos*/,
                              double const /*t*/) const override;
 
+    double scalarValue(VariableArray const& variable_array,
+                       ParameterLib::SpatialPosition const& pos,
+                       double const t) const override;
+
+    double scalarDValue(VariableArray const& variable_array,
+                        Variable const primary_variable,
+                        ParameterLib::SpatialPosition const& pos,
+                        double const t) const override;
+
 private:
     std::vector<IndependentVariable> const _independent_variables;
 };
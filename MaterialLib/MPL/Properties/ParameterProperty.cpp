@@ -19,20 +19,37 @@ ParameterProperty::ParameterProperty(
 }
 
 PropertyDataType ParameterProperty::value(
+    VariableArray const& variable_array,
+    ParameterLib::SpatialPosition const& pos,
+    double const t) const
+{
+    return scalarValue(variable_array, pos, t);
+}
+
+double ParameterProperty::scalarValue(
     VariableArray const& /*variable_array*/,
     ParameterLib::SpatialPosition const& pos,
     double const t) const
 {
-    return _parameter(t, pos)[0];
+    return _parameter.scalarValue(t, pos);
 }
 
 PropertyDataType ParameterProperty::dValue(
+    VariableArray const& variable_array,
+    Variable const primary_variable,
+    ParameterLib::SpatialPosition const& pos,
+    double const t) const
+{
+    return scalarDValue(variable_array, primary_variable, pos, t);
+}
+
+double ParameterProperty::scalarDValue(
     VariableArray const& /*variable_array*/,
     Variable const /*primary_variable*/,
     ParameterLib::SpatialPosition const& /*pos*/,
     double const /*t*/) const
 {
-    return double{};
+    return 0.0;
 }
 
 PropertyDataType ParameterProperty::d2Value(
@@ -46,6 +46,15 @@ public:
                              ParameterLib::SpatialPosition const& /*pos*/,
                              double const /*t*/) const override;
 
+    double scalarValue(VariableArray const& variable_array,
+                       ParameterLib::SpatialPosition const& pos,
+                       double const t) const override;
+
+    double scalarDValue(VariableArray const& variable_array,
+                        Variable const primary_variable,
+                        ParameterLib::SpatialPosition const& pos,
+                        double const t) const override;
+
 private:
     ParameterLib::Parameter<double> const& _parameter;
 };
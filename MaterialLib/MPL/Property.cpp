@@ -50,6 +50,21 @@ PropertyDataType Property::d2Value(VariableArray const& /*variable_array*/,
     return 0.0;
 }
 
+double Property::scalarValue(VariableArray const& variable_array,
+                             ParameterLib::SpatialPosition const& pos,
+                             double const t) const
+{
+    return std::get<double>(value(variable_array, pos, t));
+}
+
+double Property::scalarDValue(VariableArray const& variable_array,
+                              Variable const variable,
+                              ParameterLib::SpatialPosition const& pos,
+                              double const t) const
+{
+    return std::get<double>(dValue(variable_array, variable, pos, t));
+}
+
 void Property::notImplemented(const std::string& property,
                               const std::string& material) const
 {
@@ -74,6 +74,17 @@ public:
                                      Variable const variable2,
                                      ParameterLib::SpatialPosition const& pos,
                                      double const t) const;
+    /// Scalar fast path of value(), which returns the value without the
+    /// construction of a PropertyDataType. The default implementation calls
+    /// value() and requires the property to be a scalar.
+    virtual double scalarValue(VariableArray const& variable_array,
+                               ParameterLib::SpatialPosition const& pos,
+                               double const t) const;
+    /// Scalar fast path of dValue(), see scalarValue().
+    virtual double scalarDValue(VariableArray const& variable_array,
+                                Variable const variable,
+                                ParameterLib::SpatialPosition const& pos,
+                                double const t) const;
     virtual void setScale(
         std::variant<Medium*, Phase*, Component*> /*scale_pointer*/){};
 
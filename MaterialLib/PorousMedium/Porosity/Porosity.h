@@ -43,7 +43,7 @@ public:
     {
         (void)variable;
         (void)temperature;
-        return _parameter(t, pos)[0];
+        return _parameter.scalarValue(t, pos);
     }
 
 private:
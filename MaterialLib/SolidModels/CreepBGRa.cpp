@@ -38,8 +38,22 @@ CreepBGRa<DisplacementDim>::integrateStress(
     KelvinVector const& eps_prev, KelvinVector const& eps,
     KelvinVector const& sigma_prev,
     typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
-    /*material_state_variables*/,
+        material_state_variables,
     double const T) const
+{
+    return this->template integrateStressOnCopiedState<
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables>(
+        t, x, dt, eps_prev, eps, sigma_prev, material_state_variables, T);
+}
+
+template <int DisplacementDim>
+bool CreepBGRa<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    std::unique_ptr<typename MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>& /*material_state_variables*/,
+    double const T, KelvinVector& sigma, KelvinMatrix& tangentStiffness) const
 {
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
 
@@ -57,15 +71,17 @@ CreepBGRa<DisplacementDim>::integrateStress(
     // In case |s_{try}| is zero and _n < 3 (rare case).
     if (norm_s_try < std::numeric_limits<double>::epsilon() * C(0, 0))
     {
-        return {std::make_tuple(sigma_try, createMaterialStateVariables(), C)};
+        sigma = sigma_try;
+        tangentStiffness = C;
+        return true;
     }
 
     ResidualVectorType solution = sigma_try;
 
-    const double A = _a(t, x)[0];
-    const double n = _n(t, x)[0];
-    const double sigma0 = _sigma_f(t, x)[0];
-    const double Q = _q(t, x)[0];
+    const double A = _a.scalarValue(t, x);
+    const double n = _n.scalarValue(t, x);
+    const double sigma0 = _sigma_f.scalarValue(t, x);
+    const double Q = _q.scalarValue(t, x);
 
     const double constant_coefficient =
         getCreepConstantCoefficient(A, n, sigma0);
@@ -114,17 +130,22 @@ CreepBGRa<DisplacementDim>::integrateStress(
 
     if (!success_iterations)
     {
-        return {};
+        return false;
     }
 
     // If *success_iterations>0, tangentStiffness = J_(sigma)^{-1}C
     // where J_(sigma) is the Jacobian of the last local Newton-Raphson
     // iteration, which is already LU decomposed.
-    KelvinMatrix tangentStiffness =
-        (*success_iterations == 0) ? C : linear_solver.solve(C);
-
-    return {std::make_tuple(solution, createMaterialStateVariables(),
-                            tangentStiffness)};
+    if (*success_iterations == 0)
+    {
+        tangentStiffness = C;
+    }
+    else
+    {
+        tangentStiffness = linear_solver.solve(C);
+    }
+    sigma = solution;
+    return true;
 }
 
 template <int DisplacementDim>
@@ -132,10 +153,10 @@ double CreepBGRa<DisplacementDim>::getTemperatureRelatedCoefficient(
     double const t, double const dt, ParameterLib::SpatialPosition const& x,
     double const T, double const deviatoric_stress_norm) const
 {
-    const double A = _a(t, x)[0];
-    const double n = _n(t, x)[0];
-    const double sigma0 = _sigma_f(t, x)[0];
-    const double Q = _q(t, x)[0];
+    const double A = _a.scalarValue(t, x);
+    const double n = _n.scalarValue(t, x);
+    const double sigma0 = _sigma_f.scalarValue(t, x);
+    const double Q = _q.scalarValue(t, x);
 
     const double constant_coefficient =
         getCreepConstantCoefficient(A, n, sigma0);
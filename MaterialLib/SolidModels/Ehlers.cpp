@@ -512,14 +512,28 @@ SolidEhlers<DisplacementDim>::integrateStress(
     KelvinVector const& sigma_prev,
     typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
         material_state_variables,
-    double const /*T*/) const
+    double const T) const
+{
+    return this->template integrateStressOnCopiedState<
+        StateVariables<DisplacementDim>>(t, x, dt, eps_prev, eps, sigma_prev,
+                                         material_state_variables, T);
+}
+
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    std::unique_ptr<typename MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>& material_state_variables,
+    double const /*T*/, KelvinVector& sigma_final,
+    KelvinMatrix& tangentStiffness) const
 {
     assert(dynamic_cast<StateVariables<DisplacementDim> const*>(
-               &material_state_variables) != nullptr);
+               material_state_variables.get()) != nullptr);
 
-    StateVariables<DisplacementDim> state =
-        static_cast<StateVariables<DisplacementDim> const&>(
-            material_state_variables);
+    auto& state = static_cast<StateVariables<DisplacementDim>&>(
+        *material_state_variables);
     state.setInitialConditions();
 
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
@@ -537,8 +551,6 @@ SolidEhlers<DisplacementDim>::integrateStress(
     KelvinVector sigma = predict_sigma<DisplacementDim>(mp.G, mp.K, sigma_prev,
                                                         eps, eps_prev, eps_V);
 
-    KelvinMatrix tangentStiffness;
-
     PhysicalStressWithInvariants<DisplacementDim> s{mp.G * sigma};
     // Quit early if sigma is zero (nothing to do) or if we are still in elastic
     // zone.
@@ -629,7 +641,7 @@ SolidEhlers<DisplacementDim>::integrateStress(
 
             if (!success_iterations)
             {
-                return {};
+                return false;
             }
 
             // If the Newton loop didn't run, the linear solver will not be
@@ -680,15 +692,8 @@ SolidEhlers<DisplacementDim>::integrateStress(
         }
     }
 
-    KelvinVector sigma_final = mp.G * sigma;
-
-    return {std::make_tuple(
-        sigma_final,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new StateVariables<DisplacementDim>{
-                static_cast<StateVariables<DisplacementDim> const&>(state)}},
-        tangentStiffness)};
+    sigma_final.noalias() = mp.G * sigma;
+    return true;
 }
 
 template <int DisplacementDim>
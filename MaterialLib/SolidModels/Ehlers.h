@@ -23,6 +23,7 @@
 #endif
 
 #include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
 #include "MathLib/KelvinVector.h"
 #include "NumLib/NewtonRaphson.h"
 #include "ParameterLib/Parameter.h"
@@ -129,22 +130,22 @@ struct MaterialProperties final
 {
     MaterialProperties(double const t, ParameterLib::SpatialPosition const& x,
                        MaterialPropertiesParameters const& mp)
-        : G(mp.G(t, x)[0]),
-          K(mp.K(t, x)[0]),
-          alpha(mp.alpha(t, x)[0]),
-          beta(mp.beta(t, x)[0]),
-          gamma(mp.gamma(t, x)[0]),
-          delta(mp.delta(t, x)[0]),
-          epsilon(mp.epsilon(t, x)[0]),
-          m(mp.m(t, x)[0]),
-          alpha_p(mp.alpha_p(t, x)[0]),
-          beta_p(mp.beta_p(t, x)[0]),
-          gamma_p(mp.gamma_p(t, x)[0]),
-          delta_p(mp.delta_p(t, x)[0]),
-          epsilon_p(mp.epsilon_p(t, x)[0]),
-          m_p(mp.m_p(t, x)[0]),
-          kappa(mp.kappa(t, x)[0]),
-          hardening_coefficient(mp.hardening_coefficient(t, x)[0])
+        : G(mp.G.scalarValue(t, x)),
+          K(mp.K.scalarValue(t, x)),
+          alpha(mp.alpha.scalarValue(t, x)),
+          beta(mp.beta.scalarValue(t, x)),
+          gamma(mp.gamma.scalarValue(t, x)),
+          delta(mp.delta.scalarValue(t, x)),
+          epsilon(mp.epsilon.scalarValue(t, x)),
+          m(mp.m.scalarValue(t, x)),
+          alpha_p(mp.alpha_p.scalarValue(t, x)),
+          beta_p(mp.beta_p.scalarValue(t, x)),
+          gamma_p(mp.gamma_p.scalarValue(t, x)),
+          delta_p(mp.delta_p.scalarValue(t, x)),
+          epsilon_p(mp.epsilon_p.scalarValue(t, x)),
+          m_p(mp.m_p.scalarValue(t, x)),
+          kappa(mp.kappa.scalarValue(t, x)),
+          hardening_coefficient(mp.hardening_coefficient.scalarValue(t, x))
     {
     }
     double const G;
@@ -175,9 +176,9 @@ struct DamageProperties
     DamageProperties(double const t,
                      ParameterLib::SpatialPosition const& x,
                      DamagePropertiesParameters const& dp)
-        : alpha_d(dp.alpha_d(t, x)[0]),
-          beta_d(dp.beta_d(t, x)[0]),
-          h_d(dp.h_d(t, x)[0])
+        : alpha_d(dp.alpha_d.scalarValue(t, x)),
+          beta_d(dp.beta_d.scalarValue(t, x)),
+          h_d(dp.h_d.scalarValue(t, x))
     {
     }
     double const alpha_d;
@@ -233,6 +234,37 @@ struct StateVariables
         damage_prev = damage;
     }
 
+    void writeCheckpoint(std::ostream& os) const override
+    {
+        for (auto const* p : {&eps_p, &eps_p_prev})
+        {
+            BaseLib::writeArrayBinary(os, p->D.data(), p->D.size());
+            BaseLib::writeValueBinary(os, p->V);
+            BaseLib::writeValueBinary(os, p->eff);
+        }
+        for (auto const* d : {&damage, &damage_prev})
+        {
+            BaseLib::writeValueBinary(os, d->kappa_d());
+            BaseLib::writeValueBinary(os, d->value());
+        }
+    }
+
+    void readCheckpoint(std::istream& is) override
+    {
+        for (auto* p : {&eps_p, &eps_p_prev})
+        {
+            BaseLib::readArrayBinary(is, p->D.data(), p->D.size());
+            p->V = BaseLib::readBinaryValue<double>(is);
+            p->eff = BaseLib::readBinaryValue<double>(is);
+        }
+        for (auto* d : {&damage, &damage_prev})
+        {
+            auto const kappa_d = BaseLib::readBinaryValue<double>(is);
+            auto const value = BaseLib::readBinaryValue<double>(is);
+            *d = Damage{kappa_d, value};
+        }
+    }
+
     using KelvinVector =
         MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
 
@@ -321,6 +353,15 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, KelvinVector const& eps_prev,
+        KelvinVector const& eps, KelvinVector const& sigma_prev,
+        std::unique_ptr<typename MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>& material_state_variables,
+        double const T, KelvinVector& sigma_final,
+        KelvinMatrix& tangentStiffness) const override;
+
     std::vector<typename MechanicsBase<DisplacementDim>::InternalVariable>
     getInternalVariables() const override;
 
@@ -333,7 +374,7 @@ public:
     double getBulkModulus(double const t,
                           ParameterLib::SpatialPosition const& x) const override
     {
-        return _mp.K(t, x)[0];
+        return _mp.K.scalarValue(t, x);
     }
 
     DamageProperties evaluatedDamageProperties(
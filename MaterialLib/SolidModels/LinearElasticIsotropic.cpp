@@ -20,22 +20,31 @@ boost::optional<
                    DisplacementDim>::MaterialStateVariables>,
                typename MechanicsBase<DisplacementDim>::KelvinMatrix>>
 LinearElasticIsotropic<DisplacementDim>::integrateStress(
-    double const t, ParameterLib::SpatialPosition const& x, double const /*dt*/,
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
     KelvinVector const& eps_prev, KelvinVector const& eps,
     KelvinVector const& sigma_prev,
-    typename MechanicsBase<DisplacementDim>::
-        MaterialStateVariables const& /*material_state_variables*/,
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
+        material_state_variables,
     double const T) const
 {
-    KelvinMatrix C = getElasticTensor(t, x, T);
+    return this->template integrateStressOnCopiedState<
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables>(
+        t, x, dt, eps_prev, eps, sigma_prev, material_state_variables, T);
+}
 
-    KelvinVector sigma = sigma_prev + C * (eps - eps_prev);
+template <int DisplacementDim>
+bool LinearElasticIsotropic<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const /*dt*/,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    std::unique_ptr<typename MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>& /*material_state_variables*/,
+    double const T, KelvinVector& sigma, KelvinMatrix& C) const
+{
+    C = getElasticTensor(t, x, T);
 
-    return {std::make_tuple(
-        sigma,
-        std::make_unique<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>(),
-        C)};
+    sigma.noalias() = sigma_prev + C * (eps - eps_prev);
+    return true;
 }
 
 template <int DisplacementDim>
@@ -35,23 +35,24 @@ public:
         /// Lamé's first parameter.
         double lambda(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] * _poissons_ratio(t, x)[0] /
-                   (1 + _poissons_ratio(t, x)[0]) /
-                   (1 - 2 * _poissons_ratio(t, x)[0]);
+            return _youngs_modulus.scalarValue(t, x) *
+                   _poissons_ratio.scalarValue(t, x) /
+                   (1 + _poissons_ratio.scalarValue(t, x)) /
+                   (1 - 2 * _poissons_ratio.scalarValue(t, x));
         }
 
         /// Lamé's second parameter, the shear modulus.
         double mu(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] /
-                   (2 * (1 + _poissons_ratio(t, x)[0]));
+            return _youngs_modulus.scalarValue(t, x) /
+                   (2 * (1 + _poissons_ratio.scalarValue(t, x)));
         }
 
         /// the bulk modulus.
         double bulk_modulus(double const t, X const& x) const
         {
-            return _youngs_modulus(t, x)[0] /
-                   (3 * (1 - 2 * _poissons_ratio(t, x)[0]));
+            return _youngs_modulus.scalarValue(t, x) /
+                   (3 * (1 - 2 * _poissons_ratio.scalarValue(t, x)));
         }
 
     private:
@@ -98,6 +99,14 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, KelvinVector const& eps_prev,
+        KelvinVector const& eps, KelvinVector const& sigma_prev,
+        std::unique_ptr<typename MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>& material_state_variables,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const override;
+
     KelvinMatrix getElasticTensor(double const t,
                                   ParameterLib::SpatialPosition const& x,
                                   double const T) const;
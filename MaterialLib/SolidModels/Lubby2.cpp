@@ -77,14 +77,27 @@ Lubby2<DisplacementDim>::integrateStress(
     KelvinVector const& sigma_prev,
     typename MechanicsBase<DisplacementDim>::MaterialStateVariables const&
         material_state_variables,
-    double const /*T*/) const
+    double const T) const
+{
+    return this->template integrateStressOnCopiedState<MaterialStateVariables>(
+        t, x, dt, eps_prev, eps, sigma_prev, material_state_variables, T);
+}
+
+template <int DisplacementDim>
+bool Lubby2<DisplacementDim>::integrateStressInPlace(
+    double const t, ParameterLib::SpatialPosition const& x, double const dt,
+    KelvinVector const& eps_prev, KelvinVector const& eps,
+    KelvinVector const& sigma_prev,
+    std::unique_ptr<typename MechanicsBase<
+        DisplacementDim>::MaterialStateVariables>& material_state_variables,
+    double const /*T*/, KelvinVector& sigma, KelvinMatrix& C) const
 {
     using Invariants = MathLib::KelvinVector::Invariants<KelvinVectorSize>;
 
     assert(dynamic_cast<MaterialStateVariables const*>(
-               &material_state_variables) != nullptr);
-    MaterialStateVariables state(
-        static_cast<MaterialStateVariables const&>(material_state_variables));
+               material_state_variables.get()) != nullptr);
+    auto& state =
+        static_cast<MaterialStateVariables&>(*material_state_variables);
     state.setInitialConditions();
 
     auto local_lubby2_properties =
@@ -169,7 +182,7 @@ Lubby2<DisplacementDim>::integrateStress(
 
         if (!success_iterations)
         {
-            return {};
+            return false;
         }
 
         // If the Newton loop didn't run, the linear solver will not be
@@ -181,24 +194,18 @@ Lubby2<DisplacementDim>::integrateStress(
         }
     }
 
-    KelvinMatrix C =
-        tangentStiffnessA<DisplacementDim>(local_lubby2_properties.GM0,
+    C = tangentStiffnessA<DisplacementDim>(local_lubby2_properties.GM0,
                                            local_lubby2_properties.KM0,
                                            linear_solver);
 
     // Hydrostatic part for the stress and the tangent.
     double const delta_eps_trace = Invariants::trace(eps - eps_prev);
     double const sigma_trace_prev = Invariants::trace(sigma_prev);
-    KelvinVector const sigma = local_lubby2_properties.GM0 * sigd_j +
-                               (local_lubby2_properties.KM0 * delta_eps_trace +
-                                sigma_trace_prev / 3.) *
-                                   Invariants::identity2;
-    return {std::make_tuple(
-        sigma,
-        std::unique_ptr<
-            typename MechanicsBase<DisplacementDim>::MaterialStateVariables>{
-            new MaterialStateVariables{state}},
-        C)};
+    sigma.noalias() = local_lubby2_properties.GM0 * sigd_j +
+                      (local_lubby2_properties.KM0 * delta_eps_trace +
+                       sigma_trace_prev / 3.) *
+                          Invariants::identity2;
+    return true;
 }
 
 template <int DisplacementDim>
@@ -273,10 +280,12 @@ void Lubby2<DisplacementDim>::calculateJacobianBurgers(
             1. / (properties.etaK * properties.etaK) *
             (properties.GM0 * sig_i - 2. * properties.GK * eps_K_i);
 
-        KelvinVector const dG_K = 1.5 * _mp.mK(t, x)[0] * properties.GK *
-                                  properties.GM0 / s_eff * sig_i;
-        KelvinVector const dmu_vK = 1.5 * _mp.mvK(t, x)[0] * properties.GM0 *
-                                    properties.etaK / s_eff * sig_i;
+        KelvinVector const dG_K = 1.5 * _mp.mK.scalarValue(t, x) *
+                                  properties.GK * properties.GM0 / s_eff *
+                                  sig_i;
+        KelvinVector const dmu_vK = 1.5 * _mp.mvK.scalarValue(t, x) *
+                                    properties.GM0 * properties.etaK / s_eff *
+                                    sig_i;
         Jac.template block<KelvinVectorSize, KelvinVectorSize>(KelvinVectorSize,
                                                                0)
             .noalias() += 0.5 * dt * eps_K_aid * dmu_vK.transpose() +
@@ -298,8 +307,9 @@ void Lubby2<DisplacementDim>::calculateJacobianBurgers(
         -0.5 * dt * properties.GM0 / properties.etaM * KelvinMatrix::Identity();
     if (s_eff > 0.)
     {
-        KelvinVector const dmu_vM = 1.5 * _mp.mvM(t, x)[0] * properties.GM0 *
-                                    properties.etaM / s_eff * sig_i;
+        KelvinVector const dmu_vM = 1.5 * _mp.mvM.scalarValue(t, x) *
+                                    properties.GM0 * properties.etaM / s_eff *
+                                    sig_i;
         Jac.template block<KelvinVectorSize, KelvinVectorSize>(
                2 * KelvinVectorSize, 0)
             .noalias() += 0.5 * dt * properties.GM0 /
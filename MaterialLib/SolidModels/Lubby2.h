@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/FileTools.h"
 #include "MathLib/KelvinVector.h"
 #include "NumLib/NewtonRaphson.h"
 #include "ParameterLib/Parameter.h"
@@ -65,14 +66,14 @@ struct LocalLubby2Properties
     LocalLubby2Properties(double const t,
                           ParameterLib::SpatialPosition const& x,
                           Lubby2MaterialProperties const& mp)
-        : GM0(mp.GM0(t, x)[0]),
-          KM0(mp.KM0(t, x)[0]),
-          GK0(mp.GK0(t, x)[0]),
-          etaK0(mp.etaK0(t, x)[0]),
-          etaM0(mp.etaM0(t, x)[0]),
-          mK(mp.mK(t, x)[0]),
-          mvK(mp.mvK(t, x)[0]),
-          mvM(mp.mvM(t, x)[0])
+        : GM0(mp.GM0.scalarValue(t, x)),
+          KM0(mp.KM0.scalarValue(t, x)),
+          GK0(mp.GK0.scalarValue(t, x)),
+          etaK0(mp.etaK0.scalarValue(t, x)),
+          etaM0(mp.etaM0.scalarValue(t, x)),
+          mK(mp.mK.scalarValue(t, x)),
+          mvK(mp.mvK.scalarValue(t, x)),
+          mvM(mp.mvM.scalarValue(t, x))
     {
     }
 
@@ -130,6 +131,22 @@ public:
             eps_M_t = eps_M_j;
         }
 
+        void writeCheckpoint(std::ostream& os) const override
+        {
+            for (auto const* v : {&eps_K_t, &eps_K_j, &eps_M_t, &eps_M_j})
+            {
+                BaseLib::writeArrayBinary(os, v->data(), v->size());
+            }
+        }
+
+        void readCheckpoint(std::istream& is) override
+        {
+            for (auto* v : {&eps_K_t, &eps_K_j, &eps_M_t, &eps_M_j})
+            {
+                BaseLib::readArrayBinary(is, v->data(), v->size());
+            }
+        }
+
         using KelvinVector =
             MathLib::KelvinVector::KelvinVectorType<DisplacementDim>;
         using KelvinMatrix =
@@ -158,7 +175,7 @@ public:
     double getBulkModulus(double const t,
                           ParameterLib::SpatialPosition const& x) const override
     {
-        return _mp.KM0(t, x)[0];
+        return _mp.KM0.scalarValue(t, x);
     }
 
 public:
@@ -241,6 +258,14 @@ public:
             material_state_variables,
         double const T) const override;
 
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, KelvinVector const& eps_prev,
+        KelvinVector const& eps, KelvinVector const& sigma_prev,
+        std::unique_ptr<typename MechanicsBase<
+            DisplacementDim>::MaterialStateVariables>& material_state_variables,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const override;
+
 private:
     /// Calculates the 18x1 residual vector.
     void calculateResidualBurgers(
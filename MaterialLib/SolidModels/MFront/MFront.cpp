@@ -11,6 +11,8 @@
 
 #include <MGIS/Behaviour/Integrate.hxx>
 
+#include "BaseLib/FileTools.h"
+
 namespace
 {
 /// Converts between OGSes and MFront's Kelvin vector indices.
@@ -395,6 +397,32 @@ double MFront<DisplacementDim>::computeFreeEnergyDensity(
     return std::numeric_limits<double>::quiet_NaN();
 }
 
+template <int DisplacementDim>
+void MFront<DisplacementDim>::MaterialStateVariables::writeCheckpoint(
+    std::ostream& os) const
+{
+    for (auto const* state : {&_behaviour_data.s0, &_behaviour_data.s1})
+    {
+        auto const& isvs = state->internal_state_variables;
+        BaseLib::writeArrayBinary(os, isvs.data(), isvs.size());
+        BaseLib::writeValueBinary(os, state->stored_energy);
+        BaseLib::writeValueBinary(os, state->dissipated_energy);
+    }
+}
+
+template <int DisplacementDim>
+void MFront<DisplacementDim>::MaterialStateVariables::readCheckpoint(
+    std::istream& is)
+{
+    for (auto* state : {&_behaviour_data.s0, &_behaviour_data.s1})
+    {
+        auto& isvs = state->internal_state_variables;
+        BaseLib::readArrayBinary(is, isvs.data(), isvs.size());
+        state->stored_energy = BaseLib::readBinaryValue<double>(is);
+        state->dissipated_energy = BaseLib::readBinaryValue<double>(is);
+    }
+}
+
 template class MFront<2>;
 template class MFront<3>;
 
@@ -56,6 +56,9 @@ public:
             mgis::behaviour::update(_behaviour_data);
         }
 
+        void writeCheckpoint(std::ostream& os) const override;
+        void readCheckpoint(std::istream& is) override;
+
         mgis::behaviour::BehaviourData _behaviour_data;
     };
 
@@ -10,7 +10,9 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cassert>
 #include <functional>
+#include <iosfwd>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -58,6 +60,11 @@ struct MechanicsBase
     {
         virtual ~MaterialStateVariables() = default;
         virtual void pushBackState(){};
+
+        /// Writes the state as binary into \c os. Used for checkpointing.
+        virtual void writeCheckpoint(std::ostream& /*os*/) const {}
+        /// Restores the state written by writeCheckpoint().
+        virtual void readCheckpoint(std::istream& /*is*/) {}
     };
 
     /// Polymorphic creator for MaterialStateVariables objects specific for a
@@ -119,6 +126,60 @@ struct MechanicsBase
                     MaterialStateVariables const& material_state_variables,
                     double const T) const = 0;
 
+    /// Computation of the constitutive relation like integrateStress(), but
+    /// the stress, the tangent, and the material state variables are written
+    /// to objects owned by the caller, usually the integration point data.
+    /// The material models overriding this function update the state
+    /// variables in place and do not allocate memory. The default
+    /// implementation calls integrateStress() and replaces the state variables
+    /// object.
+    /// \c sigma must not be an alias of any of the input vectors.
+    /// Returns false in case of errors in the computation if Newton
+    /// iterations did not converge, for example.
+    virtual bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, KelvinVector const& eps_prev,
+        KelvinVector const& eps, KelvinVector const& sigma_prev,
+        std::unique_ptr<MaterialStateVariables>& material_state_variables,
+        double const T, KelvinVector& sigma, KelvinMatrix& C) const
+    {
+        auto&& solution = integrateStress(t, x, dt, eps_prev, eps, sigma_prev,
+                                          *material_state_variables, T);
+        if (!solution)
+        {
+            return false;
+        }
+        std::tie(sigma, material_state_variables, C) = std::move(*solution);
+        return true;
+    }
+
+    /// Dynamic size Kelvin vector and matrix wrapper for
+    /// integrateStressInPlace(). Once the outputs have the right size they
+    /// are not reallocated.
+    template <typename SigmaType, typename TangentType>
+    bool integrateStressInPlace(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt,
+        Eigen::Matrix<double, Eigen::Dynamic, 1> const& eps_prev,
+        Eigen::Matrix<double, Eigen::Dynamic, 1> const& eps,
+        Eigen::Matrix<double, Eigen::Dynamic, 1> const& sigma_prev,
+        std::unique_ptr<MaterialStateVariables>& material_state_variables,
+        double const T, Eigen::MatrixBase<SigmaType>& sigma,
+        Eigen::MatrixBase<TangentType>& C) const
+    {
+        KelvinVector sigma_;
+        KelvinMatrix C_;
+        if (!integrateStressInPlace(t, x, dt, KelvinVector{eps_prev},
+                                    KelvinVector{eps}, KelvinVector{sigma_prev},
+                                    material_state_variables, T, sigma_, C_))
+        {
+            return false;
+        }
+        sigma.derived() = sigma_;
+        C.derived() = C_;
+        return true;
+    }
+
     /// Helper type for providing access to internal variables.
     struct InternalVariable
     {
@@ -174,6 +235,36 @@ struct MechanicsBase
         MaterialStateVariables const& material_state_variables) const = 0;
 
     virtual ~MechanicsBase() = default;
+
+protected:
+    /// Implements integrateStress() for material models overriding
+    /// integrateStressInPlace() by applying the latter to a copy of the given
+    /// material state variables of type \c StateVariables.
+    template <typename StateVariables>
+    boost::optional<std::tuple<
+        KelvinVector, std::unique_ptr<MaterialStateVariables>, KelvinMatrix>>
+    integrateStressOnCopiedState(
+        double const t, ParameterLib::SpatialPosition const& x,
+        double const dt, KelvinVector const& eps_prev,
+        KelvinVector const& eps, KelvinVector const& sigma_prev,
+        MaterialStateVariables const& material_state_variables,
+        double const T) const
+    {
+        assert(dynamic_cast<StateVariables const*>(
+                   &material_state_variables) != nullptr);
+        std::unique_ptr<MaterialStateVariables> state =
+            std::make_unique<StateVariables>(
+                static_cast<StateVariables const&>(material_state_variables));
+
+        KelvinVector sigma;
+        KelvinMatrix C;
+        if (!integrateStressInPlace(t, x, dt, eps_prev, eps, sigma_prev, state,
+                                    T, sigma, C))
+        {
+            return {};
+        }
+        return {std::make_tuple(sigma, std::move(state), C)};
+    }
 };
 
 }  // namespace Solids
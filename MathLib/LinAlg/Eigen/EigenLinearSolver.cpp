@@ -10,6 +10,7 @@
 
 #include "EigenLinearSolver.h"
 
+#include <boost/functional/hash.hpp>
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -43,12 +44,60 @@ public:
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+
+    //! Returns whether a factorization of the matrix \f$ A \f$ of the last
+    //! successful solve() call is available.
+    virtual bool hasFactorization() const { return false; }
+
+    //! Solves \f$ A x = b \f$ for \f$ x \f$ with the factorization of the
+    //! matrix \f$ A \f$ of the last successful solve() call.
+    virtual bool solveWithFactorization(Vector const& /*b*/, Vector& /*x*/)
+    {
+        return false;
+    }
 };
 
 namespace details
 {
 
+/// Identifies the nonzero structure of a compressed sparse matrix.
+struct SparsityPatternFingerprint
+{
+    EigenMatrix::IndexType rows = -1;
+    EigenMatrix::IndexType cols = -1;
+    EigenMatrix::IndexType non_zeros = -1;
+    std::size_t hash = 0;
+
+    bool operator==(SparsityPatternFingerprint const& other) const
+    {
+        return rows == other.rows && cols == other.cols &&
+               non_zeros == other.non_zeros && hash == other.hash;
+    }
+    bool operator!=(SparsityPatternFingerprint const& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+SparsityPatternFingerprint computeFingerprint(
+    EigenMatrix::RawMatrixType const& A)
+{
+    assert(A.isCompressed());
+    SparsityPatternFingerprint fingerprint;
+    fingerprint.rows = A.rows();
+    fingerprint.cols = A.cols();
+    fingerprint.non_zeros = A.nonZeros();
+    fingerprint.hash =
+        boost::hash_range(A.outerIndexPtr(), A.outerIndexPtr() + A.outerSize());
+    boost::hash_range(fingerprint.hash, A.innerIndexPtr(),
+                      A.innerIndexPtr() + A.nonZeros());
+    return fingerprint;
+}
+
 /// Template class for Eigen direct linear solvers
+///
+/// The symbolic analysis, e.g. the fill-in reducing ordering, is only redone if
+/// the sparsity pattern of the matrix has changed since the last solve() call.
 template <class T_SOLVER>
 class EigenDirectLinearSolver final : public EigenLinearSolverBase
 {
@@ -61,13 +110,32 @@ public:
         {
             A.makeCompressed();
         }
+        _has_factorization = false;
 
-        _solver.compute(A);
+        auto const fingerprint = computeFingerprint(A);
+        if (fingerprint != _fingerprint)
+        {
+            DBUG("-> analyze the sparsity pattern");
+            _solver.analyzePattern(A);
+            _fingerprint = fingerprint;
+        }
+
+        _solver.factorize(A);
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solver initialization");
+            // Redo the analysis next time.
+            _fingerprint = SparsityPatternFingerprint{};
             return false;
         }
+        _has_factorization = true;
+
+        return solveWithFactorization(b, x);
+    }
 
+    bool hasFactorization() const override { return _has_factorization; }
+
+    bool solveWithFactorization(Vector const& b, Vector& x) override
+    {
         x = _solver.solve(b);
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solve");
@@ -79,6 +147,8 @@ public:
 
 private:
     T_SOLVER _solver;
+    SparsityPatternFingerprint _fingerprint;
+    bool _has_factorization = false;
 };
 
 /// Template class for Eigen iterative linear solvers
@@ -283,8 +353,13 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
         b.getRawVector() = scal->LeftScaling().cwiseProduct(b.getRawVector());
     }
 #endif
+    auto option = _option;
+    if (_tolerance_override)
+    {
+        option.error_tolerance = *_tolerance_override;
+    }
     auto const success = _solver->solve(A.getRawMatrix(), b.getRawVector(),
-                                        x.getRawVector(), _option);
+                                        x.getRawVector(), option);
 #ifdef USE_EIGEN_UNSUPPORTED
     if (scal)
     {
@@ -297,4 +372,30 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
     return success;
 }
 
+bool EigenLinearSolver::canSolveWithPreviousFactorization() const
+{
+#ifdef USE_EIGEN_UNSUPPORTED
+    // The scaling would change the matrix; it is not stored for reuse.
+    if (_option.scaling)
+    {
+        return false;
+    }
+#endif
+    return _solver->hasFactorization();
+}
+
+bool EigenLinearSolver::solveWithPreviousFactorization(EigenVector& b,
+                                                       EigenVector& x)
+{
+    INFO("------------------------------------------------------------------");
+    INFO("*** Eigen solver computation with the previous factorization");
+
+    auto const success =
+        _solver->solveWithFactorization(b.getRawVector(), x.getRawVector());
+
+    INFO("------------------------------------------------------------------");
+
+    return success;
+}
+
 }  // namespace MathLib
@@ -12,6 +12,8 @@
 
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "BaseLib/ConfigTree.h"
 #include "EigenOption.h"
 
@@ -56,8 +58,28 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Returns whether solveWithPreviousFactorization() can be called, i.e.,
+    /// a direct solver is used and its factorization of the matrix from the
+    /// last successful solve() call is available.
+    bool canSolveWithPreviousFactorization() const;
+
+    /// Solves \f$ A x = b \f$ with the factorization of the matrix \f$ A \f$
+    /// computed in the last successful solve() call.
+    bool solveWithPreviousFactorization(EigenVector& b, EigenVector& x);
+
+    /// Sets the error tolerance of iterative solvers for subsequent solve()
+    /// calls, overriding the configured one.
+    void setTolerance(double const tolerance)
+    {
+        _tolerance_override = tolerance;
+    }
+
+    /// Restores the configured error tolerance.
+    void resetTolerance() { _tolerance_override.reset(); }
+
 protected:
     EigenOption _option;
+    boost::optional<double> _tolerance_override;
     std::unique_ptr<EigenLinearSolverBase> _solver;
 };
 
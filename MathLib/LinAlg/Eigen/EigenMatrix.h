@@ -10,13 +10,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <Eigen/Sparse>
 
 #include "MathLib/LinAlg/RowColumnIndices.h"
 #include "MathLib/LinAlg/SetMatrixSparsity.h"
+#include "MathLib/LinAlg/SparsityPattern.h"
 #include "EigenVector.h"
 
 namespace MathLib
@@ -110,6 +113,20 @@ public:
         this->add(indices.rows, indices.columns, sub_matrix, fkt);
     }
 
+    /// Add sub-matrix at positions given by \c indices for the assembly item
+    /// \c item_id, e.g. a mesh element.
+    ///
+    /// Once the matrix is compressed, the offsets of the sub-matrix entries in
+    /// the value array are computed on the first call for each item and
+    /// cached. Subsequent calls with the same indices add the values at the
+    /// cached offsets without searching the sparsity pattern. The cache is
+    /// dropped whenever the sparsity pattern changes. If an entry does not
+    /// exist, the value is inserted like in the other add() methods.
+    template <class T_DENSE_MATRIX>
+    void add(std::size_t const item_id,
+             RowColumnIndices<IndexType> const& indices,
+             const T_DENSE_MATRIX& sub_matrix);
+
     /// Add sub-matrix at positions \c row_pos and \c col_pos. If the entries doesn't
     /// exist in the matrix, the values are inserted.
     /// @param row_pos     a vector of row position indices. The vector size should
@@ -177,8 +194,168 @@ public:
 
 protected:
     RawMatrixType _mat;
+
+private:
+    /// Offsets of the entries of a sub-matrix in the value array of the
+    /// compressed matrix, stored row by row, and the indices they are valid
+    /// for.
+    struct ScatterCacheEntry
+    {
+        std::vector<IndexType> rows;
+        std::vector<IndexType> columns;
+        std::vector<RawMatrixType::StorageIndex> offsets;
+    };
+
+    /// Per-item cache used by add(item_id, indices, sub_matrix).
+    ///
+    /// The cache is not copied along with the matrix, because copies of the
+    /// matrix are usually not assembled.
+    struct ScatterCache
+    {
+        ScatterCache() = default;
+        ScatterCache(ScatterCache const& /*other*/) {}
+        ScatterCache& operator=(ScatterCache const& /*other*/)
+        {
+            entries.clear();
+            number_of_nonzeros = -1;
+            return *this;
+        }
+
+        std::vector<ScatterCacheEntry> entries;
+        /// Number of non-zeros of the matrix the cached offsets are valid for.
+        IndexType number_of_nonzeros = -1;
+    };
+
+    /// Computes the value offsets of all entries in the sub-matrix given by
+    /// \c indices. Returns false if some entry is not in the sparsity pattern
+    /// of the compressed matrix.
+    bool computeValueOffsets(RowColumnIndices<IndexType> const& indices,
+                             ScatterCacheEntry& entry) const
+    {
+        auto const* const outer = _mat.outerIndexPtr();
+        auto const* const inner = _mat.innerIndexPtr();
+        auto const n_cols = indices.columns.size();
+
+        entry.offsets.clear();
+        entry.offsets.reserve(indices.rows.size() * n_cols);
+        for (auto const row : indices.rows)
+        {
+            auto const* const row_begin = inner + outer[row];
+            auto const* const row_end = inner + outer[row + 1];
+            for (auto const col : indices.columns)
+            {
+                auto const* const it =
+                    std::lower_bound(row_begin, row_end, col);
+                if (it == row_end || *it != col)
+                {
+                    return false;
+                }
+                entry.offsets.push_back(
+                    static_cast<RawMatrixType::StorageIndex>(it - inner));
+            }
+        }
+
+        entry.rows = indices.rows;
+        entry.columns = indices.columns;
+        return true;
+    }
+
+    ScatterCache _scatter_cache;
+
+    /// Positions of the off-diagonal entries in the columns of the known
+    /// solution entries, which are eliminated by applyKnownSolution(). With
+    /// these, the columns are accessed without transposing the row-major
+    /// matrix.
+    ///
+    /// The cache is valid for one set of known solution ids and one sparsity
+    /// pattern. Like the scatter cache it is not copied along with the matrix.
+    struct KnownSolutionCache
+    {
+        KnownSolutionCache() = default;
+        KnownSolutionCache(KnownSolutionCache const& /*other*/) {}
+        KnownSolutionCache& operator=(KnownSolutionCache const& /*other*/)
+        {
+            *this = KnownSolutionCache{};
+            return *this;
+        }
+        KnownSolutionCache(KnownSolutionCache&&) = default;
+        KnownSolutionCache& operator=(KnownSolutionCache&&) = default;
+
+        /// The known solution ids and the sparsity pattern, i.e. the row
+        /// offsets and the column indices of the compressed matrix, the
+        /// cache is valid for.
+        std::vector<IndexType> known_ids;
+        std::vector<RawMatrixType::StorageIndex> outer_index;
+        std::vector<RawMatrixType::StorageIndex> inner_index;
+
+        /// The entries of column \c known_ids[i] are stored in the range
+        /// [column_begin[i], column_begin[i+1]) of \c value_offsets and
+        /// \c rows.
+        std::vector<std::size_t> column_begin;
+        std::vector<RawMatrixType::StorageIndex> value_offsets;
+        std::vector<IndexType> rows;
+        /// Offset of the diagonal entry of each known id or -1 if the entry
+        /// is not in the sparsity pattern.
+        std::vector<IndexType> diagonal_offsets;
+    };
+
+    KnownSolutionCache _known_solution_cache;
+
+    friend void applyKnownSolution(
+        EigenMatrix& A, EigenVector& b, EigenVector& x,
+        std::vector<IndexType> const& vec_knownX_id,
+        std::vector<double> const& vec_knownX_x, double penalty_scaling);
 };
 
+template <class T_DENSE_MATRIX>
+void EigenMatrix::add(std::size_t const item_id,
+                      RowColumnIndices<IndexType> const& indices,
+                      const T_DENSE_MATRIX& sub_matrix)
+{
+    // Inserting entries might change the sparsity pattern. Only the compressed
+    // storage has stable offsets.
+    if (!_mat.isCompressed())
+    {
+        _scatter_cache.entries.clear();
+        add(indices.rows, indices.columns, sub_matrix);
+        return;
+    }
+
+    if (_scatter_cache.number_of_nonzeros != _mat.nonZeros())
+    {
+        _scatter_cache.entries.clear();
+        _scatter_cache.number_of_nonzeros = _mat.nonZeros();
+    }
+
+    if (item_id >= _scatter_cache.entries.size())
+    {
+        _scatter_cache.entries.resize(item_id + 1);
+    }
+    auto& entry = _scatter_cache.entries[item_id];
+
+    if (entry.rows != indices.rows || entry.columns != indices.columns)
+    {
+        if (!computeValueOffsets(indices, entry))
+        {
+            entry = {};
+            add(indices.rows, indices.columns, sub_matrix);
+            return;
+        }
+    }
+
+    auto* const values = _mat.valuePtr();
+    auto const n_rows = indices.rows.size();
+    auto const n_cols = indices.columns.size();
+    auto const* offset = entry.offsets.data();
+    for (auto i = decltype(n_rows){0}; i < n_rows; i++)
+    {
+        for (auto j = decltype(n_cols){0}; j < n_cols; j++)
+        {
+            values[*offset++] += sub_matrix(i, j);
+        }
+    }
+}
+
 template <class T_DENSE_MATRIX>
 void EigenMatrix::add(std::vector<IndexType> const& row_pos,
                       std::vector<IndexType> const& col_pos,
@@ -215,4 +392,44 @@ void operator()(EigenMatrix &matrix, SPARSITY_PATTERN const& sparsity_pattern)
 }
 };
 
+/// Allocates the underlying EigenMatrix in compressed form with exactly the
+/// entries of the given pattern. All values are set to zero.
+///
+/// Subsequent additions to entries of the pattern are done in place; no
+/// insertions and no reallocations take place during the assembly.
+template <typename IndexType>
+struct SetMatrixSparsity<EigenMatrix, CompressedSparsityPattern<IndexType>>
+{
+void operator()(EigenMatrix& matrix,
+                CompressedSparsityPattern<IndexType> const& sparsity_pattern)
+{
+    static_assert(EigenMatrix::RawMatrixType::IsRowMajor,
+                  "Set matrix sparsity relies on the EigenMatrix to be in "
+                  "row-major storage order.");
+
+    using StorageIndex = EigenMatrix::RawMatrixType::StorageIndex;
+
+    auto& mat = matrix.getRawMatrix();
+    assert(static_cast<std::size_t>(mat.rows()) ==
+           sparsity_pattern.getNumberOfRows());
+
+    // Resizing makes the matrix empty and compressed.
+    mat.resize(mat.rows(), mat.cols());
+    mat.resizeNonZeros(
+        static_cast<EigenMatrix::IndexType>(
+            sparsity_pattern.column_indices.size()));
+
+    auto const to_storage_index = [](IndexType const i) {
+        return static_cast<StorageIndex>(i);
+    };
+    std::transform(sparsity_pattern.row_offsets.begin(),
+                   sparsity_pattern.row_offsets.end(), mat.outerIndexPtr(),
+                   to_storage_index);
+    std::transform(sparsity_pattern.column_indices.begin(),
+                   sparsity_pattern.column_indices.end(), mat.innerIndexPtr(),
+                   to_storage_index);
+    std::fill_n(mat.valuePtr(), sparsity_pattern.column_indices.size(), 0.0);
+}
+};
+
 } // end namespace MathLib
@@ -10,10 +10,38 @@
 
 #include "EigenTools.h"
 
+#include <algorithm>
+#include <cstddef>
+
 #include <logog/include/logog.hpp>
 
 #include "EigenVector.h"
 
+namespace
+{
+using SpMat = MathLib::EigenMatrix::RawMatrixType;
+
+bool isKnownSolutionCacheValid(
+    std::vector<MathLib::EigenMatrix::IndexType> const& cached_ids,
+    std::vector<SpMat::StorageIndex> const& cached_outer_index,
+    std::vector<SpMat::StorageIndex> const& cached_inner_index,
+    std::vector<MathLib::EigenMatrix::IndexType> const& known_ids,
+    SpMat const& A)
+{
+    // The row sizes alone do not determine the pattern; the column indices
+    // are compared as well.
+    return cached_ids == known_ids &&
+           cached_outer_index.size() ==
+               static_cast<std::size_t>(A.rows() + 1) &&
+           std::equal(cached_outer_index.begin(), cached_outer_index.end(),
+                      A.outerIndexPtr()) &&
+           cached_inner_index.size() ==
+               static_cast<std::size_t>(A.nonZeros()) &&
+           std::equal(cached_inner_index.begin(), cached_inner_index.end(),
+                      A.innerIndexPtr());
+}
+}  // namespace
+
 namespace MathLib
 {
 
@@ -21,12 +49,90 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
         const std::vector<EigenMatrix::IndexType> &vec_knownX_id,
         const std::vector<double> &vec_knownX_x, double /*penalty_scaling*/)
 {
-    using SpMat = EigenMatrix::RawMatrixType;
     static_assert(SpMat::IsRowMajor, "matrix is assumed to be row major!");
 
     auto &A = A_.getRawMatrix();
     auto &b = b_.getRawVector();
 
+    // The cached offsets refer to the compressed storage.
+    A.makeCompressed();
+
+    auto& cache = A_._known_solution_cache;
+    if (!isKnownSolutionCacheValid(cache.known_ids, cache.outer_index,
+                                   cache.inner_index, vec_knownX_id, A))
+    {
+        // Position of each column in the list of known ids. If an id is given
+        // several times, its column is eliminated at the first occurrence.
+        std::vector<std::ptrdiff_t> known_position(A.cols(), -1);
+        for (auto ix = vec_knownX_id.size(); ix-- > 0;)
+        {
+            known_position[vec_knownX_id[ix]] = ix;
+        }
+
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        auto const n_known = vec_knownX_id.size();
+
+        // Count the off-diagonal entries per known column, then fill.
+        cache.column_begin.assign(n_known + 1, 0);
+        cache.diagonal_offsets.assign(n_known, -1);
+        for (SpMat::Index row = 0; row < A.rows(); row++)
+        {
+            for (auto k = outer[row]; k < outer[row + 1]; k++)
+            {
+                auto const ix = known_position[inner[k]];
+                if (ix < 0)
+                {
+                    continue;
+                }
+                if (inner[k] == row)
+                {
+                    cache.diagonal_offsets[ix] = k;
+                }
+                else
+                {
+                    cache.column_begin[ix + 1]++;
+                }
+            }
+        }
+        for (std::size_t ix = 0; ix < n_known; ix++)
+        {
+            cache.column_begin[ix + 1] += cache.column_begin[ix];
+        }
+
+        cache.value_offsets.resize(cache.column_begin.back());
+        cache.rows.resize(cache.column_begin.back());
+        std::vector<std::size_t> fill(cache.column_begin.begin(),
+                                      cache.column_begin.end() - 1);
+        for (SpMat::Index row = 0; row < A.rows(); row++)
+        {
+            for (auto k = outer[row]; k < outer[row + 1]; k++)
+            {
+                auto const ix = known_position[inner[k]];
+                if (ix < 0 || inner[k] == row)
+                {
+                    continue;
+                }
+                cache.value_offsets[fill[ix]] = k;
+                cache.rows[fill[ix]] = row;
+                fill[ix]++;
+            }
+        }
+
+        // Later occurrences of duplicate ids only set the diagonal entry.
+        for (std::size_t ix = 0; ix < n_known; ix++)
+        {
+            auto const first = known_position[vec_knownX_id[ix]];
+            cache.diagonal_offsets[ix] = cache.diagonal_offsets[first];
+        }
+
+        cache.known_ids = vec_knownX_id;
+        cache.outer_index.assign(outer, outer + A.rows() + 1);
+        cache.inner_index.assign(inner, inner + A.nonZeros());
+    }
+
+    auto* const values = A.valuePtr();
+
     // A(k, j) = 0.
     // set row to zero
     for (auto row_id : vec_knownX_id)
@@ -39,8 +145,7 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
         }
     }
 
-    SpMat AT = A.transpose();
-
+    bool missing_diagonal = false;
     for (std::size_t ix=0; ix<vec_knownX_id.size(); ix++)
     {
         SpMat::Index const row_id = vec_knownX_id[ix];
@@ -48,27 +153,46 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
 
         // b_i -= A(i,k)*val, i!=k
         // set column to zero, subtract from rhs
-        for (SpMat::InnerIterator it(AT, row_id); it; ++it)
+        for (auto k = cache.column_begin[ix]; k < cache.column_begin[ix + 1];
+             k++)
         {
-            if (it.col() == row_id)
-            {
-                continue;
-            }
-
-            b[it.col()] -= it.value()*x;
-            it.valueRef() = 0.0;
+            auto& value = values[cache.value_offsets[k]];
+            b[cache.rows[k]] -= value * x;
+            value = 0.0;
         }
 
-        auto& c = AT.coeffRef(row_id, row_id);
-        if (c != 0.0) {
-            b[row_id] = x * c;
-        } else {
+        auto const diagonal_offset = cache.diagonal_offsets[ix];
+        if (diagonal_offset >= 0 && values[diagonal_offset] != 0.0)
+        {
+            b[row_id] = x * values[diagonal_offset];
+        }
+        else
+        {
             b[row_id] = x;
-            c = 1.0;
+            if (diagonal_offset >= 0)
+            {
+                values[diagonal_offset] = 1.0;
+            }
+            else
+            {
+                missing_diagonal = true;
+            }
         }
     }
 
-    A = AT.transpose();
+    // Inserting the diagonal entries changes the sparsity pattern, which
+    // invalidates the cache on the next call.
+    if (missing_diagonal)
+    {
+        for (auto const row_id : vec_knownX_id)
+        {
+            if (A.coeff(row_id, row_id) == 0.0)
+            {
+                A.coeffRef(row_id, row_id) = 1.0;
+            }
+        }
+        A.makeCompressed();
+    }
 }
 
 }  // namespace MathLib
@@ -10,6 +10,8 @@
 
 #include "EigenLisLinearSolver.h"
 
+#include <cstdio>
+
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -51,7 +53,20 @@ bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
     LisVector lisx(x.rows(), x.data());
 
     LisLinearSolver lissol; // TODO not always creat Lis solver here
-    lissol.setOption(_lis_option);
+    if (_tolerance_override)
+    {
+        // Options given later take precedence in Lis.
+        auto lis_option = _lis_option;
+        char tolerance[32];
+        std::snprintf(tolerance, sizeof(tolerance), " -tol %g",
+                      *_tolerance_override);
+        lis_option._option_string += tolerance;
+        lissol.setOption(lis_option);
+    }
+    else
+    {
+        lissol.setOption(_lis_option);
+    }
     bool const status = lissol.solve(lisA, lisb, lisx);
 
     for (std::size_t i=0; i<lisx.size(); i++)
@@ -12,6 +12,8 @@
 
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include <lis.h>
 
 #include "BaseLib/ConfigTree.h"
@@ -47,8 +49,28 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Reusing a factorization is not supported by this solver.
+    bool canSolveWithPreviousFactorization() const { return false; }
+
+    /// Not supported, always returns false.
+    bool solveWithPreviousFactorization(EigenVector& /*b*/, EigenVector& /*x*/)
+    {
+        return false;
+    }
+
+    /// Sets the convergence tolerance (Lis option \c -tol) for subsequent
+    /// solve() calls, overriding the configured one.
+    void setTolerance(double const tolerance)
+    {
+        _tolerance_override = tolerance;
+    }
+
+    /// Restores the configured convergence tolerance.
+    void resetTolerance() { _tolerance_override.reset(); }
+
 private:
     LisOption _lis_option;
+    boost::optional<double> _tolerance_override;
 };
 
 } // MathLib
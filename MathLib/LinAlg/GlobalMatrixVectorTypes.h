@@ -62,3 +62,5 @@ static_assert(std::is_same<GlobalMatrix::IndexType,
 using GlobalIndexType = GlobalMatrix::IndexType;
 
 using GlobalSparsityPattern = MathLib::SparsityPattern<GlobalIndexType>;
+using GlobalCompressedSparsityPattern =
+    MathLib::CompressedSparsityPattern<GlobalIndexType>;
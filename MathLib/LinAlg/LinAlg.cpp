@@ -10,6 +10,12 @@
 
 #include "LinAlg.h"
 
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include "BaseLib/FileTools.h"
+
 // TODO reorder LinAlg function signatures?
 
 // Global PETScMatrix/PETScVector //////////////////////////////////////////
@@ -65,6 +71,34 @@ void axpby(PETScVector& y, double const a, double const b, PETScVector const& x)
     VecAXPBY(y.getRawVector(), a, b, x.getRawVector());
 }
 
+void writeBinary(std::ostream& os, PETScVector const& x)
+{
+    PetscScalar const* values;
+    VecGetArrayRead(x.getRawVector(), &values);
+    auto const n = static_cast<std::int64_t>(x.getLocalSize());
+    BaseLib::writeValueBinary(os, n);
+    BaseLib::writeArrayBinary(os, values, n);
+    VecRestoreArrayRead(x.getRawVector(), &values);
+}
+
+void readBinary(std::istream& is, PETScVector& x)
+{
+    auto const n = BaseLib::readBinaryValue<std::int64_t>(is);
+    if (!is || n != static_cast<std::int64_t>(x.getLocalSize()))
+    {
+        OGS_FATAL(
+            "Could not read a vector with %ld local entries; the stored "
+            "vector has %ld local entries.",
+            static_cast<long>(x.getLocalSize()), static_cast<long>(n));
+    }
+
+    PetscScalar* values;
+    VecGetArray(x.getRawVector(), &values);
+    BaseLib::readArrayBinary(is, values, n);
+    VecRestoreArray(x.getRawVector(), &values);
+    x.finalizeAssembly();
+}
+
 // Explicit specialization
 // Computes w = x/y componentwise.
 template<>
@@ -223,6 +257,26 @@ void axpby(EigenVector& y, double const a, double const b, EigenVector const& x)
     y.getRawVector() = a * x.getRawVector() + b * y.getRawVector();
 }
 
+void writeBinary(std::ostream& os, EigenVector const& x)
+{
+    auto const n = static_cast<std::int64_t>(x.size());
+    BaseLib::writeValueBinary(os, n);
+    BaseLib::writeArrayBinary(os, x.getRawVector().data(), n);
+}
+
+void readBinary(std::istream& is, EigenVector& x)
+{
+    auto const n = BaseLib::readBinaryValue<std::int64_t>(is);
+    if (!is || n != static_cast<std::int64_t>(x.size()))
+    {
+        OGS_FATAL(
+            "Could not read a vector with %ld entries; the stored vector has "
+            "%ld entries.",
+            static_cast<long>(x.size()), static_cast<long>(n));
+    }
+    BaseLib::readArrayBinary(is, x.getRawVector().data(), n);
+}
+
 // Explicit specialization
 // Computes w = x/y componentwise.
 template<>
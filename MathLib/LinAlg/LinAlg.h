@@ -11,6 +11,7 @@
 #pragma once
 
 #include <cassert>
+#include <iosfwd>
 #include "BaseLib/Error.h"
 #include "LinAlgEnums.h"
 
@@ -165,6 +166,13 @@ void axpy(PETScVector& y, double const a, PETScVector const& x);
 // y = a*x + y
 void axpby(PETScVector& y, double const a, double const b, PETScVector const& x);
 
+/// Writes the locally owned entries of \c x as binary into \c os.
+void writeBinary(std::ostream& os, PETScVector const& x);
+
+/// Reads the locally owned entries of \c x written by writeBinary() from
+/// \c is. The local size of \c x must match the stored one.
+void readBinary(std::istream& is, PETScVector& x);
+
 
 // Matrix
 
@@ -233,6 +241,13 @@ void axpy(EigenVector& y, double const a, EigenVector const& x);
 // y = a*x + y
 void axpby(EigenVector& y, double const a, double const b, EigenVector const& x);
 
+/// Writes the entries of \c x as binary into \c os.
+void writeBinary(std::ostream& os, EigenVector const& x);
+
+/// Reads the entries of \c x written by writeBinary() from \c is. The size
+/// of \c x must match the stored one.
+void readBinary(std::istream& is, EigenVector& x);
+
 
 // Matrix
 
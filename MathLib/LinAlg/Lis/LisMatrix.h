@@ -21,6 +21,7 @@
 
 #include "MathLib/LinAlg/RowColumnIndices.h"
 #include "MathLib/LinAlg/SetMatrixSparsity.h"
+#include "MathLib/LinAlg/SparsityPattern.h"
 
 #include "LisOption.h"
 #include "LisCheck.h"
@@ -204,5 +205,17 @@ void operator()(LisMatrix &matrix, SPARSITY_PATTERN const& sparsity_pattern)
 }
 };
 
+/// Sets the sparsity pattern of the underlying LisMatrix from the exact row
+/// sizes of the given compressed pattern.
+template <typename IndexType>
+struct SetMatrixSparsity<LisMatrix, CompressedSparsityPattern<IndexType>>
+{
+void operator()(LisMatrix& matrix,
+                CompressedSparsityPattern<IndexType> const& sparsity_pattern)
+{
+    setMatrixSparsity(matrix, getRowSizes(sparsity_pattern));
+}
+};
+
 
 } // MathLib
@@ -19,9 +19,12 @@ struct MatrixSpecifications
 {
     MatrixSpecifications(std::size_t const nrows_, std::size_t const ncols_,
                          std::vector<GlobalIndexType> const*const ghost_indices_,
-                         GlobalSparsityPattern const*const sparsity_pattern_)
+                         GlobalSparsityPattern const*const sparsity_pattern_,
+                         GlobalCompressedSparsityPattern const* const
+                             compressed_sparsity_pattern_ = nullptr)
         : nrows(nrows_), ncols(ncols_), ghost_indices(ghost_indices_)
         , sparsity_pattern(sparsity_pattern_)
+        , compressed_sparsity_pattern(compressed_sparsity_pattern_)
     {
     }
 
@@ -29,6 +32,10 @@ struct MatrixSpecifications
     std::size_t const ncols;
     std::vector<GlobalIndexType> const*const ghost_indices;
     GlobalSparsityPattern const*const sparsity_pattern;
+    /// Optional complete nonzero structure. If given, matrix types supporting
+    /// it are allocated with exactly these entries instead of reserving
+    /// \c sparsity_pattern entries per row.
+    GlobalCompressedSparsityPattern const* const compressed_sparsity_pattern;
 };
 
 } // namespace MathLib
@@ -110,7 +110,11 @@ newInstance(MatrixSpecifications const& spec)
 {
     auto A = std::make_unique<EigenMatrix>(spec.nrows);
 
-    if (spec.sparsity_pattern)
+    if (spec.compressed_sparsity_pattern)
+    {
+        setMatrixSparsity(*A, *spec.compressed_sparsity_pattern);
+    }
+    else if (spec.sparsity_pattern)
     {
         setMatrixSparsity(*A, *spec.sparsity_pattern);
     }
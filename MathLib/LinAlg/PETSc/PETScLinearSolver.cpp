@@ -72,6 +72,29 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
     KSPSetFromOptions(_solver);  // set run-time options
 }
 
+void PETScLinearSolver::setTolerance(double const tolerance)
+{
+    if (!_configured_rtol)
+    {
+        PetscReal rtol;
+        KSPGetTolerances(_solver, &rtol, nullptr, nullptr, nullptr);
+        _configured_rtol = rtol;
+    }
+    KSPSetTolerances(_solver, tolerance, PETSC_DEFAULT, PETSC_DEFAULT,
+                     PETSC_DEFAULT);
+}
+
+void PETScLinearSolver::resetTolerance()
+{
+    if (!_configured_rtol)
+    {
+        return;
+    }
+    KSPSetTolerances(_solver, *_configured_rtol, PETSC_DEFAULT, PETSC_DEFAULT,
+                     PETSC_DEFAULT);
+    _configured_rtol.reset();
+}
+
 bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
 {
     BaseLib::RunTime wtimer;
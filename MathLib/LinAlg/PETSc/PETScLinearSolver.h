@@ -20,6 +20,8 @@
 
 #include <petscksp.h>
 
+#include <boost/optional.hpp>
+
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
@@ -54,6 +56,23 @@ public:
     // TODO check if some args in LinearSolver interface can be made const&.
     bool solve(PETScMatrix& A, PETScVector& b, PETScVector& x);
 
+    /// Reusing a factorization is not supported by this solver.
+    bool canSolveWithPreviousFactorization() const { return false; }
+
+    /// Not supported, always returns false.
+    bool solveWithPreviousFactorization(PETScVector& /*b*/,
+                                        PETScVector& /*x*/)
+    {
+        return false;
+    }
+
+    /// Sets the relative tolerance of the KSP solver for subsequent solve()
+    /// calls, overriding the configured one.
+    void setTolerance(double const tolerance);
+
+    /// Restores the configured relative tolerance.
+    void resetTolerance();
+
     /// Get number of iterations.
     PetscInt getNumberOfIterations() const
     {
@@ -69,6 +88,9 @@ private:
     PC _pc;       ///< Preconditioner type.
 
     double _elapsed_ctime = 0.0;  ///< Clock time
+
+    /// Configured relative tolerance, stored while it is overridden.
+    boost::optional<PetscReal> _configured_rtol;
 };
 
 }  // end namespace
@@ -165,6 +165,16 @@ public:
         add(indices.rows, cols, sub_matrix);
     }
 
+    /// Same as add(indices, sub_matrix). The assembly item \c item_id is
+    /// ignored; PETSc keeps track of the insertion positions itself.
+    template <class T_DENSE_MATRIX>
+    void add(std::size_t const /*item_id*/,
+             RowColumnIndices<PetscInt> const& indices,
+             const T_DENSE_MATRIX& sub_matrix)
+    {
+        add(indices, sub_matrix);
+    }
+
     /*!
         \brief          Add a dense sub-matrix to a PETSc matrix.
         \param row_pos  The global indices of the rows of the dense sub-matrix.
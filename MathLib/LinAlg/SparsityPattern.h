@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 namespace MathLib
@@ -17,4 +18,37 @@ namespace MathLib
 /// A vector telling how many nonzeros there are in each global matrix row.
 template <typename IndexType>
 using SparsityPattern = std::vector<IndexType>;
+
+/// The complete nonzero structure of a global matrix in compressed row storage
+/// (CSR) format.
+///
+/// The column indices of row \c i are stored in ascending order in
+/// \c column_indices[row_offsets[i]] ... \c column_indices[row_offsets[i+1]-1].
+template <typename IndexType>
+struct CompressedSparsityPattern
+{
+    std::vector<IndexType> row_offsets;
+    std::vector<IndexType> column_indices;
+
+    std::size_t getNumberOfRows() const
+    {
+        return row_offsets.empty() ? 0 : row_offsets.size() - 1;
+    }
+};
+
+/// Returns the number of nonzeros in each row of the given compressed sparsity
+/// pattern.
+template <typename IndexType>
+SparsityPattern<IndexType> getRowSizes(
+    CompressedSparsityPattern<IndexType> const& pattern)
+{
+    SparsityPattern<IndexType> row_sizes;
+    row_sizes.reserve(pattern.getNumberOfRows());
+    for (std::size_t i = 0; i < pattern.getNumberOfRows(); ++i)
+    {
+        row_sizes.push_back(pattern.row_offsets[i + 1] -
+                            pattern.row_offsets[i]);
+    }
+    return row_sizes;
+}
 }
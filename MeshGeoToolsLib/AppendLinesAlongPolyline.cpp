@@ -10,6 +10,7 @@
 
 #include <logog/include/logog.hpp>
 
+#include "GeoLib/Grid.h"
 #include "GeoLib/Polyline.h"
 #include "GeoLib/PolylineVec.h"
 
@@ -37,6 +38,9 @@ std::unique_ptr<MeshLib::Mesh> appendLinesAlongPolylines(
             ? *(std::max_element(begin(*material_ids), end(*material_ids)))
             : 0;
 
+    GeoLib::Grid<MeshLib::Node> const mesh_grid(mesh.getNodes().cbegin(),
+                                                mesh.getNodes().cend());
+
     std::vector<int> new_mat_ids;
     const std::size_t n_ply (ply_vec.size());
     // for each polyline
@@ -46,7 +50,7 @@ std::unique_ptr<MeshLib::Mesh> appendLinesAlongPolylines(
 
         // search nodes on the polyline
         MeshGeoToolsLib::MeshNodesAlongPolyline mshNodesAlongPoly(
-            mesh, *ply, mesh.getMinEdgeLength() * 0.5,
+            mesh, mesh_grid, *ply, mesh.getMinEdgeLength() * 0.5,
             MeshGeoToolsLib::SearchAllNodes::Yes);
         auto &vec_nodes_on_ply = mshNodesAlongPoly.getNodeIDs();
         if (vec_nodes_on_ply.empty()) {
@@ -11,6 +11,7 @@
 
 #include <logog/include/logog.hpp>
 
+#include "GeoLib/GEOObjects.h"
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/MeshEditing/DuplicateMeshComponents.h"
 #include "MeshLib/Node.h"
@@ -26,6 +27,28 @@ std::string meshNameFromGeometry(std::string const& geometrical_set_name,
     return geometrical_set_name + "_" + geometry_name;
 }
 
+/// Returns the geometries having a name, i.e., the ones for which additional
+/// meshes are constructed.
+template <typename Geometry>
+std::vector<Geometry const*> namedGeometries(
+    std::vector<GeoLib::TemplateVec<Geometry>*> const& geometries)
+{
+    std::vector<Geometry const*> named_geometries;
+    for (auto const* const geometry_vec : geometries)
+    {
+        auto const& vec_data = *geometry_vec->getVector();
+        for (std::size_t i = 0; i < geometry_vec->size(); ++i)
+        {
+            std::string geometry_name;
+            if (geometry_vec->getNameOfElementByID(i, geometry_name))
+            {
+                named_geometries.push_back(vec_data[i]);
+            }
+        }
+    }
+    return named_geometries;
+}
+
 template <typename GeometryVec>
 std::vector<std::unique_ptr<MeshLib::Mesh>>
 constructAdditionalMeshesFromGeometries(
@@ -87,6 +110,13 @@ constructAdditionalMeshesFromGeoObjects(GeoLib::GEOObjects const& geo_objects,
     MeshGeoToolsLib::BoundaryElementsSearcher boundary_element_searcher(
         mesh, mesh_node_searcher);
 
+    // The node searches dominate the construction of the meshes for polylines
+    // and surfaces. They are independent of each other and done in parallel
+    // in advance.
+    mesh_node_searcher.searchMeshNodesAlongGeometries(
+        namedGeometries(geo_objects.getPolylines()),
+        namedGeometries(geo_objects.getSurfaces()));
+
     //
     // Points
     //
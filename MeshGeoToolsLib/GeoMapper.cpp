@@ -201,8 +201,7 @@ double GeoMapper::getMeshElevation(
 {
     const MeshLib::Node* pnt =
         _grid->getNearestPoint(MathLib::Point3d{{{x, y, 0}}});
-    const std::vector<MeshLib::Element*> elements(
-        _surface_mesh->getNode(pnt->getID())->getElements());
+    auto const elements = _surface_mesh->getNode(pnt->getID())->getElements();
     std::unique_ptr<GeoLib::Point> intersection;
 
     for (auto const & element : elements)
@@ -62,7 +62,7 @@ std::vector<std::size_t> findElementsInMesh(
     {
         auto const& connected_elements = mesh.getNode(node_id)->getElements();
         std::transform(
-            begin(connected_elements), end(connected_elements),
+            connected_elements.begin(), connected_elements.end(),
             back_inserter(common_element_ids),
             [](MeshLib::Element const* const e) { return e->getID(); });
     }
@@ -10,6 +10,8 @@
 
 #include "MeshNodeSearcher.h"
 
+#include <algorithm>
+#include <exception>
 #include <typeinfo>
 
 #include "HeuristicSearchLength.h"
@@ -21,11 +23,73 @@
 
 #include "GeoLib/Point.h"
 #include "GeoLib/Polyline.h"
+#include "GeoLib/Surface.h"
 
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
 
+namespace
+{
+/// Constructs the search objects of type \c MeshNodesAlongGeometry for the
+/// geometries which are not yet contained in \c searched_geometries in
+/// parallel and appends them to \c searched_geometries.
+template <typename MeshNodesAlongGeometry, typename Geometry,
+          typename GetGeometry, typename Search>
+void searchInParallel(
+    std::vector<MeshNodesAlongGeometry*>& searched_geometries,
+    std::vector<Geometry const*> const& geometries, GetGeometry get_geometry,
+    Search search)
+{
+    std::vector<Geometry const*> new_geometries;
+    for (auto const* const geometry : geometries)
+    {
+        bool const is_searched = std::any_of(
+            searched_geometries.begin(), searched_geometries.end(),
+            [&](MeshNodesAlongGeometry const* const searched) {
+                return &get_geometry(*searched) == geometry;
+            });
+        if (!is_searched &&
+            std::find(new_geometries.begin(), new_geometries.end(),
+                      geometry) == new_geometries.end())
+        {
+            new_geometries.push_back(geometry);
+        }
+    }
+
+    auto const n = static_cast<std::ptrdiff_t>(new_geometries.size());
+    std::vector<std::unique_ptr<MeshNodesAlongGeometry>> results(n);
+    std::exception_ptr exception;
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::ptrdiff_t i = 0; i < n; i++)
+    {
+        try
+        {
+            results[i] = search(*new_geometries[i]);
+        }
+        catch (...)
+        {
+#pragma omp critical(ogs_mesh_node_searcher_exception)
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    for (auto& result : results)
+    {
+        searched_geometries.push_back(result.release());
+    }
+}
+}  // namespace
+
 namespace MeshGeoToolsLib
 {
 std::vector<std::unique_ptr<MeshNodeSearcher>>
@@ -172,7 +236,7 @@ MeshNodesAlongPolyline& MeshNodeSearcher::getMeshNodesAlongPolyline(
 
     // compute nodes (and supporting points) along polyline
     _mesh_nodes_along_polylines.push_back(new MeshNodesAlongPolyline(
-        _mesh, ply, _search_length_algorithm->getSearchLength(),
+        _mesh, _mesh_grid, ply, _search_length_algorithm->getSearchLength(),
         _search_all_nodes));
     return *_mesh_nodes_along_polylines.back();
 }
@@ -191,12 +255,42 @@ MeshNodesAlongSurface& MeshNodeSearcher::getMeshNodesAlongSurface(
     // compute nodes (and supporting points) on surface
     _mesh_nodes_along_surfaces.push_back(
         new MeshNodesAlongSurface(_mesh,
+                                  _mesh_grid,
                                   sfc,
                                   _search_length_algorithm->getSearchLength(),
                                   _search_all_nodes));
     return *_mesh_nodes_along_surfaces.back();
 }
 
+void MeshNodeSearcher::searchMeshNodesAlongGeometries(
+    std::vector<GeoLib::Polyline const*> const& polylines,
+    std::vector<GeoLib::Surface const*> const& surfaces) const
+{
+    double const epsilon_radius = _search_length_algorithm->getSearchLength();
+
+    searchInParallel(
+        _mesh_nodes_along_polylines, polylines,
+        [](MeshNodesAlongPolyline const& searched) -> GeoLib::Polyline const& {
+            return searched.getPolyline();
+        },
+        [&](GeoLib::Polyline const& ply) {
+            return std::make_unique<MeshNodesAlongPolyline>(
+                _mesh, _mesh_grid, ply, epsilon_radius, _search_all_nodes);
+        });
+
+    // Each surface is searched by a single thread only, which is required by
+    // the lazy construction of the surface grid in Surface::isPntInSfc().
+    searchInParallel(
+        _mesh_nodes_along_surfaces, surfaces,
+        [](MeshNodesAlongSurface const& searched) -> GeoLib::Surface const& {
+            return searched.getSurface();
+        },
+        [&](GeoLib::Surface const& sfc) {
+            return std::make_unique<MeshNodesAlongSurface>(
+                _mesh, _mesh_grid, sfc, epsilon_radius, _search_all_nodes);
+        });
+}
+
 MeshNodeSearcher const& MeshNodeSearcher::getMeshNodeSearcher(
     MeshLib::Mesh const& mesh,
     std::unique_ptr<MeshGeoToolsLib::SearchLength>&& search_length_algorithm)
@@ -140,6 +140,18 @@ public:
     MeshNodesAlongSurface& getMeshNodesAlongSurface(
         GeoLib::Surface const& sfc) const;
 
+    /**
+     * Searches the mesh nodes along the given polylines and surfaces in
+     * parallel. The searches for the geometries are independent of each
+     * other. Their results are stored like the ones of
+     * getMeshNodesAlongPolyline() and getMeshNodesAlongSurface(), which return
+     * them afterwards without searching again. Geometries already searched for
+     * are skipped.
+     */
+    void searchMeshNodesAlongGeometries(
+        std::vector<GeoLib::Polyline const*> const& polylines,
+        std::vector<GeoLib::Surface const*> const& surfaces) const;
+
     /**
      * Get the mesh this searcher operates on.
      */
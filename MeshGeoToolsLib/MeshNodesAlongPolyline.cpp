@@ -16,25 +16,53 @@
 
 #include "BaseLib/quicksort.h"
 #include "MathLib/MathTools.h"
+#include "GeoLib/Grid.h"
 #include "GeoLib/Polyline.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
 
 namespace MeshGeoToolsLib
 {
-MeshNodesAlongPolyline::MeshNodesAlongPolyline(MeshLib::Mesh const& mesh,
-                                               GeoLib::Polyline const& ply,
-                                               double epsilon_radius,
-                                               SearchAllNodes search_all_nodes)
+MeshNodesAlongPolyline::MeshNodesAlongPolyline(
+    MeshLib::Mesh const& mesh, GeoLib::Grid<MeshLib::Node> const& mesh_grid,
+    GeoLib::Polyline const& ply, double epsilon_radius,
+    SearchAllNodes search_all_nodes)
     : _mesh(mesh), _ply(ply)
 {
     assert(epsilon_radius > 0);
     const std::size_t n_nodes(search_all_nodes == SearchAllNodes::Yes
                                   ? _mesh.getNumberOfNodes()
                                   : _mesh.getNumberOfBaseNodes());
-    auto &mesh_nodes = _mesh.getNodes();
-    // loop over all nodes
-    for (std::size_t i = 0; i < n_nodes; i++) {
+
+    // Only the nodes in the grid cells near the line segments are candidates.
+    // A node found by getDistanceAlongPolyline() lies in the bounding box of
+    // a line segment enlarged by the search radius. The bounding boxes are
+    // enlarged by twice the search radius to be on the safe side.
+    std::vector<std::pair<MathLib::Point3d, MathLib::Point3d>> segment_boxes;
+    for (std::size_t k = 0; k < _ply.getNumberOfSegments(); k++)
+    {
+        auto const& a = *_ply.getPoint(k);
+        auto const& b = *_ply.getPoint(k + 1);
+        std::array<double, 3> min_pnt;
+        std::array<double, 3> max_pnt;
+        for (int c = 0; c < 3; c++)
+        {
+            min_pnt[c] = std::min(a[c], b[c]) - 2 * epsilon_radius;
+            max_pnt[c] = std::max(a[c], b[c]) + 2 * epsilon_radius;
+        }
+        segment_boxes.emplace_back(MathLib::Point3d{min_pnt},
+                                   MathLib::Point3d{max_pnt});
+    }
+
+    auto& mesh_nodes = _mesh.getNodes();
+    // loop over the candidate nodes in the order of their ids
+    for (auto const i :
+         mesh_grid.getPointIDsInGridCellsIntersectingCuboids(segment_boxes))
+    {
+        if (i >= n_nodes)
+        {
+            break;
+        }
         double dist = _ply.getDistanceAlongPolyline(*mesh_nodes[i], epsilon_radius);
         if (dist >= 0.0) {
             _msh_node_ids.push_back(mesh_nodes[i]->getID());
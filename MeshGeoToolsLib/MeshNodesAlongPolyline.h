@@ -18,12 +18,15 @@
 
 namespace GeoLib
 {
+template <typename POINT>
+class Grid;
 class Polyline;
 }
 
 namespace MeshLib
 {
 class Mesh;
+class Node;
 }
 
 namespace MeshGeoToolsLib
@@ -42,15 +45,17 @@ public:
      * GeoLib::Polyline polyline within a given search radius. So the polyline
      * is something like a tube.
      * @param mesh Mesh the search will be performed on.
+     * @param mesh_grid Grid object constructed with mesh nodes. Only the nodes
+     * in the grid cells near the polyline are tested.
      * @param ply Along the GeoLib::Polyline ply the mesh nodes are searched.
      * @param epsilon_radius Search / tube radius
      * @param search_all_nodes switch between searching all mesh nodes and
      * searching the base nodes.
      */
-    MeshNodesAlongPolyline(
-        MeshLib::Mesh const& mesh, GeoLib::Polyline const& ply,
-        double epsilon_radius,
-        SearchAllNodes search_all_nodes);
+    MeshNodesAlongPolyline(MeshLib::Mesh const& mesh,
+                           GeoLib::Grid<MeshLib::Node> const& mesh_grid,
+                           GeoLib::Polyline const& ply, double epsilon_radius,
+                           SearchAllNodes search_all_nodes);
 
     /// return the mesh object
     MeshLib::Mesh const& getMesh() const;
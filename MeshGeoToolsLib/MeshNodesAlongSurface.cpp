@@ -13,27 +13,66 @@
 #include "MeshNodesAlongSurface.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "BaseLib/quicksort.h"
 #include "MathLib/MathTools.h"
+#include "GeoLib/Grid.h"
 #include "GeoLib/Surface.h"
+#include "GeoLib/Triangle.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
 
 namespace MeshGeoToolsLib
 {
-MeshNodesAlongSurface::MeshNodesAlongSurface(MeshLib::Mesh const& mesh,
-                                             GeoLib::Surface const& sfc,
-                                             double epsilon_radius,
-                                             SearchAllNodes search_all_nodes)
+MeshNodesAlongSurface::MeshNodesAlongSurface(
+    MeshLib::Mesh const& mesh, GeoLib::Grid<MeshLib::Node> const& mesh_grid,
+    GeoLib::Surface const& sfc, double epsilon_radius,
+    SearchAllNodes search_all_nodes)
     : _mesh(mesh), _sfc(sfc)
 {
     auto& mesh_nodes = _mesh.getNodes();
     const std::size_t n_nodes(search_all_nodes == SearchAllNodes::Yes
                                   ? _mesh.getNumberOfNodes()
                                   : _mesh.getNumberOfBaseNodes());
-    // loop over all nodes
-    for (std::size_t i = 0; i < n_nodes; i++) {
+
+    // Only the nodes in the grid cells near the triangles are candidates. The
+    // point in triangle test of isPntInSfc() accepts points within a distance
+    // of sqrt(epsilon_radius) to the plane of a triangle and allows a small
+    // relative tolerance within the plane, cf. MathLib::isPointInTriangle().
+    std::vector<std::pair<MathLib::Point3d, MathLib::Point3d>> triangle_boxes;
+    for (std::size_t k = 0; k < sfc.getNumberOfTriangles(); k++)
+    {
+        auto const& triangle = *sfc[k];
+        auto const& a = *triangle.getPoint(0);
+        auto const& b = *triangle.getPoint(1);
+        auto const& c = *triangle.getPoint(2);
+        double const in_plane_tolerance =
+            2 * std::numeric_limits<float>::epsilon() *
+            (std::sqrt(MathLib::sqrDist(a, b)) +
+             std::sqrt(MathLib::sqrDist(a, c)));
+        double const margin = std::sqrt(epsilon_radius) + epsilon_radius +
+                              in_plane_tolerance;
+        std::array<double, 3> min_pnt;
+        std::array<double, 3> max_pnt;
+        for (int i = 0; i < 3; i++)
+        {
+            min_pnt[i] = std::min({a[i], b[i], c[i]}) - margin;
+            max_pnt[i] = std::max({a[i], b[i], c[i]}) + margin;
+        }
+        triangle_boxes.emplace_back(MathLib::Point3d{min_pnt},
+                                    MathLib::Point3d{max_pnt});
+    }
+
+    // loop over the candidate nodes in the order of their ids
+    for (auto const i :
+         mesh_grid.getPointIDsInGridCellsIntersectingCuboids(triangle_boxes))
+    {
+        if (i >= n_nodes)
+        {
+            break;
+        }
         auto* node = mesh_nodes[i];
         if (!sfc.isPntInBoundingVolume(*node, epsilon_radius))
         {
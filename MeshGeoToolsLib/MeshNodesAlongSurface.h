@@ -18,12 +18,15 @@
 
 namespace GeoLib
 {
+template <typename POINT>
+class Grid;
 class Surface;
 }
 
 namespace MeshLib
 {
 class Mesh;
+class Node;
 }
 
 namespace MeshGeoToolsLib
@@ -38,6 +41,8 @@ public:
      * Constructor of object, that search mesh nodes along a
      * GeoLib::Surface object within a given search radius.
      * @param mesh Mesh the search will be performed on.
+     * @param mesh_grid Grid object constructed with mesh nodes. Only the nodes
+     * in the grid cells near the surface are tested.
      * @param sfc Along the GeoLib::Surface sfc the mesh nodes are searched.
      * @param epsilon_radius Euclidean distance tolerance value. Is the distance
      * between a mesh node and the surface smaller than that value it is a mesh
@@ -45,8 +50,9 @@ public:
      * @param search_all_nodes switch between searching all mesh nodes and
      * searching the base nodes.
      */
-    MeshNodesAlongSurface(MeshLib::Mesh const& mesh, GeoLib::Surface const& sfc,
-                          double epsilon_radius,
+    MeshNodesAlongSurface(MeshLib::Mesh const& mesh,
+                          GeoLib::Grid<MeshLib::Node> const& mesh_grid,
+                          GeoLib::Surface const& sfc, double epsilon_radius,
                           SearchAllNodes search_all_nodes);
 
     /// return the mesh object
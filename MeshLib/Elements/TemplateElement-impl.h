@@ -34,6 +34,18 @@ TemplateElement<ELEMENT_RULE>::TemplateElement(std::array<Node*, n_all_nodes> co
     this->_content = ELEMENT_RULE::computeVolume(this->_nodes);
 }
 
+template <class ELEMENT_RULE>
+TemplateElement<ELEMENT_RULE>::TemplateElement(Node** nodes,
+                                               Element** neighbors,
+                                               std::size_t id)
+    : Element(id)
+{
+    this->_nodes = nodes;
+    this->_neighbors = neighbors;
+    std::fill(this->_neighbors, this->_neighbors + n_neighbors, nullptr);
+    this->_content = ELEMENT_RULE::computeVolume(this->_nodes);
+}
+
 template <class ELEMENT_RULE>
 TemplateElement<ELEMENT_RULE>::TemplateElement(const TemplateElement &e)
 : Element(e.getID())
@@ -41,6 +41,9 @@ public:
     /// Constant: The dimension of this element
     static const unsigned dimension = ELEMENT_RULE::dimension;
 
+    /// Constant: The number of neighbors of this element
+    static const unsigned n_neighbors = ELEMENT_RULE::n_neighbors;
+
     /**
      * Constructor with an array of mesh nodes.
      *
@@ -61,6 +64,18 @@ public:
         std::array<Node*, n_all_nodes> const& nodes,
         std::size_t id = std::numeric_limits<std::size_t>::max());
 
+    /**
+     * Constructor with arrays for the mesh nodes and the neighbors, which
+     * are not owned by the element. This is used for elements stored in a
+     * MeshItemArena together with their node and neighbor arrays.
+     *
+     * @param nodes      an array of pointers of mesh nodes which form this
+     *                   element
+     * @param neighbors  an array of n_neighbors pointers for the neighbors
+     * @param id         element id
+     */
+    TemplateElement(Node** nodes, Element** neighbors, std::size_t id);
+
     /// Copy constructor
     TemplateElement(const TemplateElement &e);
 
@@ -33,6 +33,19 @@ public:
     //! Add a VTU file to this PVD file.
     void addVTUFile(std::string const& vtu_fname, double timestep);
 
+    //! Returns the (time, VTU file name) pairs referenced by this PVD file.
+    std::vector<std::pair<double, std::string>> const& getVTUFiles() const
+    {
+        return _datasets;
+    }
+
+    //! Replaces the referenced VTU files, e.g. when restarting a simulation.
+    //! The PVD file is written again by the next call of addVTUFile().
+    void setVTUFiles(std::vector<std::pair<double, std::string>> datasets)
+    {
+        _datasets = std::move(datasets);
+    }
+
 private:
     std::string const _pvd_filename;
     std::vector<std::pair<double, std::string>> _datasets; // a vector of (time, VTU file name)
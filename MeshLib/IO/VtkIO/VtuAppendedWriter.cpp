@@ -0,0 +1,382 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuAppendedWriter.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <zlib.h>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/StringTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/VtkOGSEnum.h"
+
+namespace
+{
+//! Uncompressed size in bytes of the blocks into which compressed arrays are
+//! split. Each block is compressed independently.
+std::size_t const compression_block_size = 1 << 18;
+
+//! For typical simulation results the fastest zlib level yields files only
+//! slightly larger than the default level in a fraction of the time.
+int const compression_level = Z_BEST_SPEED;
+
+//! An array in the appended section of the VTU file.
+struct AppendedArray
+{
+    AppendedArray(std::string section_, std::string attributes_,
+                  void const* data_, std::size_t const size_)
+        : section(std::move(section_)),
+          attributes(std::move(attributes_)),
+          data(static_cast<unsigned char const*>(data_)),
+          size(size_)
+    {
+    }
+
+    //! Name of the XML element the DataArray belongs to.
+    std::string section;
+    //! XML attributes of the DataArray except format and offset.
+    std::string attributes;
+
+    unsigned char const* data;
+    //! Uncompressed size in bytes.
+    std::size_t size;
+
+    //! Header preceding the data in the appended section.
+    std::vector<std::uint64_t> header;
+    std::vector<std::vector<unsigned char>> compressed_blocks;
+    //! Position in the appended section.
+    std::uint64_t offset = 0;
+};
+
+template <typename T>
+std::string getVtkTypeName()
+{
+    static_assert(std::is_arithmetic<T>::value,
+                  "Only arithmetic types can be written.");
+    if (std::is_floating_point<T>::value)
+    {
+        return "Float" + std::to_string(8 * sizeof(T));
+    }
+    return (std::is_signed<T>::value ? "Int" : "UInt") +
+           std::to_string(8 * sizeof(T));
+}
+
+template <typename T>
+bool addProperty(MeshLib::Properties const& properties,
+                 std::string const& name, std::vector<AppendedArray>& arrays)
+{
+    if (!properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (property == nullptr)
+    {
+        return false;
+    }
+
+    auto const n_components = property->getNumberOfComponents();
+    std::string attributes = "type=\"" + getVtkTypeName<T>() + "\" Name=\"" +
+                             BaseLib::escapeXml(name) + "\" NumberOfComponents=\"" +
+                             std::to_string(n_components) + "\"";
+
+    std::string section;
+    switch (property->getMeshItemType())
+    {
+        case MeshLib::MeshItemType::Node:
+            section = "PointData";
+            break;
+        case MeshLib::MeshItemType::Cell:
+            section = "CellData";
+            break;
+        case MeshLib::MeshItemType::IntegrationPoint:
+            section = "FieldData";
+            attributes += " NumberOfTuples=\"" +
+                          std::to_string(property->size() / n_components) +
+                          "\"";
+            break;
+        default:
+            DBUG("Mesh property '%s' of unsupported mesh item type skipped.",
+                 name.c_str());
+            return true;
+    }
+
+    arrays.emplace_back(section, attributes, property->data(),
+                        property->size() * sizeof(T));
+    return true;
+}
+
+//! Compresses all arrays block-wise in parallel and sets the headers of the
+//! vtkZLibDataCompressor format, which are the number of blocks, the block
+//! size, the size of the last block if it is partial, and the compressed
+//! sizes of all blocks.
+bool compressArrays(std::vector<AppendedArray>& arrays)
+{
+    struct Block
+    {
+        AppendedArray* array;
+        std::size_t index;
+    };
+    std::vector<Block> blocks;
+    for (auto& array : arrays)
+    {
+        std::size_t const n_blocks =
+            (array.size + compression_block_size - 1) / compression_block_size;
+        array.compressed_blocks.resize(n_blocks);
+        for (std::size_t i = 0; i < n_blocks; ++i)
+        {
+            blocks.push_back({&array, i});
+        }
+    }
+
+    auto const n_blocks = static_cast<std::ptrdiff_t>(blocks.size());
+    int failed = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : failed)
+    for (std::ptrdiff_t b = 0; b < n_blocks; ++b)
+    {
+        auto const& block = blocks[b];
+        auto const begin = block.index * compression_block_size;
+        auto const length =
+            std::min(compression_block_size, block.array->size - begin);
+
+        auto& compressed = block.array->compressed_blocks[block.index];
+        uLongf compressed_length = compressBound(length);
+        compressed.resize(compressed_length);
+        if (compress2(compressed.data(), &compressed_length,
+                      block.array->data + begin, length,
+                      compression_level) != Z_OK)
+        {
+            failed++;
+        }
+        compressed.resize(compressed_length);
+    }
+    if (failed > 0)
+    {
+        return false;
+    }
+
+    for (auto& array : arrays)
+    {
+        array.header = {array.compressed_blocks.size(), compression_block_size,
+                        array.size % compression_block_size};
+        for (auto const& compressed : array.compressed_blocks)
+        {
+            array.header.push_back(compressed.size());
+        }
+    }
+    return true;
+}
+
+void writeSection(std::ostream& os, std::vector<AppendedArray> const& arrays,
+                  std::string const& section, std::string const& indent,
+                  bool const write_empty_section)
+{
+    bool const is_empty =
+        std::none_of(arrays.begin(), arrays.end(), [&](auto const& array) {
+            return array.section == section;
+        });
+    if (is_empty && !write_empty_section)
+    {
+        return;
+    }
+
+    os << indent << "<" << section << ">\n";
+    for (auto const& array : arrays)
+    {
+        if (array.section == section)
+        {
+            os << indent << "  <DataArray " << array.attributes
+               << " format=\"appended\" offset=\"" << array.offset << "\"/>\n";
+        }
+    }
+    os << indent << "</" << section << ">\n";
+}
+
+bool isLittleEndian()
+{
+    std::uint16_t const one = 1;
+    return *reinterpret_cast<unsigned char const*>(&one) == 1;
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+bool writeVtuAppended(std::string const& file_name, MeshLib::Mesh const& mesh,
+                      MeshLib::Properties const& properties,
+                      bool const compress)
+{
+    // Points and cells are not stored contiguously in the mesh, they are
+    // gathered into temporary arrays.
+    auto const& nodes = mesh.getNodes();
+    std::vector<double> points;
+    points.reserve(3 * nodes.size());
+    for (auto const* node : nodes)
+    {
+        points.insert(points.end(), node->getCoords(), node->getCoords() + 3);
+    }
+
+    auto const& elements = mesh.getElements();
+    std::vector<std::int64_t> connectivity;
+    std::vector<std::int64_t> offsets;
+    std::vector<std::uint8_t> types;
+    offsets.reserve(elements.size());
+    types.reserve(elements.size());
+    for (auto const* element : elements)
+    {
+        auto const cell_type = OGSToVtkCellType(element->getCellType());
+        auto const n_element_nodes = element->getNumberOfNodes();
+        auto const begin = connectivity.size();
+        for (unsigned i = 0; i < n_element_nodes; ++i)
+        {
+            connectivity.push_back(element->getNode(i)->getID());
+        }
+        OGSToVtkNodeOrder(cell_type, connectivity.data() + begin);
+        offsets.push_back(connectivity.size());
+        types.push_back(static_cast<std::uint8_t>(cell_type));
+    }
+
+    std::vector<AppendedArray> arrays;
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (addProperty<double>(properties, name, arrays) ||
+            addProperty<float>(properties, name, arrays) ||
+            addProperty<int>(properties, name, arrays) ||
+            addProperty<unsigned>(properties, name, arrays) ||
+            addProperty<std::size_t>(properties, name, arrays) ||
+            addProperty<char>(properties, name, arrays))
+        {
+            continue;
+        }
+        DBUG("Mesh property '%s' with unknown data type.", name.c_str());
+    }
+    arrays.emplace_back(
+        "Points",
+        "type=\"" + getVtkTypeName<double>() +
+            "\" Name=\"Points\" NumberOfComponents=\"3\"",
+        points.data(), points.size() * sizeof(double));
+    arrays.emplace_back(
+        "Cells",
+        "type=\"" + getVtkTypeName<std::int64_t>() + "\" Name=\"connectivity\"",
+        connectivity.data(), connectivity.size() * sizeof(std::int64_t));
+    arrays.emplace_back(
+        "Cells",
+        "type=\"" + getVtkTypeName<std::int64_t>() + "\" Name=\"offsets\"",
+        offsets.data(), offsets.size() * sizeof(std::int64_t));
+    arrays.emplace_back(
+        "Cells", "type=\"" + getVtkTypeName<std::uint8_t>() + "\" Name=\"types\"",
+        types.data(), types.size() * sizeof(std::uint8_t));
+
+    if (compress)
+    {
+        if (!compressArrays(arrays))
+        {
+            ERR("writeVtuAppended(): Compression of the data for '%s' failed.",
+                file_name.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        for (auto& array : arrays)
+        {
+            array.header = {array.size};
+        }
+    }
+
+    std::uint64_t offset = 0;
+    for (auto& array : arrays)
+    {
+        array.offset = offset;
+        offset += array.header.size() * sizeof(std::uint64_t);
+        if (compress)
+        {
+            for (auto const& compressed : array.compressed_blocks)
+            {
+                offset += compressed.size();
+            }
+        }
+        else
+        {
+            offset += array.size;
+        }
+    }
+
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("writeVtuAppended(): Could not open file '%s' for writing.",
+            file_name.c_str());
+        return false;
+    }
+
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (isLittleEndian() ? "LittleEndian" : "BigEndian")
+       << "\" header_type=\"UInt64\"";
+    if (compress)
+    {
+        os << " compressor=\"vtkZLibDataCompressor\"";
+    }
+    os << ">\n  <UnstructuredGrid>\n";
+    writeSection(os, arrays, "FieldData", "    ", false);
+    os << "    <Piece NumberOfPoints=\"" << nodes.size()
+       << "\" NumberOfCells=\"" << elements.size() << "\">\n";
+    writeSection(os, arrays, "PointData", "      ", false);
+    writeSection(os, arrays, "CellData", "      ", false);
+    writeSection(os, arrays, "Points", "      ", true);
+    writeSection(os, arrays, "Cells", "      ", true);
+    os << "    </Piece>\n  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n   _";
+
+    for (auto const& array : arrays)
+    {
+        os.write(reinterpret_cast<char const*>(array.header.data()),
+                 array.header.size() * sizeof(std::uint64_t));
+        if (compress)
+        {
+            for (auto const& compressed : array.compressed_blocks)
+            {
+                os.write(reinterpret_cast<char const*>(compressed.data()),
+                         compressed.size());
+            }
+        }
+        else
+        {
+            os.write(reinterpret_cast<char const*>(array.data), array.size);
+        }
+    }
+
+    os << "\n  </AppendedData>\n</VTKFile>\n";
+
+    if (!os)
+    {
+        ERR("writeVtuAppended(): Error while writing file '%s'.",
+            file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace IO
+}  // namespace MeshLib
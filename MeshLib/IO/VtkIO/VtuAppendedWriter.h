@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+class Properties;
+
+namespace IO
+{
+/**
+ * Writes a mesh as VTU file with all arrays in the appended section in raw
+ * binary encoding, as vtkXMLUnstructuredGridWriter does in appended mode
+ * without base64 encoding.
+ *
+ * The mesh is not converted to a VTK data set. Uncompressed property arrays
+ * are streamed directly from the PropertyVector memory. If \c compress is set,
+ * the arrays are split into blocks, which are compressed in parallel with
+ * zlib in the block format of vtkZLibDataCompressor.
+ *
+ * \param file_name  name of the file to be written
+ * \param mesh       nodes and elements to be written
+ * \param properties point, cell, and integration point data to be written
+ * \param compress   enables zlib compression
+ * \return True on success, false on error
+ */
+bool writeVtuAppended(std::string const& file_name, MeshLib::Mesh const& mesh,
+                      MeshLib::Properties const& properties,
+                      bool const compress);
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -42,6 +42,7 @@ bool VtuInterface::writeVTU(std::string const& file_name,
 
     vtkNew<MeshLib::VtkMappedMeshSource> vtkSource;
     vtkSource->SetMesh(_mesh);
+    vtkSource->SetProperties(_properties);
 
     vtkSmartPointer<UnstructuredGridWriter> vtuWriter =
         vtkSmartPointer<UnstructuredGridWriter>::New();
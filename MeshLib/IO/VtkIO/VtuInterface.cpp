@@ -34,14 +34,21 @@
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/VtkMeshConverter.h"
 #include "MeshLib/Vtk/VtkMappedMeshSource.h"
+#include "VtuAppendedWriter.h"
 
 namespace MeshLib
 {
 namespace IO
 {
 
-VtuInterface::VtuInterface(const MeshLib::Mesh* mesh, int dataMode, bool compress) :
-    _mesh(mesh), _data_mode(dataMode), _use_compressor(compress)
+VtuInterface::VtuInterface(const MeshLib::Mesh* mesh, int dataMode,
+                           bool compress, MeshLib::Properties const* properties,
+                           bool raw_appended_data)
+    : _mesh(mesh),
+      _properties(properties),
+      _data_mode(dataMode),
+      _use_compressor(compress),
+      _raw_appended_data(raw_appended_data)
 {
     if(_data_mode == vtkXMLWriter::Ascii && compress)
         WARN("Ascii data cannot be compressed, ignoring compression flag.");
@@ -59,7 +66,9 @@ MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
     reader->SetFileName(file_name.c_str());
     reader->Update();
 
-    vtkUnstructuredGrid* vtkGrid = reader->GetOutput();
+    // Only the grid is kept, the reader is released.
+    vtkSmartPointer<vtkUnstructuredGrid> vtkGrid = reader->GetOutput();
+    reader = nullptr;
     if (vtkGrid->GetNumberOfPoints() == 0)
     {
         ERR("Mesh '%s' contains zero points.", file_name.c_str());
@@ -67,7 +76,10 @@ MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
     }
 
     std::string const mesh_name (BaseLib::extractBaseNameWithoutExtension(file_name));
-    return MeshLib::VtkMeshConverter::convertUnstructuredGrid(vtkGrid, mesh_name);
+    // The grid is not used after the conversion, so its data is released
+    // while it is converted.
+    return MeshLib::VtkMeshConverter::convertUnstructuredGrid(
+        vtkGrid, mesh_name, true);
 }
 
 #ifdef USE_PETSC
@@ -105,6 +117,13 @@ bool VtuInterface::writeToFile(std::string const &file_name)
     return writeVTU<vtkXMLPUnstructuredGridWriter>(vtu_file_name + ".pvtu",
                                                    mpi_size, rank);
 #else
+    if (_mesh && _data_mode == vtkXMLWriter::Appended && _raw_appended_data)
+    {
+        return writeVtuAppended(
+            file_name, *_mesh,
+            _properties ? *_properties : _mesh->getProperties(),
+            _use_compressor);
+    }
     return writeVTU<vtkXMLUnstructuredGridWriter>(file_name);
 #endif
 }
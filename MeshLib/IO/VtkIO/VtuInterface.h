@@ -19,6 +19,7 @@
 
 namespace MeshLib {
 class Mesh;
+class Properties;
 
 namespace IO
 {
@@ -37,15 +38,21 @@ class VtuInterface final
 {
 public:
     /// Provide the mesh to write and set if compression should be used.
+    /// If \c properties are given, they are written instead of the mesh's
+    /// own properties. In appended mode the data is base64 encoded unless
+    /// \c raw_appended_data is set.
     explicit VtuInterface(const MeshLib::Mesh* mesh,
                           int dataMode = vtkXMLWriter::Appended,
-                          bool compressed = false);
+                          bool compressed = false,
+                          MeshLib::Properties const* properties = nullptr,
+                          bool raw_appended_data = false);
 
     /// Read an unstructured grid from a VTU file
     /// \return The converted mesh or a nullptr if reading failed
     static MeshLib::Mesh* readVTUFile(std::string const &file_name);
 
-    /// Writes the given mesh to file.
+    /// Writes the given mesh to file. Serial output with raw appended data is
+    /// written by writeVtuAppended(), all other modes go through VTK.
     /// \return True on success, false on error
     bool writeToFile(std::string const &file_name);
 
@@ -60,8 +67,10 @@ public:
 
 private:
     const MeshLib::Mesh* _mesh;
+    MeshLib::Properties const* _properties;
     int _data_mode;
     bool _use_compressor;
+    bool _raw_appended_data;
 };
 
 int writeVtu(MeshLib::Mesh const& mesh, std::string const& file_name,
@@ -0,0 +1,390 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "XdmfHdfWriter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/StringTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/VtkOGSEnum.h"
+
+namespace
+{
+//! Topology type ids of the XDMF mixed topology. The node order of the cells
+//! is the same as in VTK.
+int getXdmfTopologyType(MeshLib::CellType const cell_type)
+{
+    switch (cell_type)
+    {
+        case MeshLib::CellType::POINT1:
+            return 1;  // Polyvertex
+        case MeshLib::CellType::LINE2:
+            return 2;  // Polyline
+        case MeshLib::CellType::LINE3:
+            return 34;  // Edge_3
+        case MeshLib::CellType::TRI3:
+            return 4;
+        case MeshLib::CellType::TRI6:
+            return 36;
+        case MeshLib::CellType::QUAD4:
+            return 5;
+        case MeshLib::CellType::QUAD8:
+            return 37;
+        case MeshLib::CellType::QUAD9:
+            return 35;
+        case MeshLib::CellType::TET4:
+            return 6;
+        case MeshLib::CellType::TET10:
+            return 38;
+        case MeshLib::CellType::HEX8:
+            return 9;
+        case MeshLib::CellType::HEX20:
+            return 48;
+        case MeshLib::CellType::HEX27:
+            return 50;
+        case MeshLib::CellType::PRISM6:
+            return 8;
+        case MeshLib::CellType::PRISM15:
+            return 40;
+        case MeshLib::CellType::PRISM18:
+            return 41;
+        case MeshLib::CellType::PYRAMID5:
+            return 7;
+        case MeshLib::CellType::PYRAMID13:
+            return 39;
+        default:
+            OGS_FATAL("Cell type %d is not supported by the XDMF output.",
+                      static_cast<int>(cell_type));
+    }
+}
+
+template <typename T>
+hid_t getHdfType()
+{
+    static_assert(std::is_arithmetic<T>::value,
+                  "Only arithmetic types can be written.");
+    if (std::is_same<T, double>::value)
+    {
+        return H5T_NATIVE_DOUBLE;
+    }
+    if (std::is_same<T, float>::value)
+    {
+        return H5T_NATIVE_FLOAT;
+    }
+    switch (sizeof(T))
+    {
+        case 1:
+            return std::is_signed<T>::value ? H5T_NATIVE_INT8
+                                            : H5T_NATIVE_UINT8;
+        case 2:
+            return std::is_signed<T>::value ? H5T_NATIVE_INT16
+                                            : H5T_NATIVE_UINT16;
+        case 4:
+            return std::is_signed<T>::value ? H5T_NATIVE_INT32
+                                            : H5T_NATIVE_UINT32;
+        default:
+            return std::is_signed<T>::value ? H5T_NATIVE_INT64
+                                            : H5T_NATIVE_UINT64;
+    }
+}
+
+//! The NumberType and Precision attributes of an XDMF DataItem.
+template <typename T>
+std::string getXdmfNumberType()
+{
+    std::string number_type;
+    if (std::is_floating_point<T>::value)
+    {
+        number_type = "Float";
+    }
+    else if (sizeof(T) == 1)
+    {
+        number_type = std::is_signed<T>::value ? "Char" : "UChar";
+    }
+    else
+    {
+        number_type = std::is_signed<T>::value ? "Int" : "UInt";
+    }
+    return "NumberType=\"" + number_type + "\" Precision=\"" +
+           std::to_string(sizeof(T)) + "\"";
+}
+
+std::string getXdmfAttributeType(int const n_components)
+{
+    switch (n_components)
+    {
+        case 1:
+            return "Scalar";
+        case 3:
+            return "Vector";
+        case 6:
+            return "Tensor6";
+        case 9:
+            return "Tensor";
+        default:
+            return "Matrix";
+    }
+}
+
+//! HDF5 link names must not contain slashes.
+std::string getDatasetName(std::string name)
+{
+    std::replace(name.begin(), name.end(), '/', '_');
+    return name;
+}
+
+std::string xdmfDataItem(std::string const& dimensions,
+                         std::string const& number_type,
+                         std::string const& h5_file_name,
+                         std::string const& path)
+{
+    return "<DataItem Dimensions=\"" + dimensions + "\" " + number_type +
+           " Format=\"HDF\">" + BaseLib::escapeXml(h5_file_name) + ":" +
+           BaseLib::escapeXml(path) + "</DataItem>";
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+XdmfHdfWriter::XdmfHdfWriter(MeshLib::Mesh const& mesh,
+                             std::string const& file_name_without_extension)
+    : _mesh(mesh),
+      _h5_file_name(file_name_without_extension + ".h5"),
+      _xdmf_file_name(file_name_without_extension + ".xdmf")
+{
+    _file = H5Fcreate(_h5_file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                      H5P_DEFAULT);
+    if (_file < 0)
+    {
+        OGS_FATAL("Could not create the HDF5 file '%s'.",
+                  _h5_file_name.c_str());
+    }
+
+    auto const& nodes = mesh.getNodes();
+    std::vector<double> points;
+    points.reserve(3 * nodes.size());
+    for (auto const* node : nodes)
+    {
+        points.insert(points.end(), node->getCoords(), node->getCoords() + 3);
+    }
+    writeDataset("/geometry", H5T_NATIVE_DOUBLE, points.data(), nodes.size(),
+                 3);
+
+    // The mixed topology stores for each cell its type, for polylines and
+    // polyvertices the number of nodes, and the node ids.
+    auto const& elements = mesh.getElements();
+    std::vector<std::int64_t> topology;
+    for (auto const* element : elements)
+    {
+        auto const cell_type = element->getCellType();
+        auto const xdmf_type = getXdmfTopologyType(cell_type);
+        auto const n_element_nodes = element->getNumberOfNodes();
+        topology.push_back(xdmf_type);
+        if (xdmf_type == 1 || xdmf_type == 2)
+        {
+            topology.push_back(n_element_nodes);
+        }
+        auto const begin = topology.size();
+        for (unsigned i = 0; i < n_element_nodes; ++i)
+        {
+            topology.push_back(element->getNode(i)->getID());
+        }
+        OGSToVtkNodeOrder(OGSToVtkCellType(cell_type), topology.data() + begin);
+    }
+    writeDataset("/topology", H5T_NATIVE_INT64, topology.data(),
+                 topology.size(), 1);
+    _topology_size = topology.size();
+}
+
+XdmfHdfWriter::~XdmfHdfWriter()
+{
+    H5Fclose(_file);
+}
+
+void XdmfHdfWriter::writeDataset(std::string const& path, hid_t const type,
+                                 void const* const data, hsize_t const rows,
+                                 hsize_t const columns)
+{
+    hsize_t const dims[2] = {rows, columns};
+    hid_t const space = H5Screate_simple(2, dims, nullptr);
+
+    // The groups of the time steps are created with their first dataset.
+    hid_t const link_creation = H5Pcreate(H5P_LINK_CREATE);
+    H5Pset_create_intermediate_group(link_creation, 1);
+    hid_t const dataset = H5Dcreate2(_file, path.c_str(), type, space,
+                                     link_creation, H5P_DEFAULT, H5P_DEFAULT);
+    H5Pclose(link_creation);
+
+    herr_t status = dataset < 0 ? -1 : 0;
+    // Empty properties are written as empty datasets.
+    if (status >= 0 && rows * columns > 0)
+    {
+        status = H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+    }
+
+    if (dataset >= 0)
+    {
+        H5Dclose(dataset);
+    }
+    H5Sclose(space);
+
+    if (status < 0)
+    {
+        OGS_FATAL("Could not write the dataset '%s' into the HDF5 file '%s'.",
+                  path.c_str(), _h5_file_name.c_str());
+    }
+}
+
+template <typename T>
+bool XdmfHdfWriter::writeProperty(std::string const& name,
+                                  std::string const& group,
+                                  std::string& xdmf_attributes)
+{
+    auto const& properties = _mesh.getProperties();
+    if (!properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (property == nullptr)
+    {
+        return false;
+    }
+
+    auto const item_type = property->getMeshItemType();
+    if (item_type != MeshLib::MeshItemType::Node &&
+        item_type != MeshLib::MeshItemType::Cell &&
+        item_type != MeshLib::MeshItemType::IntegrationPoint)
+    {
+        DBUG("Mesh property '%s' of unsupported mesh item type skipped.",
+             name.c_str());
+        return true;
+    }
+
+    auto const n_components = property->getNumberOfComponents();
+    auto const n_tuples = property->size() / n_components;
+    auto const path = group + "/" + getDatasetName(name);
+    writeDataset(path, getHdfType<T>(), property->data(), n_tuples,
+                 n_components);
+
+    if (item_type == MeshLib::MeshItemType::IntegrationPoint)
+    {
+        return true;
+    }
+    bool const is_node_property = item_type == MeshLib::MeshItemType::Node;
+    xdmf_attributes +=
+        "        <Attribute Name=\"" + BaseLib::escapeXml(name) +
+        "\" AttributeType=\"" + getXdmfAttributeType(n_components) +
+        "\" Center=\"" + (is_node_property ? "Node" : "Cell") +
+        "\">\n          " +
+        xdmfDataItem(std::to_string(n_tuples) + " " +
+                         std::to_string(n_components),
+                     getXdmfNumberType<T>(),
+                     BaseLib::extractBaseName(_h5_file_name), path) +
+        "\n        </Attribute>\n";
+    return true;
+}
+
+void XdmfHdfWriter::writeStep(double const t)
+{
+    auto const step = _xdmf_grids.size();
+    auto const group = "/t_" + std::to_string(step);
+
+    std::string xdmf_attributes;
+    for (auto const& name : _mesh.getProperties().getPropertyVectorNames())
+    {
+        if (writeProperty<double>(name, group, xdmf_attributes) ||
+            writeProperty<float>(name, group, xdmf_attributes) ||
+            writeProperty<int>(name, group, xdmf_attributes) ||
+            writeProperty<unsigned>(name, group, xdmf_attributes) ||
+            writeProperty<std::size_t>(name, group, xdmf_attributes) ||
+            writeProperty<char>(name, group, xdmf_attributes))
+        {
+            continue;
+        }
+        DBUG("Mesh property '%s' with unknown data type.", name.c_str());
+    }
+
+    // The file stays readable if the simulation is aborted later.
+    H5Fflush(_file, H5F_SCOPE_LOCAL);
+
+    std::ostringstream time;
+    time.precision(std::numeric_limits<double>::digits10 + 2);
+    time << t;
+    _xdmf_grids.push_back("      <Grid Name=\"" + group.substr(1) +
+                          "\" GridType=\"Uniform\">\n        <Time Value=\"" +
+                          time.str() + "\"/>\n" + xdmfGeometryAndTopology() +
+                          xdmf_attributes + "      </Grid>\n");
+    writeXdmfFile();
+}
+
+std::string XdmfHdfWriter::xdmfGeometryAndTopology() const
+{
+    auto const h5_file_name = BaseLib::extractBaseName(_h5_file_name);
+    return "        <Geometry GeometryType=\"XYZ\">\n          " +
+           xdmfDataItem(std::to_string(_mesh.getNumberOfNodes()) + " 3",
+                        getXdmfNumberType<double>(), h5_file_name,
+                        "/geometry") +
+           "\n        </Geometry>\n"
+           "        <Topology TopologyType=\"Mixed\" NumberOfElements=\"" +
+           std::to_string(_mesh.getNumberOfElements()) +
+           "\">\n          " +
+           xdmfDataItem(std::to_string(_topology_size),
+                        getXdmfNumberType<std::int64_t>(), h5_file_name,
+                        "/topology") +
+           "\n        </Topology>\n";
+}
+
+void XdmfHdfWriter::writeXdmfFile() const
+{
+    // The previous XDMF file is only replaced by a complete one.
+    auto const tmp_file_name = _xdmf_file_name + ".tmp";
+    {
+        std::ofstream os(tmp_file_name);
+        os << "<?xml version=\"1.0\" ?>\n"
+           << "<Xdmf Version=\"3.0\">\n  <Domain>\n"
+           << "    <Grid Name=\"" << BaseLib::escapeXml(_mesh.getName())
+           << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+        for (auto const& grid : _xdmf_grids)
+        {
+            os << grid;
+        }
+        os << "    </Grid>\n  </Domain>\n</Xdmf>\n";
+        if (!os)
+        {
+            OGS_FATAL("Could not write the XDMF file '%s'.",
+                      tmp_file_name.c_str());
+        }
+    }
+    if (std::rename(tmp_file_name.c_str(), _xdmf_file_name.c_str()) != 0)
+    {
+        OGS_FATAL("Could not rename '%s' to '%s'.", tmp_file_name.c_str(),
+                  _xdmf_file_name.c_str());
+    }
+}
+
+}  // namespace IO
+}  // namespace MeshLib
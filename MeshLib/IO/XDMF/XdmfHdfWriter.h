@@ -0,0 +1,91 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * Writes a time series of a mesh and its properties into a single HDF5 file
+ * and describes it by an XDMF file, which can be opened e.g. by ParaView.
+ *
+ * The geometry and topology are written once on construction. Each call of
+ * writeStep() appends the node, cell, and integration point properties of the
+ * mesh as datasets of a new group \c /t_<step> to the HDF5 file and rewrites
+ * the XDMF file, s.t. it references all steps written so far.
+ *
+ * Integration point data is stored in the HDF5 file only, since XDMF has no
+ * means to describe it. The writer is not available in parallel runs with
+ * PETSc, which is rejected by CMake.
+ */
+class XdmfHdfWriter final
+{
+public:
+    /**
+     * \param mesh  the mesh to be written. Its properties are read on each
+     *              call of writeStep().
+     * \param file_name_without_extension  path of the output files, the
+     *              extensions .h5 and .xdmf are appended.
+     */
+    XdmfHdfWriter(MeshLib::Mesh const& mesh,
+                  std::string const& file_name_without_extension);
+
+    XdmfHdfWriter(XdmfHdfWriter const&) = delete;
+    XdmfHdfWriter& operator=(XdmfHdfWriter const&) = delete;
+
+    ~XdmfHdfWriter();
+
+    /// Appends the current properties of the mesh as time step \c t.
+    void writeStep(double const t);
+
+private:
+    //! Writes the \c rows times \c columns values of \c data into the new
+    //! dataset \c path.
+    void writeDataset(std::string const& path, hid_t const type,
+                      void const* const data, hsize_t const rows,
+                      hsize_t const columns);
+
+    //! Writes the property \c name into the given group and appends its
+    //! description to \c xdmf_attributes if it is a node or cell property.
+    //! Returns false if the property is not of type \c T.
+    template <typename T>
+    bool writeProperty(std::string const& name, std::string const& group,
+                       std::string& xdmf_attributes);
+
+    //! Writes the XDMF file describing all steps written so far.
+    void writeXdmfFile() const;
+
+    //! Describes the geometry and topology of one step in the XDMF file.
+    std::string xdmfGeometryAndTopology() const;
+
+    MeshLib::Mesh const& _mesh;
+    std::string const _h5_file_name;
+    std::string const _xdmf_file_name;
+    hid_t _file = -1;
+
+    //! Number of entries in the mixed topology array.
+    std::size_t _topology_size = 0;
+
+    //! The XML Grid elements of the written steps.
+    std::vector<std::string> _xdmf_grids;
+};
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -14,7 +14,9 @@
 
 #include "Mesh.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <utility>
 
@@ -35,9 +37,10 @@ Mesh::Mesh(std::string name,
                nodes,
            std::vector<Element*>
                elements,
-           Properties const& properties,
-           const std::size_t n_base_nodes)
-    : _id(_counter_value - 1),
+           Properties properties,
+           const std::size_t n_base_nodes,
+           std::unique_ptr<MeshItemArena> arena)
+    : _id(_counter_id),
       _mesh_dimension(0),
       _edge_length(std::numeric_limits<double>::max(), 0),
       _node_distance(std::numeric_limits<double>::max(), 0),
@@ -45,7 +48,8 @@ Mesh::Mesh(std::string name,
       _nodes(std::move(nodes)),
       _elements(std::move(elements)),
       _n_base_nodes(n_base_nodes),
-      _properties(properties)
+      _properties(std::move(properties)),
+      _arena(std::move(arena))
 {
     assert(_n_base_nodes <= _nodes.size());
     this->resetNodeIDs();
@@ -68,7 +72,7 @@ Mesh::Mesh(std::string name,
 }
 
 Mesh::Mesh(const Mesh &mesh)
-    : _id(_counter_value-1), _mesh_dimension(mesh.getDimension()),
+    : _id(_counter_id), _mesh_dimension(mesh.getDimension()),
       _edge_length(mesh._edge_length.first, mesh._edge_length.second),
       _node_distance(mesh._node_distance.first, mesh._node_distance.second),
       _name(mesh.getName()), _nodes(mesh.getNumberOfNodes()), _elements(mesh.getNumberOfElements()),
@@ -100,22 +104,33 @@ Mesh::Mesh(const Mesh &mesh)
     }
     this->setElementsConnectedToNodes();
     //this->setNodesConnectedByEdges();
-    //this->setNodesConnectedByElements();
+    this->setNodesConnectedByElements();
     this->setElementNeighbors();
 }
 
 Mesh::~Mesh()
 {
+    // Items stored in the arena are released together with it.
+    auto const is_in_arena = [this](void const* const item) {
+        return _arena && _arena->contains(item);
+    };
+
     const std::size_t nElements (_elements.size());
     for (std::size_t i = 0; i < nElements; ++i)
     {
-        delete _elements[i];
+        if (!is_in_arena(_elements[i]))
+        {
+            delete _elements[i];
+        }
     }
 
     const std::size_t nNodes (_nodes.size());
     for (std::size_t i = 0; i < nNodes; ++i)
     {
-        delete _nodes[i];
+        if (!is_in_arena(_nodes[i]))
+        {
+            delete _nodes[i];
+        }
     }
 }
 
@@ -128,12 +143,10 @@ void Mesh::addElement(Element* elem)
 {
     _elements.push_back(elem);
 
-    // add element information to nodes
-    unsigned nNodes (elem->getNumberOfNodes());
-    for (unsigned i = 0; i < nNodes; ++i)
-    {
-        elem->_nodes[i]->addElement(elem);
-    }
+    // The connectivity of all nodes is stored in common arrays, which are
+    // rebuilt.
+    this->setElementsConnectedToNodes();
+    this->setNodesConnectedByElements();
 }
 
 void Mesh::resetNodeIDs()
@@ -181,25 +194,55 @@ void Mesh::setDimension()
 
 void Mesh::setElementsConnectedToNodes()
 {
-    for (auto& element : _elements)
+    auto const n_nodes = _nodes.size();
+    auto isMeshNode = [&](Node const* const node) {
+        auto const id = node->getID();
+        return id < n_nodes && _nodes[id] == node;
+    };
+
+    // Count the elements of each node, then store them node by node in the
+    // order of the elements.
+    std::vector<std::size_t> offsets(n_nodes + 1, 0);
+    for (auto const* element : _elements)
     {
         const unsigned nNodes(element->getNumberOfNodes());
         for (unsigned j = 0; j < nNodes; ++j)
         {
-            element->_nodes[j]->addElement(element);
+            if (isMeshNode(element->_nodes[j]))
+            {
+                offsets[element->_nodes[j]->getID() + 1]++;
+            }
         }
     }
-}
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-void Mesh::resetElementsConnectedToNodes()
-{
-    for (auto& node : _nodes)
+    _node_elements = std::vector<Element*>(offsets.back());
+    std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+    for (auto* element : _elements)
     {
-        if (node)
+        const unsigned nNodes(element->getNumberOfNodes());
+        for (unsigned j = 0; j < nNodes; ++j)
         {
-            node->clearElements();
+            if (isMeshNode(element->_nodes[j]))
+            {
+                _node_elements[positions[element->_nodes[j]->getID()]++] =
+                    element;
+            }
         }
     }
+
+    for (std::size_t i = 0; i < n_nodes; ++i)
+    {
+        if (_nodes[i])
+        {
+            _nodes[i]->setElements({_node_elements.data() + offsets[i],
+                                    offsets[i + 1] - offsets[i]});
+        }
+    }
+}
+
+void Mesh::resetElementsConnectedToNodes()
+{
     this->setElementsConnectedToNodes();
 }
 
@@ -229,7 +272,7 @@ void Mesh::setElementNeighbors()
         const std::size_t nNodes (element->getNumberOfBaseNodes());
         for (unsigned n(0); n<nNodes; ++n)
         {
-            std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
+            auto const conn_elems = element->getNode(n)->getElements();
             neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
         }
         std::sort(neighbors.begin(), neighbors.end());
@@ -250,11 +293,13 @@ void Mesh::setElementNeighbors()
 void Mesh::setNodesConnectedByEdges()
 {
     const std::size_t nNodes (this->_nodes.size());
+    std::vector<std::size_t> offsets(nNodes + 1, 0);
+    _node_connected_nodes.clear();
     for (unsigned i=0; i<nNodes; ++i)
     {
         MeshLib::Node* node (_nodes[i]);
         std::vector<MeshLib::Node*> conn_set;
-        const std::vector<MeshLib::Element*> &conn_elems (node->getElements());
+        auto const conn_elems = node->getElements();
         const std::size_t nConnElems (conn_elems.size());
         for (unsigned j=0; j<nConnElems; ++j)
         {
@@ -317,40 +362,72 @@ void Mesh::setNodesConnectedByEdges()
 
             }
         }
-        node->setConnectedNodes(conn_set);
+        _node_connected_nodes.insert(_node_connected_nodes.end(),
+                                     conn_set.begin(), conn_set.end());
+        offsets[i + 1] = _node_connected_nodes.size();
+    }
+    _node_connected_nodes.shrink_to_fit();
+
+    for (std::size_t i = 0; i < nNodes; ++i)
+    {
+        _nodes[i]->setConnectedNodes(
+            {_node_connected_nodes.data() + offsets[i],
+             offsets[i + 1] - offsets[i]});
     }
 }
 
 void Mesh::setNodesConnectedByElements()
 {
-    // Allocate temporary space for adjacent nodes.
-    std::vector<Node*> adjacent_nodes;
-    for (Node* const node : _nodes)
-    {
+    // Collects the nodes of all elements of the given node, sorted by their
+    // ids and unique.
+    auto collectConnectedNodes = [](Node const& node,
+                                    std::vector<Node*>& adjacent_nodes) {
         adjacent_nodes.clear();
-
-        // Get all elements, to which this node is connected.
-        std::vector<Element*> const& conn_elems = node->getElements();
-
-        // And collect all elements' nodes.
-        for (Element const* const element : conn_elems)
+        for (Element const* const element : node.getElements())
         {
             Node* const* const single_elem_nodes = element->getNodes();
             std::size_t const nnodes = element->getNumberOfNodes();
-            for (std::size_t n = 0; n < nnodes; n++)
-            {
-                adjacent_nodes.push_back(single_elem_nodes[n]);
-            }
+            adjacent_nodes.insert(adjacent_nodes.end(), single_elem_nodes,
+                                  single_elem_nodes + nnodes);
         }
-
-        // Make nodes unique and sorted by their ids.
-        // This relies on the node's id being equivalent to it's address.
         std::sort(adjacent_nodes.begin(), adjacent_nodes.end(),
-            [](Node* a, Node* b) { return a->getID() < b->getID(); });
-        auto const last = std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
-        adjacent_nodes.erase(last, adjacent_nodes.end());
+                  [](Node* a, Node* b) { return a->getID() < b->getID(); });
+        adjacent_nodes.erase(
+            std::unique(adjacent_nodes.begin(), adjacent_nodes.end()),
+            adjacent_nodes.end());
+    };
+
+    // The connected nodes are collected twice, first to count them, then to
+    // store them node by node in one array. The nodes are processed in
+    // parallel in both passes; only the part of the node itself is written.
+    auto const n_nodes = static_cast<std::ptrdiff_t>(_nodes.size());
+    std::vector<std::size_t> offsets(_nodes.size() + 1, 0);
+#pragma omp parallel
+    {
+        std::vector<Node*> adjacent_nodes;
+#pragma omp for schedule(static, 1024)
+        for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+        {
+            collectConnectedNodes(*_nodes[i], adjacent_nodes);
+            offsets[i + 1] = adjacent_nodes.size();
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-        node->setConnectedNodes(adjacent_nodes);
+    _node_connected_nodes = std::vector<Node*>(offsets.back());
+#pragma omp parallel
+    {
+        std::vector<Node*> adjacent_nodes;
+#pragma omp for schedule(static, 1024)
+        for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+        {
+            collectConnectedNodes(*_nodes[i], adjacent_nodes);
+            std::copy(adjacent_nodes.begin(), adjacent_nodes.end(),
+                      _node_connected_nodes.begin() + offsets[i]);
+            _nodes[i]->setConnectedNodes(
+                {_node_connected_nodes.data() + offsets[i],
+                 adjacent_nodes.size()});
+        }
     }
 }
 
@@ -383,6 +460,21 @@ bool Mesh::hasNonlinearElement() const
         });
 }
 
+void sortMeshIDs(std::vector<std::unique_ptr<Mesh>>& meshes)
+{
+    std::vector<std::size_t> ids;
+    ids.reserve(meshes.size());
+    for (auto const& mesh : meshes)
+    {
+        ids.push_back(mesh->_id);
+    }
+    std::sort(ids.begin(), ids.end());
+    for (std::size_t i = 0; i < meshes.size(); ++i)
+    {
+        meshes[i]->_id = ids[i];
+    }
+}
+
 void scaleMeshPropertyVector(MeshLib::Mesh & mesh,
                              std::string const& property_name,
                              double factor)
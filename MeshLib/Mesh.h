@@ -23,6 +23,7 @@
 #include "BaseLib/Error.h"
 
 #include "MeshEnums.h"
+#include "MeshItemArena.h"
 #include "Properties.h"
 
 namespace ApplicationUtils
@@ -45,6 +46,8 @@ class Mesh : BaseLib::Counter<Mesh>
 
     friend class ApplicationUtils::NodeWiseMeshPartitioner;
 
+    friend void sortMeshIDs(std::vector<std::unique_ptr<Mesh>>& meshes);
+
 public:
     /// Constructor using a mesh name and an array of nodes and elements
     /// @param name          Mesh name.
@@ -57,13 +60,18 @@ public:
     ///                      parameter for nonlinear case.  If the parameter is
     ///                      set to zero, we consider there are no nonlinear
     ///                      nodes.
+    /// @param arena         Optional storage of (some of) the nodes and
+    ///                      elements. The items stored in the arena are
+    ///                      released together with it instead of being
+    ///                      deleted one by one.
     Mesh(std::string name,
          std::vector<Node*>
              nodes,
          std::vector<Element*>
              elements,
-         Properties const& properties = Properties(),
-         const std::size_t n_base_nodes = 0);
+         Properties properties = Properties(),
+         const std::size_t n_base_nodes = 0,
+         std::unique_ptr<MeshItemArena> arena = nullptr);
 
     /// Copy constructor
     Mesh(const Mesh &mesh);
@@ -74,7 +82,8 @@ public:
     /// Add a node to the mesh.
     void addNode(Node* node);
 
-    /// Add an element to the mesh.
+    /// Add an element to the mesh. The elements and nodes connected to the
+    /// nodes are rebuilt for the whole mesh.
     void addElement(Element* elem);
 
     /// Returns the dimension of the mesh (determined by the maximum dimension over all elements).
@@ -154,6 +163,9 @@ protected:
     void setDimension();
 
     /// Fills in the neighbor-information for nodes (i.e. which element each node belongs to).
+    /// The elements of all nodes are stored in one array, node by node, and
+    /// each node gets a view on its part. Only nodes of this mesh are
+    /// considered, i.e. nodes with ids matching their position.
     void setElementsConnectedToNodes();
 
     /// Fills in the neighbor-information for elements.
@@ -172,7 +184,7 @@ protected:
     /// Check if the mesh contains any nonlinear element
     bool hasNonlinearElement() const;
 
-    std::size_t const _id;
+    std::size_t _id;
     unsigned _mesh_dimension;
     /// The minimal and maximal edge length over all elements in the mesh
     std::pair<double, double> _edge_length;
@@ -185,6 +197,17 @@ protected:
     Properties _properties;
 
     bool _is_axially_symmetric = false;
+
+    /// The elements connected to each node, stored node by node. The nodes'
+    /// Node::getElements() are views on this array.
+    std::vector<Element*> _node_elements;
+    /// The nodes connected to each node, stored node by node. The nodes'
+    /// Node::getConnectedNodes() are views on this array.
+    std::vector<Node*> _node_connected_nodes;
+
+    /// Storage of the nodes and elements created in bulk, e.g. by the
+    /// VtkMeshConverter.
+    std::unique_ptr<MeshItemArena> _arena;
 }; /* class */
 
 
@@ -199,6 +222,11 @@ inline bool operator!=(Mesh const& a, Mesh const& b)
     return !(a == b);
 }
 
+/// Reassigns the ids of the given meshes in ascending order of their
+/// positions, e.g. after the meshes were constructed concurrently. The set of
+/// ids is kept.
+void sortMeshIDs(std::vector<std::unique_ptr<Mesh>>& meshes);
+
 /// Scales the mesh property with name \c property_name by given \c factor.
 /// \note The property must be a "double" property.
 void scaleMeshPropertyVector(MeshLib::Mesh& mesh,
@@ -14,8 +14,12 @@
 
 #include "VtkMeshConverter.h"
 
+#include <memory>
+#include <new>
+
 #include "MeshLib/Elements/Elements.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshItemArena.h"
 #include "MeshLib/Node.h"
 
 // Conversion from Image to QuadMesh
@@ -34,6 +38,7 @@
 // Conversion from vtkUnstructuredGrid
 #include <vtkCell.h>
 #include <vtkCellData.h>
+#include <vtkCellType.h>
 #include <vtkUnsignedIntArray.h>
 #include <vtkUnstructuredGrid.h>
 
@@ -41,241 +46,270 @@ namespace MeshLib
 {
 namespace detail
 {
-template <class T_ELEMENT>
-MeshLib::Element* createElementWithSameNodeOrder(
-    const std::vector<MeshLib::Node*>& nodes, vtkIdList* const node_ids,
-    std::size_t const element_id)
+// The positions of the element nodes in the VTK cells that number their nodes
+// differently from the elements.
+constexpr unsigned pixel_node_order[] = {0, 1, 3, 2};
+constexpr unsigned voxel_node_order[] = {0, 1, 3, 2, 4, 5, 7, 6};
+constexpr unsigned wedge_node_order[] = {3, 4, 5, 0, 1, 2};
+constexpr unsigned quadratic_wedge_node_order[] = {3,  4,  5,  0,  1,
+                                                   2,  8,  7,  6,  12,
+                                                   14, 13, 11, 10, 9};
+
+/// Calls \c f with a null pointer of the element type corresponding to the
+/// given VTK cell type and with the node order of the cell, which is nullptr
+/// if the element and the cell number their nodes alike. Returns false for
+/// unknown cell types.
+template <typename Function>
+bool visitElementType(int const cell_type, Function&& f)
+{
+    switch (cell_type)
+    {
+        case VTK_VERTEX:
+            f(static_cast<MeshLib::Point*>(nullptr), nullptr);
+            return true;
+        case VTK_LINE:
+            f(static_cast<MeshLib::Line*>(nullptr), nullptr);
+            return true;
+        case VTK_TRIANGLE:
+            f(static_cast<MeshLib::Tri*>(nullptr), nullptr);
+            return true;
+        case VTK_QUAD:
+            f(static_cast<MeshLib::Quad*>(nullptr), nullptr);
+            return true;
+        case VTK_PIXEL:
+            f(static_cast<MeshLib::Quad*>(nullptr), pixel_node_order);
+            return true;
+        case VTK_TETRA:
+            f(static_cast<MeshLib::Tet*>(nullptr), nullptr);
+            return true;
+        case VTK_HEXAHEDRON:
+            f(static_cast<MeshLib::Hex*>(nullptr), nullptr);
+            return true;
+        case VTK_VOXEL:
+            f(static_cast<MeshLib::Hex*>(nullptr), voxel_node_order);
+            return true;
+        case VTK_PYRAMID:
+            f(static_cast<MeshLib::Pyramid*>(nullptr), nullptr);
+            return true;
+        case VTK_WEDGE:
+            f(static_cast<MeshLib::Prism*>(nullptr), wedge_node_order);
+            return true;
+        case VTK_QUADRATIC_EDGE:
+            f(static_cast<MeshLib::Line3*>(nullptr), nullptr);
+            return true;
+        case VTK_QUADRATIC_TRIANGLE:
+            f(static_cast<MeshLib::Tri6*>(nullptr), nullptr);
+            return true;
+        case VTK_QUADRATIC_QUAD:
+            f(static_cast<MeshLib::Quad8*>(nullptr), nullptr);
+            return true;
+        case VTK_BIQUADRATIC_QUAD:
+            f(static_cast<MeshLib::Quad9*>(nullptr), nullptr);
+            return true;
+        case VTK_QUADRATIC_TETRA:
+            f(static_cast<MeshLib::Tet10*>(nullptr), nullptr);
+            return true;
+        case VTK_QUADRATIC_HEXAHEDRON:
+            f(static_cast<MeshLib::Hex20*>(nullptr), nullptr);
+            return true;
+        case VTK_QUADRATIC_PYRAMID:
+            f(static_cast<MeshLib::Pyramid13*>(nullptr), nullptr);
+            return true;
+        case VTK_QUADRATIC_WEDGE:
+            f(static_cast<MeshLib::Prism15*>(nullptr),
+              quadratic_wedge_node_order);
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Memory for all elements of one VTK cell type and for their node and
+/// neighbor arrays.
+struct ElementBlock
+{
+    void* elements = nullptr;
+    MeshLib::Node** nodes = nullptr;
+    MeshLib::Element** neighbors = nullptr;
+};
+
+template <typename ElementType>
+ElementBlock allocateElementBlock(ElementType* /*element_type*/,
+                                  MeshLib::MeshItemArena& arena,
+                                  std::size_t const n)
+{
+    return {arena.allocate<ElementType>(n),
+            arena.allocate<MeshLib::Node*>(n * ElementType::n_all_nodes),
+            arena.allocate<MeshLib::Element*>(n * ElementType::n_neighbors)};
+}
+
+/// Constructs the element at the given position in its block from the nodes
+/// of the cell.
+template <typename ElementType>
+MeshLib::Element* createElement(ElementType* /*element_type*/,
+                                ElementBlock const& block,
+                                std::size_t const position,
+                                std::vector<MeshLib::Node*> const& nodes,
+                                vtkIdList* const node_ids,
+                                unsigned const* const node_order,
+                                std::size_t const element_id)
 {
-    auto** ele_nodes = new MeshLib::Node*[T_ELEMENT::n_all_nodes];
-    for (unsigned k(0); k < T_ELEMENT::n_all_nodes; k++)
+    auto** const element_nodes =
+        block.nodes + position * ElementType::n_all_nodes;
+    for (unsigned k = 0; k < ElementType::n_all_nodes; k++)
     {
-        ele_nodes[k] = nodes[node_ids->GetId(k)];
+        element_nodes[k] =
+            nodes[node_ids->GetId(node_order ? node_order[k] : k)];
     }
-    return new T_ELEMENT(ele_nodes, element_id);
+    auto* const element = static_cast<ElementType*>(block.elements) + position;
+    return new (element) ElementType(
+        element_nodes, block.neighbors + position * ElementType::n_neighbors,
+        element_id);
 }
 }  // namespace detail
 
 MeshLib::Mesh* VtkMeshConverter::convertUnstructuredGrid(
-    vtkUnstructuredGrid* grid, std::string const& mesh_name)
+    vtkUnstructuredGrid* grid, std::string const& mesh_name,
+    bool const release_grid_data)
 {
     if (!grid)
     {
         return nullptr;
     }
 
+    // The cells are counted per type before anything is allocated. Each
+    // element gets its position in the block of its type.
+    auto const nElems = static_cast<std::ptrdiff_t>(grid->GetNumberOfCells());
+    std::vector<std::size_t> positions(nElems);
+    std::vector<std::size_t> n_cells_of_type(VTK_NUMBER_OF_CELL_TYPES, 0);
+    for (std::ptrdiff_t i = 0; i < nElems; i++)
+    {
+        int const cell_type = grid->GetCellType(i);
+        if (!detail::visitElementType(cell_type,
+                                      [](auto* /*element_type*/,
+                                         unsigned const* /*node_order*/) {}))
+        {
+            ERR("VtkMeshConverter::convertUnstructuredGrid(): Unknown mesh "
+                "element type '%d'.",
+                cell_type);
+            return nullptr;
+        }
+        positions[i] = n_cells_of_type[cell_type]++;
+    }
+
+    // The data arrays are converted first, such that the copies of the arrays
+    // can be released one by one before the nodes and elements are created.
+    MeshLib::Properties properties;
+    convertScalarArrays(*grid, properties, release_grid_data);
+
+    // The nodes and the elements of each type are stored in one block of
+    // memory owned by the mesh instead of being allocated one by one.
+    auto arena = std::make_unique<MeshLib::MeshItemArena>();
+
+    // The nodes and elements are created in parallel; the grid is only read.
+    // If called within a parallel region, e.g. while several meshes are read
+    // concurrently, the loops run sequentially.
+
     // set mesh nodes
-    const std::size_t nNodes = grid->GetPoints()->GetNumberOfPoints();
+    vtkPoints* const points = grid->GetPoints();
+    auto const nNodes =
+        static_cast<std::ptrdiff_t>(points->GetNumberOfPoints());
+    auto* const node_block = arena->allocate<MeshLib::Node>(nNodes);
     std::vector<MeshLib::Node*> nodes(nNodes);
-    double* coords = nullptr;
-    for (std::size_t i = 0; i < nNodes; i++)
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < nNodes; i++)
     {
-        coords = grid->GetPoints()->GetPoint(i);
-        nodes[i] = new MeshLib::Node(coords[0], coords[1], coords[2], i);
+        double coords[3];
+        points->GetPoint(i, coords);
+        nodes[i] = new (node_block + i)
+            MeshLib::Node(coords[0], coords[1], coords[2], i);
+    }
+    if (release_grid_data)
+    {
+        grid->SetPoints(nullptr);
     }
 
     // set mesh elements
-    const std::size_t nElems = grid->GetNumberOfCells();
-    std::vector<MeshLib::Element*> elements(nElems);
-    auto node_ids = vtkSmartPointer<vtkIdList>::New();
-    for (std::size_t i = 0; i < nElems; i++)
+    std::vector<detail::ElementBlock> blocks(VTK_NUMBER_OF_CELL_TYPES);
+    for (int cell_type = 0; cell_type < VTK_NUMBER_OF_CELL_TYPES; ++cell_type)
     {
-        MeshLib::Element* elem;
-        grid->GetCellPoints(i, node_ids);
-
-        int cell_type = grid->GetCellType(i);
-        switch (cell_type)
+        auto const n = n_cells_of_type[cell_type];
+        if (n == 0)
         {
-            case VTK_VERTEX:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Point>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_LINE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Line>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_TRIANGLE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tri>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUAD:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Quad>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_PIXEL:
-            {
-                auto** quad_nodes = new MeshLib::Node*[4];
-                quad_nodes[0] = nodes[node_ids->GetId(0)];
-                quad_nodes[1] = nodes[node_ids->GetId(1)];
-                quad_nodes[2] = nodes[node_ids->GetId(3)];
-                quad_nodes[3] = nodes[node_ids->GetId(2)];
-                elem = new MeshLib::Quad(quad_nodes, i);
-                break;
-            }
-            case VTK_TETRA:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tet>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_HEXAHEDRON:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Hex>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_VOXEL:
-            {
-                auto** voxel_nodes = new MeshLib::Node*[8];
-                voxel_nodes[0] = nodes[node_ids->GetId(0)];
-                voxel_nodes[1] = nodes[node_ids->GetId(1)];
-                voxel_nodes[2] = nodes[node_ids->GetId(3)];
-                voxel_nodes[3] = nodes[node_ids->GetId(2)];
-                voxel_nodes[4] = nodes[node_ids->GetId(4)];
-                voxel_nodes[5] = nodes[node_ids->GetId(5)];
-                voxel_nodes[6] = nodes[node_ids->GetId(7)];
-                voxel_nodes[7] = nodes[node_ids->GetId(6)];
-                elem = new MeshLib::Hex(voxel_nodes, i);
-                break;
-            }
-            case VTK_PYRAMID:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Pyramid>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_WEDGE:
-            {
-                auto** prism_nodes = new MeshLib::Node*[6];
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[j] = nodes[node_ids->GetId(j + 3)];
-                    prism_nodes[j + 3] = nodes[node_ids->GetId(j)];
-                }
-                elem = new MeshLib::Prism(prism_nodes, i);
-                break;
-            }
-            case VTK_QUADRATIC_EDGE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Line3>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_TRIANGLE:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tri6>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_QUAD:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Quad8>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_BIQUADRATIC_QUAD:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Quad9>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_TETRA:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Tet10>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_HEXAHEDRON:
-            {
-                elem = detail::createElementWithSameNodeOrder<MeshLib::Hex20>(
-                    nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_PYRAMID:
-            {
-                elem =
-                    detail::createElementWithSameNodeOrder<MeshLib::Pyramid13>(
-                        nodes, node_ids, i);
-                break;
-            }
-            case VTK_QUADRATIC_WEDGE:
-            {
-                auto** prism_nodes = new MeshLib::Node*[15];
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[j] = nodes[node_ids->GetId(j + 3)];
-                    prism_nodes[j + 3] = nodes[node_ids->GetId(j)];
-                }
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[6 + j] = nodes[node_ids->GetId(8 - j)];
-                }
-                prism_nodes[9] = nodes[node_ids->GetId(12)];
-                prism_nodes[10] = nodes[node_ids->GetId(14)];
-                prism_nodes[11] = nodes[node_ids->GetId(13)];
-                for (unsigned j = 0; j < 3; ++j)
-                {
-                    prism_nodes[12 + j] = nodes[node_ids->GetId(11 - j)];
-                }
-                elem = new MeshLib::Prism15(prism_nodes, i);
-                break;
-            }
-            default:
-                ERR("VtkMeshConverter::convertUnstructuredGrid(): Unknown mesh "
-                    "element type '%d'.",
-                    cell_type);
-                return nullptr;
+            continue;
         }
-
-        elements[i] = elem;
+        detail::visitElementType(
+            cell_type,
+            [&](auto* element_type, unsigned const* /*node_order*/) {
+                blocks[cell_type] =
+                    detail::allocateElementBlock(element_type, *arena, n);
+            });
     }
 
-    MeshLib::Mesh* mesh = new MeshLib::Mesh(mesh_name, nodes, elements);
-    convertScalarArrays(*grid, *mesh);
+    std::vector<MeshLib::Element*> elements(nElems);
+#pragma omp parallel
+    {
+        auto node_ids = vtkSmartPointer<vtkIdList>::New();
+#pragma omp for
+        for (std::ptrdiff_t i = 0; i < nElems; i++)
+        {
+            grid->GetCellPoints(i, node_ids);
+            int const cell_type = grid->GetCellType(i);
+            detail::visitElementType(
+                cell_type,
+                [&](auto* element_type, unsigned const* node_order) {
+                    elements[i] = detail::createElement(
+                        element_type, blocks[cell_type], positions[i], nodes,
+                        node_ids, node_order, i);
+                });
+        }
+    }
+    if (release_grid_data)
+    {
+        grid->Initialize();
+    }
 
-    return mesh;
+    return new MeshLib::Mesh(mesh_name, nodes, elements,
+                             std::move(properties), 0, std::move(arena));
 }
 
 void VtkMeshConverter::convertScalarArrays(vtkUnstructuredGrid& grid,
-                                           MeshLib::Mesh& mesh)
+                                           MeshLib::Properties& properties,
+                                           bool const release_grid_data)
 {
-    vtkPointData* point_data = grid.GetPointData();
-    auto const n_point_arrays =
-        static_cast<unsigned>(point_data->GetNumberOfArrays());
-    for (unsigned i = 0; i < n_point_arrays; ++i)
-    {
-        convertArray(*point_data->GetArray(i),
-                     mesh.getProperties(),
-                     MeshLib::MeshItemType::Node);
-    }
+    auto convert_arrays = [&](vtkFieldData& data, MeshLib::MeshItemType type) {
+        if (!release_grid_data)
+        {
+            auto const n_arrays = static_cast<int>(data.GetNumberOfArrays());
+            for (int i = 0; i < n_arrays; ++i)
+            {
+                if (auto* const array =
+                        vtkDataArray::SafeDownCast(data.GetAbstractArray(i)))
+                {
+                    convertArray(*array, properties, type);
+                }
+            }
+            return;
+        }
 
-    vtkCellData* cell_data = grid.GetCellData();
-    auto const n_cell_arrays =
-        static_cast<unsigned>(cell_data->GetNumberOfArrays());
-    for (unsigned i = 0; i < n_cell_arrays; ++i)
-    {
-        convertArray(*cell_data->GetArray(i),
-                     mesh.getProperties(),
-                     MeshLib::MeshItemType::Cell);
-    }
+        // Each array is removed from the grid right after its conversion;
+        // the grid holds the last reference to it, so at most one array is
+        // stored twice at a time.
+        while (data.GetNumberOfArrays() > 0)
+        {
+            if (auto* const array =
+                    vtkDataArray::SafeDownCast(data.GetAbstractArray(0)))
+            {
+                convertArray(*array, properties, type);
+            }
+            data.RemoveArray(0);
+        }
+    };
 
-    vtkFieldData* field_data = grid.GetFieldData();
-    auto const n_field_arrays =
-        static_cast<unsigned>(field_data->GetNumberOfArrays());
-    for (unsigned i = 0; i < n_field_arrays; ++i)
-    {
-        convertArray(
-            *vtkDataArray::SafeDownCast(field_data->GetAbstractArray(i)),
-            mesh.getProperties(),
-            MeshLib::MeshItemType::IntegrationPoint);
-    }
+    convert_arrays(*grid.GetPointData(), MeshLib::MeshItemType::Node);
+    convert_arrays(*grid.GetCellData(), MeshLib::MeshItemType::Cell);
+    convert_arrays(*grid.GetFieldData(),
+                   MeshLib::MeshItemType::IntegrationPoint);
 }
 
 void VtkMeshConverter::convertArray(vtkDataArray& array,
@@ -40,14 +40,22 @@ class Properties;
 class VtkMeshConverter
 {
 public:
-    /// Converts a vtkUnstructuredGrid object to a Mesh
+    /// Converts a vtkUnstructuredGrid object to a Mesh.
+    /// The nodes and the elements of each cell type are allocated in one
+    /// block each, which is owned by the mesh, see MeshLib::MeshItemArena.
+    /// If \c release_grid_data is set, the data arrays, points and cells are
+    /// removed from the grid as soon as they are converted, which lowers the
+    /// peak memory usage if the grid is not referenced elsewhere. The grid is
+    /// empty afterwards.
     static MeshLib::Mesh* convertUnstructuredGrid(
         vtkUnstructuredGrid* grid,
-        std::string const& mesh_name = "vtkUnstructuredGrid");
+        std::string const& mesh_name = "vtkUnstructuredGrid",
+        bool const release_grid_data = false);
 
 private:
     static void convertScalarArrays(vtkUnstructuredGrid& grid,
-                                    MeshLib::Mesh& mesh);
+                                    MeshLib::Properties& properties,
+                                    bool const release_grid_data);
 
     static std::vector<MeshLib::Node*> createNodeVector(
         std::vector<double> const& elevation,
@@ -113,11 +121,8 @@ private:
                  array_name);
             return;
         }
-        vec->reserve(nTuples * nComponents);
         auto* data_array = static_cast<T*>(array.GetVoidPointer(0));
-        std::copy(&data_array[0],
-                  &data_array[nTuples * nComponents],
-                  std::back_inserter(*vec));
+        vec->assign(&data_array[0], &data_array[nTuples * nComponents]);
         return;
     }
 };
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace MeshLib
+{
+/// Storage for many mesh items of the same type in few allocations.
+///
+/// The arena hands out uninitialized blocks of memory, in which the items are
+/// constructed by placement new. The blocks are released together with the
+/// arena, the destructors of the items are not called. Therefore, only items
+/// that own no other memory than that of the arena may be stored, e.g. nodes
+/// and elements whose node and neighbor arrays are allocated from the same
+/// arena.
+class MeshItemArena
+{
+public:
+    /// Returns uninitialized memory for \c n objects of type \c T.
+    template <typename T>
+    T* allocate(std::size_t const n)
+    {
+        // Memory returned by operator new[] is suitably aligned for all
+        // types with fundamental alignment.
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "Over-aligned types are not supported.");
+        std::size_t const size = n * sizeof(T);
+        // Not std::make_unique, which would zero the memory.
+        _blocks.push_back({std::unique_ptr<char[]>(new char[size]), size});
+        return reinterpret_cast<T*>(_blocks.back().data.get());
+    }
+
+    /// Returns true if \c item lies in one of the blocks of the arena.
+    bool contains(void const* const item) const
+    {
+        auto const* const p = static_cast<char const*>(item);
+        for (auto const& block : _blocks)
+        {
+            auto const* const begin = block.data.get();
+            // std::less gives a total order also for pointers into
+            // unrelated arrays.
+            if (!std::less<char const*>()(p, begin) &&
+                std::less<char const*>()(p, begin + block.size))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Block
+    {
+        std::unique_ptr<char[]> data;
+        std::size_t size;
+    };
+
+    std::vector<Block> _blocks;
+};
+}  // namespace MeshLib
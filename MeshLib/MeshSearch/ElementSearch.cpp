@@ -82,7 +82,7 @@ std::size_t ElementSearch::searchByNodeIDs(const std::vector<std::size_t> &nodes
     for (std::size_t node_id : nodes)
     {
         auto const& elements = _mesh.getNode(node_id)->getElements();
-        std::transform(begin(elements), end(elements),
+        std::transform(elements.begin(), elements.end(),
                        back_inserter(connected_elements),
                        [](Element const* const e) { return e->getID(); });
     }
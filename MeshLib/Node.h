@@ -30,6 +30,33 @@ namespace MeshLib {
 
 class Element;
 
+/// A view on the mesh items adjacent to a node. The items are stored node by
+/// node in one array owned by the mesh the node belongs to.
+template <typename Item>
+class AdjacentItems
+{
+public:
+    AdjacentItems() = default;
+    AdjacentItems(Item* const* begin, std::size_t size)
+        : _begin(begin), _size(size)
+    {
+    }
+
+    Item* const* begin() const { return _begin; }
+    Item* const* end() const { return _begin + _size; }
+    Item* const* cbegin() const { return _begin; }
+    Item* const* cend() const { return _begin + _size; }
+
+    Item* operator[](std::size_t i) const { return _begin[i]; }
+
+    std::size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+private:
+    Item* const* _begin = nullptr;
+    std::size_t _size = 0;
+};
+
 /**
  * A mesh node with coordinates in 3D space.
  */
@@ -58,13 +85,13 @@ public:
     Node(const Node &node);
 
     /// Return all the nodes connected to this one
-    const std::vector<MeshLib::Node*>& getConnectedNodes() const { return _connected_nodes; }
+    AdjacentItems<Node> getConnectedNodes() const { return _connected_nodes; }
 
     /// Get an element the node is part of.
     const Element* getElement(std::size_t idx) const { return _elements[idx]; }
 
     /// Get all elements the node is part of.
-    const std::vector<Element*>& getElements() const { return _elements; }
+    AdjacentItems<Element> getElements() const { return _elements; }
 
     /// Get number of elements the node is part of.
     std::size_t getNumberOfElements() const { return _elements.size(); }
@@ -80,19 +107,14 @@ protected:
     /// This method automatically also updates the areas/volumes of all connected elements.
     void updateCoordinates(double x, double y, double z);
 
-    /**
-     * Add an element the node is part of.
-     * This method is called by Mesh::addElement(Element*), see friend definition.
-     */
-    void addElement(Element* elem) { _elements.push_back(elem); }
-
-    /// clear stored elements connecting to this node
-    void clearElements() { _elements.clear(); }
+    /// Sets the elements the node is part of. The elements are stored by the
+    /// mesh, see Mesh::setElementsConnectedToNodes().
+    void setElements(AdjacentItems<Element> elements) { _elements = elements; }
 
     /// Resets the connected nodes of this node. The connected nodes are
     /// generated by Mesh::setNodesConnectedByEdges() and
     /// Mesh::setNodesConnectedByElements().
-    void setConnectedNodes(std::vector<Node*> &connected_nodes)
+    void setConnectedNodes(AdjacentItems<Node> connected_nodes)
     {
         _connected_nodes = connected_nodes;
     }
@@ -100,8 +122,8 @@ protected:
     /// Sets the ID of a node to the given value.
     void setID(std::size_t id) { _id = id; }
 
-    std::vector<Node*> _connected_nodes;
-    std::vector<Element*> _elements;
+    AdjacentItems<Node> _connected_nodes;
+    AdjacentItems<Element> _elements;
 }; /* class */
 
 /// Returns true if the given node is a base node of a (first) element, or if it
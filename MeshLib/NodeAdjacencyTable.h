@@ -68,7 +68,7 @@ public:
 
         for (auto n_ptr : nodes)
         {
-            std::vector<Node*> const& connected_nodes = n_ptr->getConnectedNodes();
+            auto const connected_nodes = n_ptr->getConnectedNodes();
             std::vector<std::size_t>& row = _data[n_ptr->getID()];
             row.reserve(connected_nodes.size());
             std::transform(connected_nodes.cbegin(), connected_nodes.cend(),
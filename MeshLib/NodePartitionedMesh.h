@@ -39,23 +39,9 @@ public:
           _n_active_base_nodes(mesh.getNumberOfBaseNodes()),
           _n_active_nodes(mesh.getNumberOfNodes())
     {
-        const auto& mesh_nodes = mesh.getNodes();
         for (std::size_t i = 0; i < _nodes.size(); i++)
         {
             _global_node_ids[i] = _nodes[i]->getID();
-
-            // TODO To add copying of the connected nodes (and elements)
-            //      in the copy constructor of class Node in order to
-            //      drop the following lines.
-            auto node = _nodes[i];
-            // Copy constructor of Mesh does not copy the connected
-            // nodes to node.
-            if (node->_connected_nodes.size() == 0)
-            {
-                std::copy(mesh_nodes[i]->_connected_nodes.begin(),
-                          mesh_nodes[i]->_connected_nodes.end(),
-                          std::back_inserter(node->_connected_nodes));
-            }
         }
     }
 
@@ -13,6 +13,7 @@
  */
 #include "VtkMappedMeshSource.h"
 
+#include <cstdint>
 #include <vector>
 
 #include <vtkCellType.h>
@@ -87,6 +88,7 @@ int VtkMappedMeshSource::RequestData(vtkInformation* /*request*/,
     // Cells
     auto elems = _mesh->getElements();
     output->Allocate(elems.size());
+    std::vector<std::int64_t> node_ids;
     for (auto& cell : elems)
     {
         auto cellType = OGSToVtkCellType(cell->getCellType());
@@ -94,53 +96,26 @@ int VtkMappedMeshSource::RequestData(vtkInformation* /*request*/,
         const MeshLib::Element* const elem = cell;
         const unsigned numNodes(elem->getNumberOfNodes());
         const MeshLib::Node* const* nodes = cell->getNodes();
-        vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
-        ptIds->SetNumberOfIds(numNodes);
-
+        node_ids.resize(numNodes);
         for (unsigned i = 0; i < numNodes; ++i)
         {
-            ptIds->SetId(i, nodes[i]->getID());
+            node_ids[i] = nodes[i]->getID();
         }
+        OGSToVtkNodeOrder(cellType, node_ids.data());
 
-        if (cellType == VTK_WEDGE)
-        {
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                const auto prism_swap_id = ptIds->GetId(i);
-                ptIds->SetId(i, ptIds->GetId(i + 3));
-                ptIds->SetId(i + 3, prism_swap_id);
-            }
-        }
-        else if (cellType == VTK_QUADRATIC_WEDGE)
+        vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+        ptIds->SetNumberOfIds(numNodes);
+        for (unsigned i = 0; i < numNodes; ++i)
         {
-            std::array<vtkIdType, 15> ogs_nodeIds;
-            for (unsigned i = 0; i < 15; ++i)
-            {
-                ogs_nodeIds[i] = ptIds->GetId(i);
-            }
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                ptIds->SetId(i, ogs_nodeIds[i + 3]);
-                ptIds->SetId(i + 3, ogs_nodeIds[i]);
-            }
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                ptIds->SetId(6 + i, ogs_nodeIds[8 - i]);
-            }
-            for (unsigned i = 0; i < 3; ++i)
-            {
-                ptIds->SetId(9 + i, ogs_nodeIds[14 - i]);
-            }
-            ptIds->SetId(12, ogs_nodeIds[9]);
-            ptIds->SetId(13, ogs_nodeIds[11]);
-            ptIds->SetId(14, ogs_nodeIds[10]);
+            ptIds->SetId(i, node_ids[i]);
         }
 
         output->InsertNextCell(cellType, ptIds);
     }
 
     // Arrays
-    MeshLib::Properties const& properties = _mesh->getProperties();
+    MeshLib::Properties const& properties =
+        _properties ? *_properties : _mesh->getProperties();
     std::vector<std::string> const& propertyNames =
         properties.getPropertyVectorNames();
 
@@ -61,6 +61,15 @@ public:
     /// Returns the mesh.
     const MeshLib::Mesh* GetMesh() const { return _mesh; }
 
+    /// Sets properties which are mapped instead of the mesh's own properties,
+    /// e.g., a snapshot of them. Passing a nullptr resets to the mesh's
+    /// properties.
+    void SetProperties(MeshLib::Properties const* properties)
+    {
+        this->_properties = properties;
+        this->Modified();
+    }
+
 protected:
     VtkMappedMeshSource();
 
@@ -83,6 +92,7 @@ private:
                      std::string const& prop_name) const;
 
     const MeshLib::Mesh* _mesh;
+    MeshLib::Properties const* _properties = nullptr;
 
     int NumberOfDimensions{0};
     int NumberOfNodes{0};
@@ -10,6 +10,9 @@
 
 #include "VtkOGSEnum.h"
 
+#include <algorithm>
+#include <array>
+
 #include "BaseLib/Error.h"
 
 #include <vtkCellType.h>
@@ -110,4 +113,31 @@ int OGSToVtkCellType(MeshLib::CellType ogs)
     }
 }
 
-
+void OGSToVtkNodeOrder(int vtk_cell_type, std::int64_t* node_ids)
+{
+    if (vtk_cell_type == VTK_WEDGE)
+    {
+        std::swap_ranges(node_ids, node_ids + 3, node_ids + 3);
+    }
+    else if (vtk_cell_type == VTK_QUADRATIC_WEDGE)
+    {
+        std::array<std::int64_t, 15> ogs_node_ids;
+        std::copy_n(node_ids, 15, ogs_node_ids.begin());
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            node_ids[i] = ogs_node_ids[i + 3];
+            node_ids[i + 3] = ogs_node_ids[i];
+        }
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            node_ids[6 + i] = ogs_node_ids[8 - i];
+        }
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            node_ids[9 + i] = ogs_node_ids[14 - i];
+        }
+        node_ids[12] = ogs_node_ids[9];
+        node_ids[13] = ogs_node_ids[11];
+        node_ids[14] = ogs_node_ids[10];
+    }
+}
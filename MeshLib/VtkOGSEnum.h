@@ -10,8 +10,14 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "MeshEnums.h"
 
 MeshLib::CellType VtkCellTypeToOGS(int type);
 
 int OGSToVtkCellType(MeshLib::CellType ogs);
+
+/// Reorders the node ids of an element of the given VTK cell type in place
+/// from the OGS node order to the VTK node order.
+void OGSToVtkNodeOrder(int vtk_cell_type, std::int64_t* node_ids);
@@ -0,0 +1,163 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "SerialExecutor.h"
+
+namespace NumLib
+{
+/// Executor running the global assembly loops with OpenMP threads.
+///
+/// Only the loops calling a member function of a given object for each
+/// element of a container, i.e. executeMemberDereferenced() and
+/// executeSelectedMemberDereferenced(), are run in parallel. These are the
+/// loops used to call the global assembler for each local assembler. All
+/// other loops are inherited from the SerialExecutor, because they typically
+/// write to data shared between the local assemblers, e.g. secondary
+/// variables.
+///
+/// The called method may compute local contributions concurrently but must
+/// add them to shared global data only inside a scatter() call. Everything
+/// else it calls, e.g. parameters and Jacobian assemblers, must be safe to be
+/// called concurrently.
+///
+/// In deterministic mode (the default) the scatter() sections are executed in
+/// the order of the container's elements. The assembled global matrices and
+/// vectors are then bitwise identical to those of the SerialExecutor
+/// regardless of the number of threads. Otherwise the scatter() sections are
+/// only mutually exclusive, which avoids waiting for slow elements but makes
+/// the summation order depend on the thread scheduling.
+struct ParallelExecutor : public SerialExecutor
+{
+    /// Switches between ordered (deterministic) and unordered scatter.
+    static inline bool deterministic = true;
+
+    /// Parallel version of SerialExecutor::executeMemberDereferenced().
+    ///
+    /// Exceptions thrown by \c method are caught inside the parallel region;
+    /// the first one is rethrown after all threads have finished.
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeMemberDereferenced(Object& object, Method method,
+                                          Container const& container,
+                                          Args&&... args)
+    {
+        auto const n = static_cast<std::ptrdiff_t>(container.size());
+        std::exception_ptr exception;
+
+#pragma omp parallel for schedule(dynamic) ordered
+        for (std::ptrdiff_t i = 0; i < n; i++)
+        {
+            try
+            {
+                (object.*method)(i, *container[i], std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+#pragma omp critical(ogs_parallel_executor_exception)
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// Parallel version of
+    /// SerialExecutor::executeSelectedMemberDereferenced().
+    ///
+    /// \see executeMemberDereferenced()
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeSelectedMemberDereferenced(
+        Object& object, Method method, Container const& container,
+        std::vector<std::size_t> const& active_container_ids, Args&&... args)
+    {
+        if (active_container_ids.empty())
+        {
+            executeMemberDereferenced(object, method, container,
+                                      std::forward<Args>(args)...);
+            return;
+        }
+
+        auto const n = static_cast<std::ptrdiff_t>(active_container_ids.size());
+        std::exception_ptr exception;
+
+#pragma omp parallel for schedule(dynamic) ordered
+        for (std::ptrdiff_t i = 0; i < n; i++)
+        {
+            try
+            {
+                auto const id = active_container_ids[i];
+                (object.*method)(id, *container[id],
+                                 std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+#pragma omp critical(ogs_parallel_executor_exception)
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// Calls \c f such that no other thread of the current parallel loop is
+    /// running a scatter() section at the same time.
+    ///
+    /// Outside of a parallel region \c f is called directly.
+    template <typename F>
+    static void scatter(F const& f)
+    {
+#ifdef _OPENMP
+        if (!omp_in_parallel())
+        {
+            f();
+            return;
+        }
+
+        if (deterministic)
+        {
+#pragma omp ordered
+            f();
+        }
+        else
+        {
+#pragma omp critical(ogs_parallel_executor_scatter)
+            f();
+        }
+#else
+        f();
+#endif
+    }
+};
+
+}  // namespace NumLib
@@ -107,10 +107,9 @@ struct SerialExecutor
             return;
         }
 
-        for (std::size_t i = 0; i < active_container_ids.size(); i++)
+        for (auto const id : active_container_ids)
         {
-            (object.*method)(i, *container[active_container_ids[i]],
-                             std::forward<Args>(args)...);
+            (object.*method)(id, *container[id], std::forward<Args>(args)...);
         }
     }
 
@@ -162,10 +161,9 @@ struct SerialExecutor
             return;
         }
 
-        for (std::size_t i = 0; i < active_container_ids.size(); i++)
+        for (auto const id : active_container_ids)
         {
-            ((*container[active_container_ids[i]]).*method)(
-                i, std::forward<Args>(args)...);
+            ((*container[id]).*method)(id, std::forward<Args>(args)...);
         }
     }
 
@@ -197,6 +195,16 @@ struct SerialExecutor
             f(i, *c[i], data[i], std::forward<Args_>(args)...);
         }
     }
+
+    /// Calls \c f, which adds local contributions to shared global data.
+    ///
+    /// Serial counterpart of ParallelExecutor::scatter(); methods called via
+    /// executeMemberDereferenced() use it to be usable with both executors.
+    template <typename F>
+    static void scatter(F const& f)
+    {
+        f();
+    }
 };
 
 }  // namespace NumLib
@@ -10,8 +10,14 @@
 
 #include "ComputeSparsityPattern.h"
 
+#include <algorithm>
+#include <cstddef>
+
+#include "DOFTableUtil.h"
 #include "LocalToGlobalIndexMap.h"
-#include "MeshLib/NodeAdjacencyTable.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
 
 #ifdef USE_PETSC
 #include "MeshLib/NodePartitionedMesh.h"
@@ -35,9 +41,6 @@ GlobalSparsityPattern computeSparsityPatternPETSc(
 GlobalSparsityPattern computeSparsityPatternNonPETSc(
     NumLib::LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
 {
-    MeshLib::NodeAdjacencyTable node_adjacency_table;
-    node_adjacency_table.createTable(mesh.getNodes());
-
     // A mapping   mesh node id -> global indices
     // It acts as a cache for dof table queries.
     std::vector<std::vector<GlobalIndexType>> global_idcs;
@@ -55,9 +58,9 @@ GlobalSparsityPattern computeSparsityPatternNonPETSc(
     for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
     {
         unsigned n_connected_dof = 0;
-        for (auto an : node_adjacency_table.getAdjacentNodes(n))
+        for (auto const* an : mesh.getNode(n)->getConnectedNodes())
         {
-            n_connected_dof += global_idcs[an].size();
+            n_connected_dof += global_idcs[an->getID()].size();
         }
         for (auto global_index : global_idcs[n])
         {
@@ -81,4 +84,79 @@ GlobalSparsityPattern computeSparsityPattern(
 #endif
 }
 
+#ifndef USE_PETSC
+GlobalCompressedSparsityPattern computeCompressedSparsityPattern(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
+{
+    auto const n_rows = dof_table.dofSizeWithGhosts();
+    auto const& nodes = mesh.getNodes();
+    auto const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+
+    // Each mesh node owns its own global indices, hence the rows of different
+    // nodes are filled independently.
+    std::vector<std::vector<GlobalIndexType>> row_columns(n_rows);
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (std::ptrdiff_t n = 0; n < n_nodes; ++n)
+    {
+        MeshLib::Location const l(mesh.getID(), MeshLib::MeshItemType::Node,
+                                  static_cast<std::size_t>(n));
+        auto const rows = dof_table.getGlobalIndices(l);
+        if (rows.empty())
+        {
+            continue;
+        }
+
+        for (auto const* const element : nodes[n]->getElements())
+        {
+            auto const& element_indices =
+                getIndices(element->getID(), dof_table);
+
+            for (auto const row : rows)
+            {
+                // The row's component might not be defined on this element.
+                if (std::find(element_indices.begin(), element_indices.end(),
+                              row) == element_indices.end())
+                {
+                    continue;
+                }
+                auto& columns = row_columns[row];
+                columns.insert(columns.end(), element_indices.begin(),
+                               element_indices.end());
+            }
+        }
+
+        for (auto const row : rows)
+        {
+            auto& columns = row_columns[row];
+            std::sort(columns.begin(), columns.end());
+            columns.erase(std::unique(columns.begin(), columns.end()),
+                          columns.end());
+            columns.shrink_to_fit();
+        }
+    }
+
+    GlobalCompressedSparsityPattern pattern;
+    pattern.row_offsets.resize(n_rows + 1);
+    pattern.row_offsets[0] = 0;
+    for (std::size_t r = 0; r < n_rows; ++r)
+    {
+        pattern.row_offsets[r + 1] =
+            pattern.row_offsets[r] + row_columns[r].size();
+    }
+
+    pattern.column_indices.resize(pattern.row_offsets.back());
+    auto const n_rows_signed = static_cast<std::ptrdiff_t>(n_rows);
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t r = 0; r < n_rows_signed; ++r)
+    {
+        std::copy(row_columns[r].begin(), row_columns[r].end(),
+                  pattern.column_indices.begin() + pattern.row_offsets[r]);
+        std::vector<GlobalIndexType>().swap(row_columns[r]);
+    }
+
+    return pattern;
+}
+#endif
+
 }  // namespace NumLib
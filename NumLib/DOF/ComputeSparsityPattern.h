@@ -33,4 +33,21 @@ class LocalToGlobalIndexMap;
  */
 GlobalSparsityPattern computeSparsityPattern(
     LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
+
+#ifndef USE_PETSC
+/**
+ * @brief Computes the complete nonzero structure of the global matrix.
+ *
+ * Two global indices are coupled if they belong to a common mesh element. The
+ * column indices of each row are sorted. The rows are computed in parallel
+ * over the mesh nodes if OpenMP is enabled.
+ *
+ * @param dof_table            maps mesh nodes to global indices
+ * @param mesh                 mesh for which the two parameters above are defined
+ *
+ * @return The computed compressed sparsity pattern.
+ */
+GlobalCompressedSparsityPattern computeCompressedSparsityPattern(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
+#endif
 }  // namespace NumLib
@@ -121,23 +121,12 @@ double getNodalValue(GlobalVector const& x, MeshLib::Mesh const& mesh,
     return x.get(index);
 }
 
-std::vector<GlobalIndexType> getIndices(
+std::vector<GlobalIndexType> const& getIndices(
     std::size_t const mesh_item_id,
     NumLib::LocalToGlobalIndexMap const& dof_table)
 {
     assert(dof_table.size() > mesh_item_id);
-    std::vector<GlobalIndexType> indices;
-
-    // Local matrices and vectors will always be ordered by component
-    // no matter what the order of the global matrix is.
-    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
-    {
-        auto const& idcs = dof_table(mesh_item_id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
-        indices.insert(indices.end(), idcs.begin(), idcs.end());
-    }
-
-    return indices;
+    return dof_table.getElementIndices(mesh_item_id);
 }
 
 NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
@@ -146,16 +135,7 @@ NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
     std::vector<GlobalIndexType>& indices)
 {
     assert(dof_table.size() > id);
-    indices.clear();
-
-    // Local matrices and vectors will always be ordered by component,
-    // no matter what the order of the global matrix is.
-    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
-    {
-        auto const& idcs = dof_table(id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
-        indices.insert(indices.end(), idcs.begin(), idcs.end());
-    }
+    indices = dof_table.getElementIndices(id);
 
     return NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 }
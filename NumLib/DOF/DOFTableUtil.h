@@ -31,8 +31,9 @@ double getNodalValue(GlobalVector const& x, MeshLib::Mesh const& mesh,
                      std::size_t const global_component_id);
 
 //! Returns nodal indices for the item identified by \c mesh_item_id from the
-//! given \c dof_table.
-std::vector<GlobalIndexType> getIndices(
+//! given \c dof_table. The indices are stored in the \c dof_table, which must
+//! outlive the returned reference.
+std::vector<GlobalIndexType> const& getIndices(
     std::size_t const mesh_item_id,
     NumLib::LocalToGlobalIndexMap const& dof_table);
 
@@ -42,7 +42,7 @@ template <typename ElementIterator>
 void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
     ElementIterator first, ElementIterator last,
     std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
-    const int comp_id, const int comp_id_write)
+    const int comp_id, const int comp_id_write, Table& rows)
 {
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
@@ -67,7 +67,7 @@ void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
         }
 
         indices.shrink_to_fit();
-        _rows((*e)->getID(), comp_id_write) = std::move(indices);
+        rows((*e)->getID(), comp_id_write) = std::move(indices);
     }
 }
 
@@ -75,9 +75,9 @@ template <typename ElementIterator>
 void LocalToGlobalIndexMap::findGlobalIndices(
     ElementIterator first, ElementIterator last,
     std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
-    const int comp_id, const int comp_id_write)
+    const int comp_id, const int comp_id_write, Table& rows)
 {
-    _rows.resize(std::distance(first, last), _mesh_subsets.size());
+    rows.resize(std::distance(first, last), _mesh_subsets.size());
 
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
@@ -109,7 +109,35 @@ void LocalToGlobalIndexMap::findGlobalIndices(
         }
 
         indices.shrink_to_fit();
-        _rows(elem_id, comp_id_write) = std::move(indices);
+        rows(elem_id, comp_id_write) = std::move(indices);
+    }
+}
+
+void LocalToGlobalIndexMap::concatenateElementIndices(Table const& rows)
+{
+    // Local matrices and vectors will always be ordered by component
+    // no matter what the order of the global matrix is.
+    auto const n_components = static_cast<std::size_t>(rows.cols());
+    _element_indices.resize(rows.rows());
+    _component_offsets.resize(rows.rows() * (n_components + 1));
+    for (Table::Index e = 0; e < rows.rows(); ++e)
+    {
+        auto* const offsets =
+            _component_offsets.data() + e * (n_components + 1);
+        offsets[0] = 0;
+        for (Table::Index c = 0; c < rows.cols(); ++c)
+        {
+            offsets[c + 1] = offsets[c] + rows(e, c).size();
+        }
+
+        auto& indices = _element_indices[e];
+        indices.clear();
+        indices.reserve(offsets[n_components]);
+        for (Table::Index c = 0; c < rows.cols(); ++c)
+        {
+            auto const& idcs = rows(e, c);
+            indices.insert(indices.end(), idcs.begin(), idcs.end());
+        }
     }
 }
 
@@ -129,6 +157,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
       _mesh_component_map(_mesh_subsets, order),
       _variable_component_offsets(to_cumulative(vec_var_n_components))
 {
+    Table rows;
+
     // For each element of that MeshSubset save a line of global indices.
     for (int variable_id = 0; variable_id < static_cast<int>(vec_var_n_components.size());
          ++variable_id)
@@ -144,9 +174,11 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 
             findGlobalIndices(ms.elementsBegin(), ms.elementsEnd(),
                               ms.getNodes(), mesh_id, global_component_id,
-                              global_component_id);
+                              global_component_id, rows);
         }
     }
+
+    concatenateElementIndices(rows);
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -162,7 +194,7 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 
     // For each element of that MeshSubset save a line of global indices.
 
-    // _rows should be resized based on an element ID
+    // rows should be resized based on an element ID
     std::size_t max_elem_id = 0;
     for (std::vector<MeshLib::Element*>const* eles : vec_var_elements)
     {
@@ -171,7 +203,7 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             max_elem_id = std::max(max_elem_id, e->getID());
         }
     }
-    _rows.resize(max_elem_id + 1, _mesh_subsets.size());
+    Table rows(max_elem_id + 1, _mesh_subsets.size());
 
     for (int variable_id = 0; variable_id < static_cast<int>(vec_var_n_components.size());
          ++variable_id)
@@ -188,9 +220,11 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 
             findGlobalIndicesWithElementID(
                 var_elements.cbegin(), var_elements.cend(), ms.getNodes(),
-                mesh_id, global_component_id, global_component_id);
+                mesh_id, global_component_id, global_component_id, rows);
         }
     }
+
+    concatenateElementIndices(rows);
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -213,6 +247,7 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             _mesh_subsets.size(), global_component_ids.size());
     }
 
+    Table rows;
     for (int i = 0; i < static_cast<int>(global_component_ids.size()); ++i)
     {
         auto const& ms = _mesh_subsets[i];
@@ -222,8 +257,10 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
         std::size_t const mesh_id = ms.getMeshID();
 
         findGlobalIndices(elements.cbegin(), elements.cend(), ms.getNodes(),
-                          mesh_id, global_component_ids[i], i);
+                          mesh_id, global_component_ids[i], i, rows);
     }
+
+    concatenateElementIndices(rows);
 }
 
 LocalToGlobalIndexMap* LocalToGlobalIndexMap::deriveBoundaryConstrainedMap(
@@ -334,36 +371,32 @@ int LocalToGlobalIndexMap::getNumberOfComponents() const
 
 std::size_t LocalToGlobalIndexMap::size() const
 {
-    return _rows.rows();
+    return _element_indices.size();
 }
 
-LocalToGlobalIndexMap::RowColumnIndices LocalToGlobalIndexMap::operator()(
+LocalToGlobalIndexMap::LineIndex LocalToGlobalIndexMap::operator()(
     std::size_t const mesh_item_id, const int component_id) const
 {
-    return RowColumnIndices(_rows(mesh_item_id, component_id),
-                            _columns(mesh_item_id, component_id));
+    auto const& indices = _element_indices[mesh_item_id];
+    auto const* const offsets = getComponentOffsets(mesh_item_id);
+    return LineIndex(indices.begin() + offsets[component_id],
+                     indices.begin() + offsets[component_id + 1]);
 }
 
 std::size_t
 LocalToGlobalIndexMap::getNumberOfElementDOF(std::size_t const mesh_item_id) const
 {
-    std::size_t ndof = 0;
-
-    for (Table::Index c = 0; c < _rows.cols(); ++c)
-    {
-        ndof += _rows(mesh_item_id, c).size();
-    }
-
-    return ndof;
+    return _element_indices[mesh_item_id].size();
 }
 
 std::size_t
 LocalToGlobalIndexMap::getNumberOfElementComponents(std::size_t const mesh_item_id) const
 {
+    auto const* const offsets = getComponentOffsets(mesh_item_id);
     std::size_t n = 0;
-    for (Table::Index c = 0; c < _rows.cols(); ++c)
+    for (int c = 0; c < getNumberOfComponents(); ++c)
     {
-        if (!_rows(mesh_item_id, c).empty())
+        if (offsets[c] != offsets[c + 1])
         {
             n++;
         }
@@ -374,13 +407,14 @@ LocalToGlobalIndexMap::getNumberOfElementComponents(std::size_t const mesh_item_
 std::vector<int> LocalToGlobalIndexMap::getElementVariableIDs(
     std::size_t const mesh_item_id) const
 {
+    auto const* const offsets = getComponentOffsets(mesh_item_id);
     std::vector<int> vec;
     for (int i = 0; i < getNumberOfVariables(); i++)
     {
         for (int j=0; j<getNumberOfVariableComponents(i); j++)
         {
             auto comp_id = getGlobalComponent(i, j);
-            if (!_rows(mesh_item_id, comp_id).empty())
+            if (offsets[comp_id] != offsets[comp_id + 1])
             {
                 vec.push_back(i);
             }
@@ -449,14 +483,14 @@ std::ostream& operator<<(std::ostream& os, LocalToGlobalIndexMap const& map)
     std::size_t const max_lines = 10;
     std::size_t lines_printed = 0;
 
-    os << "Rows of the local to global index map; " << map._rows.size()
-        << " rows\n";
+    os << "Rows of the local to global index map; "
+       << map.size() * map.getNumberOfComponents() << " rows\n";
     for (std::size_t e=0; e<map.size(); ++e)
     {
         os << "== e " << e << " ==\n";
         for (int c = 0; c < map.getNumberOfComponents(); ++c)
         {
-            auto const& line = map._rows(e, c);
+            auto const line = map(e, c);
 
             os << "c" << c << " { ";
             std::copy(line.cbegin(), line.cend(),
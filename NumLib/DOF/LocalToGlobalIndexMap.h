@@ -123,8 +123,19 @@ public:
 
     int getNumberOfComponents() const;
 
-    RowColumnIndices operator()(std::size_t const mesh_item_id,
-                                const int component_id) const;
+    /// Returns a copy of the global indices of the given component of the
+    /// mesh item. For the assembly use getElementIndices(), which does not
+    /// allocate memory.
+    LineIndex operator()(std::size_t const mesh_item_id,
+                         const int component_id) const;
+
+    /// Returns the global indices of all components of the given mesh item,
+    /// concatenated in the order of the components. The indices are computed
+    /// once on construction, so no memory is allocated here.
+    LineIndex const& getElementIndices(std::size_t const mesh_item_id) const
+    {
+        return _element_indices[mesh_item_id];
+    }
 
     std::size_t getNumberOfElementDOF(std::size_t const mesh_item_id) const;
 
@@ -179,30 +190,51 @@ public:
         ConstructorTag /*unused*/);
 
 private:
+    /// Table contains for each element (first index) and each component
+    /// (second index) a vector (\c LineIndex) of indices in the global
+    /// stiffness matrix or vector. It is only used during the construction.
+    using Table = Eigen::Matrix<LineIndex, Eigen::Dynamic, Eigen::Dynamic,
+                                Eigen::RowMajor>;
+
     template <typename ElementIterator>
     void findGlobalIndices(ElementIterator first, ElementIterator last,
                            std::vector<MeshLib::Node*> const& nodes,
                            std::size_t const mesh_id, const int comp_id,
-                           const int comp_id_write);
+                           const int comp_id_write, Table& rows);
 
     template <typename ElementIterator>
     void findGlobalIndicesWithElementID(
         ElementIterator first, ElementIterator last,
         std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
-        const int comp_id, const int comp_id_write);
+        const int comp_id, const int comp_id_write, Table& rows);
+
+    /// Fills _element_indices and _component_offsets from the rows of the
+    /// table.
+    void concatenateElementIndices(Table const& rows);
+
+    /// Returns the getNumberOfComponents() + 1 offsets of the components of
+    /// the given mesh item into its element indices.
+    std::size_t const* getComponentOffsets(
+        std::size_t const mesh_item_id) const
+    {
+        return _component_offsets.data() +
+               mesh_item_id * (_mesh_subsets.size() + 1);
+    }
 
     /// A vector of mesh subsets for each process variables' components.
     std::vector<MeshLib::MeshSubset> _mesh_subsets;
     NumLib::MeshComponentMap _mesh_component_map;
 
-    using Table = Eigen::Matrix<LineIndex, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
-
-    /// Table contains for each element (first index) and each component (second index)
-    /// a vector (\c LineIndex) of indices in the global stiffness matrix or vector
-    Table _rows;
+    /// For each element the indices in the global stiffness matrix or vector
+    /// of all components, concatenated into one vector in the order of the
+    /// components. This is the only copy of the indices; the local assembly
+    /// uses these vectors directly.
+    std::vector<LineIndex> _element_indices;
 
-    /// \see _rows
-    Table const& _columns = _rows;
+    /// For each element getNumberOfComponents() + 1 offsets into its
+    /// _element_indices. The indices of the component \c c are in the range
+    /// [offsets[c], offsets[c + 1]).
+    std::vector<std::size_t> _component_offsets;
 
     std::vector<int> const _variable_component_offsets;
 #ifndef NDEBUG
@@ -228,7 +228,7 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
     }
 
     auto const& global_indices =
-        _dof_table_single_component(element_index, 0).rows;
+        _dof_table_single_component.getElementIndices(element_index);
 
     if (num_components == 1)
     {
@@ -299,7 +299,7 @@ void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
     const auto num_int_pts = num_values / num_components;
 
     const auto& global_indices =
-        _dof_table_single_component(element_index, 0).rows;
+        _dof_table_single_component.getElementIndices(element_index);
     const auto num_nodes = static_cast<unsigned>(global_indices.size());
 
     auto const& interpolation_matrix =
@@ -20,5 +20,10 @@
 //
 // Global executor
 //
+#ifdef OGS_USE_PARALLEL_ASSEMBLY
+#include "NumLib/Assembler/ParallelExecutor.h"
+using GlobalExecutor = NumLib::ParallelExecutor;
+#else
 #include "NumLib/Assembler/SerialExecutor.h"
 using GlobalExecutor = NumLib::SerialExecutor;
+#endif
@@ -0,0 +1,265 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CompactLinearSolver.h"
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+CompactLinearSolver::CompactLinearSolver(GlobalLinearSolver& linear_solver)
+    : _linear_solver(linear_solver)
+{
+}
+
+CompactLinearSolver::~CompactLinearSolver() = default;
+
+void CompactLinearSolver::setActiveIndices(
+    std::vector<GlobalIndexType> const* const active_indices)
+{
+    if (active_indices == nullptr || active_indices->empty())
+    {
+        _active_indices.clear();
+        _compact_indices.clear();
+        return;
+    }
+#ifdef USE_PETSC
+    OGS_FATAL(
+        "The restriction of the equation system to the active indices is not "
+        "implemented for PETSc.");
+#else
+    if (*active_indices == _active_indices)
+    {
+        return;
+    }
+    _active_indices = *active_indices;
+    // The index map is rebuilt on the next solve, when the size of the global
+    // equation system is known.
+    _compact_indices.clear();
+#endif
+}
+
+#ifdef USE_PETSC
+bool CompactLinearSolver::solve(GlobalMatrix& A, GlobalVector& b,
+                                GlobalVector& x)
+{
+    return _linear_solver.solve(A, b, x);
+}
+
+bool CompactLinearSolver::solveWithPreviousFactorization(GlobalVector& b,
+                                                         GlobalVector& x)
+{
+    return _linear_solver.solveWithPreviousFactorization(b, x);
+}
+#else
+bool CompactLinearSolver::solve(GlobalMatrix& A, GlobalVector& b,
+                                GlobalVector& x)
+{
+    auto const global_size = A.getNumberOfRows();
+    if (_active_indices.empty() ||
+        static_cast<GlobalIndexType>(_active_indices.size()) == global_size)
+    {
+        return _linear_solver.solve(A, b, x);
+    }
+
+    if (static_cast<GlobalIndexType>(_compact_indices.size()) != global_size)
+    {
+        buildIndexMap(global_size);
+    }
+    copyActiveMatrix(A);
+    return solveCompact(b, x, false);
+}
+
+bool CompactLinearSolver::solveWithPreviousFactorization(GlobalVector& b,
+                                                         GlobalVector& x)
+{
+    if (_active_indices.empty() ||
+        static_cast<GlobalIndexType>(_active_indices.size()) == b.size())
+    {
+        return _linear_solver.solveWithPreviousFactorization(b, x);
+    }
+    return solveCompact(b, x, true);
+}
+
+void CompactLinearSolver::buildIndexMap(GlobalIndexType const global_size)
+{
+    _compact_indices.assign(global_size, -1);
+    GlobalIndexType compact_index = 0;
+    for (auto const i : _active_indices)
+    {
+        if (i < 0 || i >= global_size)
+        {
+            OGS_FATAL(
+                "The active index %d is not in the range of the equation "
+                "system of size %d.",
+                i, global_size);
+        }
+        _compact_indices[i] = compact_index++;
+    }
+
+    _inactive_indices.clear();
+    for (GlobalIndexType i = 0; i < global_size; ++i)
+    {
+        if (_compact_indices[i] == -1)
+        {
+            _inactive_indices.push_back(i);
+        }
+    }
+
+    auto const compact_size =
+        static_cast<GlobalIndexType>(_active_indices.size());
+    _compact_A = std::make_unique<GlobalMatrix>(compact_size);
+    _compact_b = std::make_unique<GlobalVector>(compact_size);
+    _compact_x = std::make_unique<GlobalVector>(compact_size);
+
+    INFO("The linear equation systems are restricted to %d of %d unknowns.",
+         compact_size, global_size);
+}
+
+void CompactLinearSolver::copyActiveMatrix(GlobalMatrix const& A)
+{
+    if (!copyActiveMatrixValues(A))
+    {
+        buildCompactMatrix(A);
+    }
+
+    auto const& raw_A = A.getRawMatrix();
+    _inactive_diagonal.resize(_inactive_indices.size());
+    for (std::size_t k = 0; k < _inactive_indices.size(); ++k)
+    {
+        auto const i = _inactive_indices[k];
+        _inactive_diagonal[k] = raw_A.coeff(i, i);
+        if (_inactive_diagonal[k] == 0.0)
+        {
+            OGS_FATAL(
+                "The inactive row %d of the equation system has no diagonal "
+                "entry. Only rows fixed by Dirichlet boundary conditions can "
+                "be excluded from the equation system.",
+                i);
+        }
+    }
+}
+
+bool CompactLinearSolver::copyActiveMatrixValues(GlobalMatrix const& A)
+{
+    using RawMatrixType = GlobalMatrix::RawMatrixType;
+    auto const& raw_A = A.getRawMatrix();
+    auto& compact_A = _compact_A->getRawMatrix();
+    if (!compact_A.isCompressed())
+    {
+        return false;
+    }
+    auto const* const compact_outer = compact_A.outerIndexPtr();
+    auto const* const compact_inner = compact_A.innerIndexPtr();
+    auto* const compact_values = compact_A.valuePtr();
+
+    // The entries of each active row of A are compared with the compact row
+    // one by one; both are sorted by their column indices.
+    auto const compact_size =
+        static_cast<GlobalIndexType>(_active_indices.size());
+    for (GlobalIndexType k = 0; k < compact_size; ++k)
+    {
+        auto j = compact_outer[k];
+        auto const j_end = compact_outer[k + 1];
+        for (RawMatrixType::InnerIterator it(raw_A, _active_indices[k]); it;
+             ++it)
+        {
+            auto const compact_column = _compact_indices[it.col()];
+            if (compact_column == -1)
+            {
+                continue;
+            }
+            if (j == j_end || compact_inner[j] != compact_column)
+            {
+                return false;
+            }
+            compact_values[j++] = it.value();
+        }
+        if (j != j_end)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CompactLinearSolver::buildCompactMatrix(GlobalMatrix const& A)
+{
+    using RawMatrixType = GlobalMatrix::RawMatrixType;
+    auto const& raw_A = A.getRawMatrix();
+    auto& compact_A = _compact_A->getRawMatrix();
+
+    auto const compact_size =
+        static_cast<GlobalIndexType>(_active_indices.size());
+    Eigen::Matrix<RawMatrixType::StorageIndex, Eigen::Dynamic, 1> row_sizes(
+        compact_size);
+    for (GlobalIndexType k = 0; k < compact_size; ++k)
+    {
+        row_sizes[k] = raw_A.row(_active_indices[k]).nonZeros();
+    }
+    compact_A.resize(compact_size, compact_size);
+    compact_A.reserve(row_sizes);
+
+    // The global column indices are increasing within each row, so are the
+    // compact ones, and the entries are appended at the end of each row.
+    for (GlobalIndexType k = 0; k < compact_size; ++k)
+    {
+        for (RawMatrixType::InnerIterator it(raw_A, _active_indices[k]); it;
+             ++it)
+        {
+            auto const compact_column = _compact_indices[it.col()];
+            if (compact_column != -1)
+            {
+                compact_A.insert(k, compact_column) = it.value();
+            }
+        }
+    }
+    compact_A.makeCompressed();
+
+    DBUG("Rebuilt the sparsity pattern of the compact equation system.");
+}
+
+bool CompactLinearSolver::solveCompact(GlobalVector& b, GlobalVector& x,
+                                       bool const with_previous_factorization)
+{
+    auto const& raw_b = b.getRawVector();
+    auto& raw_x = x.getRawVector();
+    auto& compact_b = _compact_b->getRawVector();
+    auto& compact_x = _compact_x->getRawVector();
+
+    auto const compact_size =
+        static_cast<GlobalIndexType>(_active_indices.size());
+    for (GlobalIndexType k = 0; k < compact_size; ++k)
+    {
+        compact_b[k] = raw_b[_active_indices[k]];
+        compact_x[k] = raw_x[_active_indices[k]];
+    }
+
+    bool const success =
+        with_previous_factorization
+            ? _linear_solver.solveWithPreviousFactorization(*_compact_b,
+                                                            *_compact_x)
+            : _linear_solver.solve(*_compact_A, *_compact_b, *_compact_x);
+
+    for (GlobalIndexType k = 0; k < compact_size; ++k)
+    {
+        raw_x[_active_indices[k]] = compact_x[k];
+    }
+    for (std::size_t k = 0; k < _inactive_indices.size(); ++k)
+    {
+        auto const i = _inactive_indices[k];
+        raw_x[i] = raw_b[i] / _inactive_diagonal[k];
+    }
+    return success;
+}
+#endif
+}  // namespace NumLib
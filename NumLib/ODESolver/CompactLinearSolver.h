@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "NumLib/NumericsConfig.h"
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! Solves linear equation systems restricted to a set of active global
+ * indices, e.g., the degrees of freedom outside of deactivated subdomains.
+ *
+ * The rows and columns of the active indices are copied into a compact
+ * equation system, which is passed to the linear solver. The compact index
+ * map is rebuilt only if the active indices change. The sparsity pattern of
+ * the compact matrix is kept as long as the pattern of the active rows and
+ * columns does not change; then only the values are copied.
+ *
+ * The remaining, inactive rows must be decoupled from the active ones and
+ * contain only their diagonal entry, as it is the case for the nodes of
+ * deactivated subdomains after the application of their Dirichlet boundary
+ * conditions. Their solution is \f$ x_i = b_i / A_{ii} \f$.
+ *
+ * Without active indices the full equation system is solved.
+ */
+class CompactLinearSolver final
+{
+public:
+    explicit CompactLinearSolver(GlobalLinearSolver& linear_solver);
+
+    ~CompactLinearSolver();
+
+    //! Sets the active indices, which must be sorted. If \c active_indices is
+    //! \c nullptr, the full equation systems are solved.
+    void setActiveIndices(
+        std::vector<GlobalIndexType> const* const active_indices);
+
+    //! Solves \f$ A x = b \f$. \c x is also used as initial guess.
+    bool solve(GlobalMatrix& A, GlobalVector& b, GlobalVector& x);
+
+    //! Solves \f$ A x = b \f$ with the factorization of the matrix of the
+    //! last solve() call.
+    bool solveWithPreviousFactorization(GlobalVector& b, GlobalVector& x);
+
+private:
+    //! Computes the inactive indices and the compact index of each global
+    //! index for a global equation system of the given size.
+    void buildIndexMap(GlobalIndexType const global_size);
+
+    //! Copies the active rows and columns of \c A into \c _compact_A.
+    void copyActiveMatrix(GlobalMatrix const& A);
+
+    //! Copies the values of the active rows and columns of \c A into the
+    //! existing sparsity pattern of \c _compact_A. Returns false if the
+    //! pattern of the active rows and columns of \c A differs from it.
+    bool copyActiveMatrixValues(GlobalMatrix const& A);
+
+    //! Rebuilds \c _compact_A including its sparsity pattern.
+    void buildCompactMatrix(GlobalMatrix const& A);
+
+    bool solveCompact(GlobalVector& b, GlobalVector& x,
+                      bool const with_previous_factorization);
+
+    GlobalLinearSolver& _linear_solver;
+
+    //! Sorted global indices of the active rows.
+    std::vector<GlobalIndexType> _active_indices;
+    //! Global indices of the remaining rows.
+    std::vector<GlobalIndexType> _inactive_indices;
+    //! Compact index of each global index or -1 for inactive indices.
+    std::vector<GlobalIndexType> _compact_indices;
+    //! Diagonal entries of the inactive rows of the matrix of the last
+    //! solve() call.
+    std::vector<double> _inactive_diagonal;
+
+    std::unique_ptr<GlobalMatrix> _compact_A;
+    std::unique_ptr<GlobalVector> _compact_b;
+    std::unique_ptr<GlobalVector> _compact_x;
+};
+
+//! @}
+}  // namespace NumLib
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
 #include "NumLib/DOF/MatrixProviderUser.h"
 
 namespace NumLib
@@ -61,6 +64,24 @@ public:
         (void)x;  // by default do nothing
         return IterationResult::SUCCESS;
     }
+
+    /*! Returns the time spent in the last assembly for adding the local
+     * contributions to the global matrices and vectors.
+     *
+     * It is only used to report how the assembly time splits up.
+     */
+    virtual double getScatterTime() const { return 0.0; }
+
+    /*! Returns the sorted global indices of the active unknowns or
+     * \c nullptr if all unknowns are active.
+     *
+     * The remaining unknowns must be fixed by known solutions, s.t. the
+     * linear equation systems can be restricted to the active unknowns.
+     */
+    virtual std::vector<GlobalIndexType> const* getActiveIndices() const
+    {
+        return nullptr;
+    }
 };
 
 //! @}
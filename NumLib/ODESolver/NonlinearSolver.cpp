@@ -10,6 +10,10 @@
 
 #include "NonlinearSolver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
@@ -34,6 +38,7 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 {
     namespace LinAlg = MathLib::LinAlg;
     auto& sys = *_equation_system;
+    _compact_linear_solver.setActiveIndices(sys.getActiveIndices());
 
     auto& A =
         NumLib::GlobalMatrixProvider::provider.getMatrix(_A_id);
@@ -69,7 +74,8 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         sys.assemble(x_new);
         sys.getA(A);
         sys.getRhs(rhs);
-        INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        INFO("[time] Assembly took %g s (thereof %g s for the global scatter).",
+             time_assembly.elapsed(), sys.getScatterTime());
 
         timer_dirichlet.start();
         sys.applyKnownSolutionsPicard(A, rhs, x_new);
@@ -85,7 +91,8 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
+        bool iteration_succeeded =
+            _compact_linear_solver.solve(A, rhs, x_new);
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -176,6 +183,145 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     return {error_norms_met, iteration};
 }
 
+double EisenstatWalkerForcingTerm::compute(
+    double const previous_eta, double const residual_norm,
+    double const previous_residual_norm) const
+{
+    if (previous_residual_norm == 0)
+    {
+        return previous_eta;
+    }
+
+    double eta =
+        gamma * std::pow(residual_norm / previous_residual_norm, alpha);
+
+    // Safeguard against too small forcing terms in case of a single large
+    // residual reduction.
+    double const safeguard = gamma * std::pow(previous_eta, alpha);
+    if (safeguard > 0.1)
+    {
+        eta = std::max(eta, safeguard);
+    }
+
+    return std::min(eta, max);
+}
+
+double NonlinearSolver<NonlinearSolverTag::Newton>::computeStepLength(
+    GlobalVector const& x, GlobalVector& minus_delta_x, GlobalMatrix& J,
+    GlobalVector& res, double const residual_norm, bool& residual_assembled)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    auto& sys = *_equation_system;
+    auto const& line_search = *_line_search;
+    bool const trust_region =
+        line_search.type == NewtonLineSearch::Type::TrustRegion;
+
+    residual_assembled = false;
+    double step_length = _damping;
+    double const delta_x_norm = LinAlg::norm2(minus_delta_x);
+    // No decrease of the residual can be detected for steps at round-off
+    // level.
+    if (residual_norm == 0 ||
+        delta_x_norm <=
+            std::numeric_limits<double>::epsilon() * LinAlg::norm2(x))
+    {
+        return step_length;
+    }
+
+    if (trust_region)
+    {
+        if (_trust_region_radius <= 0)
+        {
+            _trust_region_radius = step_length * delta_x_norm;
+        }
+        step_length =
+            std::min(step_length, _trust_region_radius / delta_x_norm);
+    }
+
+    auto& x_trial = NumLib::GlobalVectorProvider::provider.getVector(
+        x, _x_trial_id);
+
+    // The trial step with the smallest residual norm is taken if none is
+    // accepted.
+    double best_step_length = step_length;
+    double best_residual_norm = std::numeric_limits<double>::infinity();
+
+    for (int trial = 1;; ++trial)
+    {
+        LinAlg::copy(x, x_trial);
+        LinAlg::axpy(x_trial, -step_length, minus_delta_x);
+
+        sys.assembleResidual(x_trial);
+        sys.getResidual(x_trial, res);
+        // Only sets the residual of the Dirichlet dofs to zero; the Jacobian
+        // has been treated already.
+        sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        double const trial_residual_norm = LinAlg::norm2(res);
+
+        INFO(
+            "Newton: Line search trial %d with step length %g: residual norm "
+            "%g (%g before the step).",
+            trial, step_length, trial_residual_norm, residual_norm);
+        if (trial_residual_norm < best_residual_norm)
+        {
+            best_residual_norm = trial_residual_norm;
+            best_step_length = step_length;
+        }
+
+        bool accepted;
+        double next_step_length;
+        if (trust_region)
+        {
+            // The linearization predicts a residual reduction proportional
+            // to the step length.
+            double const rho = (residual_norm - trial_residual_norm) /
+                               (step_length * residual_norm);
+            double const step_norm = step_length * delta_x_norm;
+            if (rho < 0.25)
+            {
+                _trust_region_radius = 0.25 * step_norm;
+            }
+            else if (rho > 0.75 && step_norm >= 0.99 * _trust_region_radius)
+            {
+                _trust_region_radius *= 2;
+            }
+            accepted = rho >= line_search.sufficient_decrease;
+            next_step_length =
+                std::min(_damping, _trust_region_radius / delta_x_norm);
+        }
+        else
+        {
+            accepted = trial_residual_norm <=
+                       (1 - line_search.sufficient_decrease * step_length) *
+                           residual_norm;
+            next_step_length = step_length / 2;
+        }
+
+        if (accepted)
+        {
+            residual_assembled = true;
+            break;
+        }
+        if (trial >= line_search.max_trials)
+        {
+            // Otherwise the state of the last trial step is kept.
+            residual_assembled = step_length == best_step_length;
+            step_length = best_step_length;
+            WARN(
+                "Newton: The line search did not reach a sufficient decrease "
+                "of the residual within %d trials. Continuing with step "
+                "length %g.",
+                line_search.max_trials, step_length);
+            break;
+        }
+        step_length = next_step_length;
+    }
+
+    NumLib::GlobalVectorProvider::provider.releaseVector(x_trial);
+
+    return step_length;
+}
+
 void NonlinearSolver<NonlinearSolverTag::Newton>::assemble(
     GlobalVector const& x) const
 {
@@ -192,6 +338,7 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 {
     namespace LinAlg = MathLib::LinAlg;
     auto& sys = *_equation_system;
+    _compact_linear_solver.setActiveIndices(sys.getActiveIndices());
 
     auto& res = NumLib::GlobalVectorProvider::provider.getVector(
         _res_id);
@@ -209,6 +356,22 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
     _convergence_criterion->preFirstIteration();
 
+    // Number of iterations since the last update of the Jacobian.
+    int jacobian_age = 0;
+    int number_of_jacobian_updates = 0;
+    double previous_residual_norm = 0.0;
+    double forcing_term = _forcing_term ? _forcing_term->initial : 0.0;
+    double total_time_assembly = 0.0;
+    double total_time_linear_solver = 0.0;
+
+    _trust_region_radius = (_line_search && _line_search->initial_radius)
+                               ? *_line_search->initial_radius
+                               : 0.0;
+    int number_of_shortened_steps = 0;
+    // The line search of the previous iteration has assembled the residual at
+    // the current x already.
+    bool residual_assembled = false;
+
     int iteration = 1;
     for (; iteration <= _maxiter;
          ++iteration, _convergence_criterion->reset())
@@ -226,18 +389,64 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
         sys.preIteration(iteration, x);
 
+        // The Jacobian of a previous iteration is kept for a fixed number of
+        // iterations, and for the modified Newton method as long as the
+        // residual decreases fast enough, which is checked below. Both need a
+        // linear solver reusing its factorization; solving with the old
+        // Jacobian from scratch would not save anything but its assembly.
+        bool const can_reuse_factorization =
+            iteration > 1 && _linear_solver.canSolveWithPreviousFactorization();
+        bool const reuse_factorization =
+            can_reuse_factorization && jacobian_age < _factorization_reuse;
+        bool reuse_jacobian =
+            can_reuse_factorization &&
+            (reuse_factorization || _jacobian_update_rate > 0);
+
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        sys.assemble(x);
-        sys.getResidual(x, res);
-        sys.getJacobian(J);
-        INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        if (!reuse_jacobian)
+        {
+            sys.assemble(x);
+            sys.getResidual(x, res);
+            sys.getJacobian(J);
+        }
+        else if (!residual_assembled)
+        {
+            sys.assembleResidual(x);
+            sys.getResidual(x, res);
+        }
+        residual_assembled = false;
+        double time_assembly_elapsed = time_assembly.elapsed();
+        INFO("[time] Assembly took %g s (thereof %g s for the global scatter).",
+             time_assembly_elapsed, sys.getScatterTime());
 
         minus_delta_x.setZero();
 
         timer_dirichlet.start();
         sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
         time_dirichlet += timer_dirichlet.elapsed();
+
+        double const residual_norm = LinAlg::norm2(res);
+        if (reuse_jacobian && !reuse_factorization &&
+            residual_norm > _jacobian_update_rate * previous_residual_norm)
+        {
+            INFO(
+                "Newton: The residual norm decreased by a factor of %g only; "
+                "updating the Jacobian.",
+                residual_norm / previous_residual_norm);
+            reuse_jacobian = false;
+
+            // Only the residual has been assembled so far.
+            time_assembly.start();
+            sys.assemble(x);
+            sys.getJacobian(J);
+            time_assembly_elapsed += time_assembly.elapsed();
+
+            timer_dirichlet.start();
+            sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+            time_dirichlet += timer_dirichlet.elapsed();
+        }
+        total_time_assembly += time_assembly_elapsed;
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck())
@@ -245,10 +454,46 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _convergence_criterion->checkResidual(res);
         }
 
+        if (_forcing_term)
+        {
+            if (iteration > 1)
+            {
+                forcing_term = _forcing_term->compute(
+                    forcing_term, residual_norm, previous_residual_norm);
+            }
+            INFO("Newton: Relative tolerance of the linear solver is %g.",
+                 forcing_term);
+            _linear_solver.setTolerance(forcing_term);
+        }
+        previous_residual_norm = residual_norm;
+
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
-        INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        bool iteration_succeeded;
+        if (reuse_jacobian)
+        {
+            INFO("Newton: Reusing the factorization of a previous Jacobian.");
+            iteration_succeeded =
+                _compact_linear_solver.solveWithPreviousFactorization(
+                    res, minus_delta_x);
+        }
+        else
+        {
+            iteration_succeeded =
+                _compact_linear_solver.solve(J, res, minus_delta_x);
+        }
+        if (reuse_jacobian)
+        {
+            ++jacobian_age;
+        }
+        else
+        {
+            jacobian_age = 0;
+            ++number_of_jacobian_updates;
+        }
+        auto const time_linear_solver_elapsed = time_linear_solver.elapsed();
+        total_time_linear_solver += time_linear_solver_elapsed;
+        INFO("[time] Linear solver took %g s.", time_linear_solver_elapsed);
 
         if (!iteration_succeeded)
         {
@@ -259,9 +504,25 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             // TODO could be solved in a better way
             // cf.
             // http://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/Vec/VecWAXPY.html
+            double step_length = _damping;
+            if (_line_search && !sys.isLinear())
+            {
+                BaseLib::RunTime time_line_search;
+                time_line_search.start();
+                step_length = computeStepLength(x, minus_delta_x, J, res,
+                                                residual_norm,
+                                                residual_assembled);
+                INFO("[time] Line search took %g s.",
+                     time_line_search.elapsed());
+                if (step_length < _damping)
+                {
+                    ++number_of_shortened_steps;
+                }
+            }
+
             auto& x_new =
                 NumLib::GlobalVectorProvider::provider.getVector(x, _x_new_id);
-            LinAlg::axpy(x_new, -_damping, minus_delta_x);
+            LinAlg::axpy(x_new, -step_length, minus_delta_x);
 
             if (postIterationCallback)
             {
@@ -284,6 +545,7 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
                         " has to be repeated.");
                     // TODO introduce some onDestroy hook.
                     NumLib::GlobalVectorProvider::provider.releaseVector(x_new);
+                    residual_assembled = false;
                     continue;  // That throws the iteration result away.
             }
 
@@ -332,6 +594,32 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _maxiter);
     }
 
+    if (_forcing_term)
+    {
+        _linear_solver.resetTolerance();
+    }
+
+    if (number_of_shortened_steps > 0)
+    {
+        _number_of_shortened_steps += number_of_shortened_steps;
+        if (error_norms_met)
+        {
+            ++_number_of_rescued_solves;
+        }
+        INFO(
+            "Newton: The line search shortened %d steps. In total %d steps "
+            "were shortened and %d nonlinear solves converged only with "
+            "shortened steps.",
+            number_of_shortened_steps, _number_of_shortened_steps,
+            _number_of_rescued_solves);
+    }
+
+    INFO(
+        "[time] Newton: %d Jacobian updates in %d iterations; assembly took "
+        "%g s, the linear solver took %g s in total.",
+        number_of_jacobian_updates, std::min(iteration, _maxiter),
+        total_time_assembly, total_time_linear_solver);
+
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(J);
     NumLib::GlobalVectorProvider::provider.releaseVector(res);
     NumLib::GlobalVectorProvider::provider.releaseVector(
@@ -355,7 +643,8 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
         return std::make_pair(
             std::make_unique<ConcreteNLS>(linear_solver, max_iter), tag);
     }
-    if (type == "Newton")
+    if (type == "Newton" || type == "ModifiedNewton" ||
+        type == "InexactNewton")
     {
         //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__damping}
         auto const damping = config.getConfigParameter<double>("damping", 1.0);
@@ -366,10 +655,101 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
                 "%g.",
                 damping);
         }
+        auto const factorization_reuse =
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__factorization_reuse}
+            config.getConfigParameter<int>("factorization_reuse", 0);
+        if (factorization_reuse < 0)
+        {
+            OGS_FATAL(
+                "The number of iterations reusing a factorization of the "
+                "Jacobian must not be negative, got %d.",
+                factorization_reuse);
+        }
+
+        double jacobian_update_rate = 0.0;
+        if (type == "ModifiedNewton")
+        {
+            jacobian_update_rate =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__jacobian_update_rate}
+                config.getConfigParameter<double>("jacobian_update_rate", 0.5);
+            if (jacobian_update_rate <= 0 || jacobian_update_rate > 1)
+            {
+                OGS_FATAL(
+                    "The Jacobian update rate of the modified Newton method "
+                    "must be in (0, 1], got %g.",
+                    jacobian_update_rate);
+            }
+        }
+
+        boost::optional<EisenstatWalkerForcingTerm> forcing_term;
+        if (type == "InexactNewton")
+        {
+            forcing_term = EisenstatWalkerForcingTerm{};
+            forcing_term->initial =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__initial_forcing_term}
+                config.getConfigParameter<double>("initial_forcing_term",
+                                                  forcing_term->initial);
+            forcing_term->max =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__max_forcing_term}
+                config.getConfigParameter<double>("max_forcing_term",
+                                                  forcing_term->max);
+            if (forcing_term->initial <= 0 || forcing_term->max >= 1 ||
+                forcing_term->initial > forcing_term->max)
+            {
+                OGS_FATAL(
+                    "The forcing terms of the inexact Newton method must "
+                    "satisfy 0 < initial_forcing_term <= max_forcing_term < 1, "
+                    "got %g and %g.",
+                    forcing_term->initial, forcing_term->max);
+            }
+        }
+
+        boost::optional<NewtonLineSearch> line_search;
+        if (auto const line_search_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search}
+                config.getConfigSubtreeOptional("line_search"))
+        {
+            line_search = NewtonLineSearch{};
+            auto const line_search_type =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__type}
+                line_search_config->getConfigParameter<std::string>("type");
+            if (line_search_type == "Backtracking")
+            {
+                line_search->type = NewtonLineSearch::Type::Backtracking;
+            }
+            else if (line_search_type == "TrustRegion")
+            {
+                line_search->type = NewtonLineSearch::Type::TrustRegion;
+                line_search->initial_radius =
+                    //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__initial_radius}
+                    line_search_config->getConfigParameterOptional<double>(
+                        "initial_radius");
+            }
+            else
+            {
+                OGS_FATAL("Unknown line search type '%s'.",
+                          line_search_type.c_str());
+            }
+            line_search->max_trials =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search__max_trials}
+                line_search_config->getConfigParameter<int>(
+                    "max_trials", line_search->max_trials);
+            if (line_search->max_trials < 1)
+            {
+                OGS_FATAL(
+                    "The maximum number of line search trials must be "
+                    "positive, got %d.",
+                    line_search->max_trials);
+            }
+        }
+
         auto const tag = NonlinearSolverTag::Newton;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping),
+            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping,
+                                          factorization_reuse,
+                                          jacobian_update_rate, forcing_term,
+                                          line_search),
             tag);
     }
     OGS_FATAL("Unsupported nonlinear solver type");
@@ -12,8 +12,10 @@
 
 #include <memory>
 #include <utility>
+#include <boost/optional.hpp>
 #include <logog/include/logog.hpp>
 
+#include "CompactLinearSolver.h"
 #include "ConvergenceCriterion.h"
 #include "NonlinearSolverStatus.h"
 #include "NonlinearSystem.h"
@@ -73,7 +75,68 @@ public:
 template <NonlinearSolverTag NLTag>
 class NonlinearSolver;
 
+/*! Forcing terms of the inexact Newton method after Eisenstat and Walker
+ * (1996), choice 2.
+ *
+ * The relative tolerance of the linear solver in iteration \f$ k > 1 \f$ is
+ * \f$ \eta_k = \gamma (\|r_k\| / \|r_{k-1}\|)^\alpha \f$, where \f$ r_k \f$ is
+ * the residual. It is safeguarded against decreasing too fast and bounded by
+ * \c max.
+ */
+struct EisenstatWalkerForcingTerm
+{
+    double initial = 0.5;  //!< The forcing term of the first iteration.
+    double max = 0.9;      //!< The upper bound of the forcing terms.
+    double gamma = 0.9;
+    double alpha = 2.0;
+
+    //! Computes the forcing term from the one of the previous iteration and
+    //! the residual norms of the current and the previous iteration.
+    double compute(double const previous_eta, double const residual_norm,
+                   double const previous_residual_norm) const;
+};
+
+/*! Globalization of the Newton method.
+ *
+ * Starting from the damped Newton step the step length is reduced until the
+ * norm of the residual (with Dirichlet boundary conditions applied) decreases
+ * sufficiently. Each trial step requires an assembly of the residual. If no
+ * trial step is accepted within \c max_trials, the one with the smallest
+ * residual norm is taken.
+ */
+struct NewtonLineSearch
+{
+    enum class Type
+    {
+        //! The step length is halved until the Armijo condition
+        //! \f$ \|r(x - \alpha \Delta x)\| \le (1 - c \alpha) \|r(x)\| \f$
+        //! holds.
+        Backtracking,
+        //! The step length is bounded by a radius, which is adapted to the
+        //! ratio of the actual and the predicted residual reduction and kept
+        //! over the iterations of a nonlinear solve.
+        TrustRegion
+    };
+
+    Type type = Type::Backtracking;
+    int max_trials = 10;  //!< Maximum number of trial steps per iteration.
+    double sufficient_decrease = 1e-4;  //!< The constant \f$ c \f$.
+    //! Initial trust region radius. The norm of the first Newton step is used
+    //! if not set.
+    boost::optional<double> initial_radius;
+};
+
 /*! Find a solution to a nonlinear equation using the Newton-Raphson method.
+ *
+ * Besides the full Newton method the class implements two variants reducing
+ * the cost per iteration:
+ * - The modified Newton method keeps the Jacobian of a previous iteration as
+ *   long as the residual norm decreases at least by the factor
+ *   \c _jacobian_update_rate per iteration. Only the residual is assembled
+ *   then. The method needs a linear solver reusing its factorization, i.e.,
+ *   a direct solver; otherwise the Jacobian is updated in every iteration.
+ * - The inexact Newton method solves the linearized system only up to a
+ *   relative tolerance given by Eisenstat-Walker forcing terms.
  */
 template <>
 class NonlinearSolver<NonlinearSolverTag::Newton> final
@@ -89,12 +152,33 @@ public:
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
      * \param damping A positive damping factor.
+     * \param factorization_reuse number of iterations following each
+     *                Jacobian factorization in which that factorization is
+     *                reused.
+     * \param jacobian_update_rate if positive, the modified Newton method is
+     *                used. \see _jacobian_update_rate
+     * \param forcing_term if set, the inexact Newton method is used.
+     * \param line_search if set, the step length is determined by the
+     *                given line search instead of the constant damping.
      * \see _damping
      */
-    explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
-                             int const maxiter,
-                             double const damping = 1.0)
-        : _linear_solver(linear_solver), _maxiter(maxiter), _damping(damping)
+    explicit NonlinearSolver(
+        GlobalLinearSolver& linear_solver,
+        int const maxiter,
+        double const damping = 1.0,
+        int const factorization_reuse = 0,
+        double const jacobian_update_rate = 0.0,
+        boost::optional<EisenstatWalkerForcingTerm> const& forcing_term =
+            boost::none,
+        boost::optional<NewtonLineSearch> const& line_search = boost::none)
+        : _linear_solver(linear_solver),
+          _compact_linear_solver(linear_solver),
+          _maxiter(maxiter),
+          _damping(damping),
+          _factorization_reuse(factorization_reuse),
+          _jacobian_update_rate(jacobian_update_rate),
+          _forcing_term(forcing_term),
+          _line_search(line_search)
     {
     }
 
@@ -114,7 +198,22 @@ public:
             postIterationCallback) override;
 
 private:
+    //! Returns the length of the step \f$ -\alpha \Delta x \f$ from \c x
+    //! determined by the line search. \c J must be the Jacobian with Dirichlet
+    //! boundary conditions applied, \c res is overwritten. The trial steps
+    //! assemble the residual only. \c residual_assembled is set if the
+    //! equation system has been assembled last at the returned step and
+    //! \c res holds its residual.
+    double computeStepLength(GlobalVector const& x,
+                             GlobalVector& minus_delta_x,
+                             GlobalMatrix& J, GlobalVector& res,
+                             double const residual_norm,
+                             bool& residual_assembled);
+
     GlobalLinearSolver& _linear_solver;
+    //! Solves the linear equation systems restricted to the active unknowns
+    //! of the equation system.
+    CompactLinearSolver _compact_linear_solver;
     System* _equation_system = nullptr;
 
     // TODO doc
@@ -127,11 +226,39 @@ private:
     //! conservative approach.
     double const _damping;
 
+    //! Number of iterations following a factorization of the Jacobian in which
+    //! the linear solver reuses that factorization instead of factorizing the
+    //! current Jacobian (modified Newton method). The first iteration of each
+    //! solve() call always uses the current Jacobian.
+    int const _factorization_reuse;
+
+    //! Modified Newton method: the Jacobian of a previous iteration is kept
+    //! as long as the residual norm of the current iteration is at most this
+    //! factor times the residual norm of the previous iteration. Zero disables
+    //! the modified Newton method. Without a linear solver reusing its
+    //! factorization the Jacobian is updated in every iteration.
+    double const _jacobian_update_rate;
+
+    //! Inexact Newton method: forcing terms setting the tolerance of the
+    //! linear solver in each iteration.
+    boost::optional<EisenstatWalkerForcingTerm> const _forcing_term;
+
+    //! Optional globalization replacing the constant damping.
+    boost::optional<NewtonLineSearch> const _line_search;
+    //! Current trust region radius, reset at the beginning of each solve().
+    double _trust_region_radius = 0.0;
+    //! Number of iterations in which the line search shortened the step.
+    int _number_of_shortened_steps = 0;
+    //! Number of nonlinear solves that converged with at least one shortened
+    //! step, i.e., time step rejections avoided by the line search.
+    int _number_of_rescued_solves = 0;
+
     std::size_t _res_id = 0u;            //!< ID of the residual vector.
     std::size_t _J_id = 0u;              //!< ID of the Jacobian matrix.
     std::size_t _minus_delta_x_id = 0u;  //!< ID of the \f$ -\Delta x\f$ vector.
     std::size_t _x_new_id =
         0u;  //!< ID of the vector storing \f$ x - (-\Delta x) \f$.
+    std::size_t _x_trial_id = 0u;  //!< ID of the line search trial vector.
 };
 
 /*! Find a solution to a nonlinear equation using the Picard fixpoint iteration
@@ -154,7 +281,9 @@ public:
      */
     explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
                              const int maxiter)
-        : _linear_solver(linear_solver), _maxiter(maxiter)
+        : _linear_solver(linear_solver),
+          _compact_linear_solver(linear_solver),
+          _maxiter(maxiter)
     {
     }
 
@@ -175,6 +304,9 @@ public:
 
 private:
     GlobalLinearSolver& _linear_solver;
+    //! Solves the linear equation systems restricted to the active unknowns
+    //! of the equation system.
+    CompactLinearSolver _compact_linear_solver;
     System* _equation_system = nullptr;
 
     // TODO doc
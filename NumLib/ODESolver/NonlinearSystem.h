@@ -39,6 +39,10 @@ public:
     //! \f$A(x)\f$ and the vector \f$b(x)\f$ are assembled.
     virtual void assemble(GlobalVector const& x) = 0;
 
+    //! Assembles only what is needed by getResidual() at the point \c x.
+    //! getJacobian() must not be called before the next assemble() call.
+    virtual void assembleResidual(GlobalVector const& x) { assemble(x); }
+
     /*! Writes the residual at point \c x to \c res.
      *
      * \pre assemble() must have been called before with the same argument \c x.
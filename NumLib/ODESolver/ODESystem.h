@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -133,6 +134,30 @@ public:
                                       const double dxdot_dx, const double dx_dx,
                                       GlobalMatrix& M, GlobalMatrix& K,
                                       GlobalVector& b, GlobalMatrix& Jac) = 0;
+
+    //! Returns true if the ODE shall be assembled by
+    //! assembleResidualWithJacobian() instead of assembleWithJacobian().
+    virtual bool isResidualOnlyAssembly() const { return false; }
+
+    /*! Assemble the negative residual
+     * \f$ -r = b - M \cdot \hat x - K \cdot x_C \f$ into \c b and the
+     * Jacobian into \c Jac at the provided state (\c t, \c x), like
+     * assembleWithJacobian() but without the global matrices \f$ M \f$ and
+     * \f$ K \f$.
+     */
+    virtual void assembleResidualWithJacobian(
+        const double /*t*/, double const /*dt*/, GlobalVector const& /*x*/,
+        GlobalVector const& /*xdot*/, const double /*dxdot_dx*/,
+        const double /*dx_dx*/, GlobalVector& /*b*/, GlobalMatrix& /*Jac*/)
+    {
+        OGS_FATAL("The residual-only assembly is not implemented.");
+    }
+
+    //! Switches the assembly of the Jacobian on or off. While it is off,
+    //! assembleWithJacobian() and assembleResidualWithJacobian() may skip
+    //! adding to \c Jac, whose content is unspecified afterwards. By default
+    //! the Jacobian is always assembled.
+    virtual void setJacobianAssembly(bool const /*jacobian_assembly*/) {}
 };
 
 //! @}
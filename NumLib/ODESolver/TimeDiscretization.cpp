@@ -11,6 +11,11 @@
 
 #include "TimeDiscretization.h"
 
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include "BaseLib/FileTools.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 
 namespace NumLib
@@ -53,6 +58,95 @@ double TimeDiscretization::computeRelativeChangeFromPreviousTimestep(
     return norm_dx / std::numeric_limits<double>::epsilon();
 }
 
+void BackwardEuler::writeCheckpoint(std::ostream& os) const
+{
+    BaseLib::writeValueBinary(os, _t);
+    BaseLib::writeValueBinary(os, _delta_t);
+    MathLib::LinAlg::writeBinary(os, _x_old);
+}
+
+void BackwardEuler::readCheckpoint(std::istream& is)
+{
+    _t = BaseLib::readBinaryValue<double>(is);
+    _delta_t = BaseLib::readBinaryValue<double>(is);
+    MathLib::LinAlg::readBinary(is, _x_old);
+}
+
+void ForwardEuler::writeCheckpoint(std::ostream& os) const
+{
+    BaseLib::writeValueBinary(os, _t);
+    BaseLib::writeValueBinary(os, _t_old);
+    BaseLib::writeValueBinary(os, _delta_t);
+    MathLib::LinAlg::writeBinary(os, _x_old);
+}
+
+void ForwardEuler::readCheckpoint(std::istream& is)
+{
+    _t = BaseLib::readBinaryValue<double>(is);
+    _t_old = BaseLib::readBinaryValue<double>(is);
+    _delta_t = BaseLib::readBinaryValue<double>(is);
+    MathLib::LinAlg::readBinary(is, _x_old);
+}
+
+void CrankNicolson::writeCheckpoint(std::ostream& os) const
+{
+    BaseLib::writeValueBinary(os, _t);
+    BaseLib::writeValueBinary(os, _delta_t);
+    MathLib::LinAlg::writeBinary(os, _x_old);
+}
+
+void CrankNicolson::readCheckpoint(std::istream& is)
+{
+    _t = BaseLib::readBinaryValue<double>(is);
+    _delta_t = BaseLib::readBinaryValue<double>(is);
+    MathLib::LinAlg::readBinary(is, _x_old);
+}
+
+void BackwardDifferentiationFormula::writeCheckpoint(std::ostream& os) const
+{
+    BaseLib::writeValueBinary(os, _t);
+    BaseLib::writeValueBinary(os, _delta_t);
+    BaseLib::writeValueBinary(os, static_cast<std::uint32_t>(_offset));
+    BaseLib::writeValueBinary(os, static_cast<std::uint32_t>(_xs_old.size()));
+    for (auto const* x : _xs_old)
+    {
+        MathLib::LinAlg::writeBinary(os, *x);
+    }
+}
+
+void BackwardDifferentiationFormula::readCheckpoint(std::istream& is)
+{
+    _t = BaseLib::readBinaryValue<double>(is);
+    _delta_t = BaseLib::readBinaryValue<double>(is);
+    _offset = BaseLib::readBinaryValue<std::uint32_t>(is);
+    auto const n_xs_old = BaseLib::readBinaryValue<std::uint32_t>(is);
+    if (!is || n_xs_old == 0 || n_xs_old > _num_steps ||
+        _offset >= n_xs_old || _xs_old.empty())
+    {
+        OGS_FATAL(
+            "The checkpoint of the BDF(%d) scheme is corrupted or belongs to "
+            "a different scheme.",
+            _num_steps);
+    }
+
+    // The initial state provides a vector of suitable size.
+    while (_xs_old.size() < n_xs_old)
+    {
+        _xs_old.push_back(
+            &NumLib::GlobalVectorProvider::provider.getVector(*_xs_old[0]));
+    }
+    while (_xs_old.size() > n_xs_old)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_xs_old.back());
+        _xs_old.pop_back();
+    }
+
+    for (auto* x : _xs_old)
+    {
+        MathLib::LinAlg::readBinary(is, *x);
+    }
+}
+
 double BackwardEuler::getRelativeChangeFromPreviousTimestep(
     GlobalVector const& x, MathLib::VecNormType norm_type)
 {
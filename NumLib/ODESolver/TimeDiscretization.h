@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <vector>
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -189,6 +190,15 @@ public:
     //! Returns \f$ x_O \f$.
     virtual void getWeightedOldX(GlobalVector& y) const = 0;  // = x_old
 
+    //! Writes the internal state, i.e., the current time, the time step size
+    //! and the stored solutions of the preceding timesteps, as binary into
+    //! \c os.
+    virtual void writeCheckpoint(std::ostream& os) const = 0;
+
+    //! Restores the internal state written by writeCheckpoint().
+    //! setInitialState() must have been called before.
+    virtual void readCheckpoint(std::istream& is) = 0;
+
     virtual ~TimeDiscretization() = default;
 
     //! \name Extended Interface
@@ -301,6 +311,9 @@ public:
         LinAlg::scale(y, 1.0 / _delta_t);
     }
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     double _t = std::numeric_limits<double>::quiet_NaN();  //!< \f$ t_C \f$
     double _delta_t =
@@ -372,6 +385,9 @@ public:
         LinAlg::scale(y, 1.0 / _delta_t);
     }
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
     bool isLinearTimeDisc() const override { return true; }
     double getDxDx() const override { return 0.0; }
     //! Returns the solution from the preceding timestep.
@@ -453,6 +469,10 @@ public:
     double getTheta() const { return _theta; }
     //! Returns the solution from the preceding timestep.
     GlobalVector const& getXOld() const { return _x_old; }
+
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     const double _theta;  //!< the implicitness parameter \f$ \theta \f$
     double _t = std::numeric_limits<double>::quiet_NaN();  //!< \f$ t_C \f$
@@ -523,6 +543,9 @@ public:
 
     void getWeightedOldX(GlobalVector& y) const override;
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     std::size_t eff_num_steps() const { return _xs_old.size(); }
     const unsigned _num_steps;  //!< The order of the BDF method
@@ -10,7 +10,10 @@
 
 #include "TimeDiscretizedODESystem.h"
 
+#include <logog/include/logog.hpp>
+
 #include "MathLib/LinAlg/ApplyKnownSolution.h"
+#include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/UnifiedMatrixSetters.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -37,6 +40,27 @@ void applyKnownSolutions(std::vector<Solutions> const* const known_solutions,
     }
     MathLib::LinAlg::finalizeAssembly(x);
 }
+
+//! The residual-only assembly is used if the ODE requests it and the time
+//! discretization does not need the matrices of previous timesteps.
+bool isResidualOnlyAssemblyPossible(
+    NumLib::ODESystem<NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+                      NumLib::NonlinearSolverTag::Newton> const& ode,
+    NumLib::TimeDiscretization const& time_discretization)
+{
+    if (!ode.isResidualOnlyAssembly())
+    {
+        return false;
+    }
+    if (time_discretization.needsPreload())
+    {
+        WARN(
+            "The residual-only assembly is not supported by the chosen time "
+            "discretization. The matrices M and K are assembled.");
+        return false;
+    }
+    return true;
+}
 }  // namespace detail
 
 namespace NumLib
@@ -47,14 +71,19 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
                              TimeDisc& time_discretization)
     : _ode(ode),
       _time_disc(time_discretization),
-      _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
+      _mat_trans(createMatrixTranslator<ODETag>(time_discretization)),
+      _residual_only_assembly(::detail::isResidualOnlyAssemblyPossible(
+          ode, time_discretization))
 {
     _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
         _ode.getMatrixSpecifications(process_id), _Jac_id);
-    _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _M_id);
-    _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(process_id), _K_id);
+    if (!_residual_only_assembly)
+    {
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(process_id), _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(process_id), _K_id);
+    }
     _b = &NumLib::GlobalVectorProvider::provider.getVector(
         _ode.getMatrixSpecifications(process_id), _b_id);
 }
@@ -64,8 +93,11 @@ TimeDiscretizedODESystem<
     NonlinearSolverTag::Newton>::~TimeDiscretizedODESystem()
 {
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_Jac);
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
-    NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
+    if (!_residual_only_assembly)
+    {
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
+    }
     NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
 }
 
@@ -84,28 +116,55 @@ void TimeDiscretizedODESystem<
     auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(_xdot_id);
     _time_disc.getXdot(x_new_timestep, xdot);
 
-    _M->setZero();
-    _K->setZero();
     _b->setZero();
     _Jac->setZero();
 
     _ode.preAssemble(t, dt, x_curr);
-    _ode.assembleWithJacobian(t, dt, x_curr, xdot, dxdot_dx, dx_dx, *_M, *_K,
-                              *_b, *_Jac);
+    if (_residual_only_assembly)
+    {
+        _ode.assembleResidualWithJacobian(t, dt, x_curr, xdot, dxdot_dx, dx_dx,
+                                          *_b, *_Jac);
+    }
+    else
+    {
+        _M->setZero();
+        _K->setZero();
+        _ode.assembleWithJacobian(t, dt, x_curr, xdot, dxdot_dx, dx_dx, *_M,
+                                  *_K, *_b, *_Jac);
+        LinAlg::finalizeAssembly(*_M);
+        LinAlg::finalizeAssembly(*_K);
+    }
 
-    LinAlg::finalizeAssembly(*_M);
-    LinAlg::finalizeAssembly(*_K);
     LinAlg::finalizeAssembly(*_b);
     MathLib::LinAlg::finalizeAssembly(*_Jac);
 
     NumLib::GlobalVectorProvider::provider.releaseVector(xdot);
 }
 
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Newton>::
+    assembleResidual(const GlobalVector& x_new_timestep)
+{
+    // The residual is computed from M, K and b or from b alone, therefore
+    // only the global Jacobian can be left out.
+    _ode.setJacobianAssembly(false);
+    assemble(x_new_timestep);
+    _ode.setJacobianAssembly(true);
+}
+
 void TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Newton>::getResidual(GlobalVector const& x_new_timestep,
                                              GlobalVector& res) const
 {
+    if (_residual_only_assembly)
+    {
+        // The residual has been assembled at x_new_timestep already.
+        MathLib::LinAlg::copy(*_b, res);
+        MathLib::LinAlg::scale(res, -1.0);
+        return;
+    }
+
     // TODO Maybe the duplicate calculation of xdot here and in assembleJacobian
     //      can be optimuized. However, that would make the interface a bit more
     //      fragile.
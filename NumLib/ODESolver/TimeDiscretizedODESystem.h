@@ -85,6 +85,8 @@ public:
 
     void assemble(const GlobalVector& x_new_timestep) override;
 
+    void assembleResidual(const GlobalVector& x_new_timestep) override;
+
     void getResidual(GlobalVector const& x_new_timestep,
                      GlobalVector& res) const override;
 
@@ -112,9 +114,21 @@ public:
         return _ode.postIteration(x);
     }
 
+    double getScatterTime() const override { return _ode.getScatterTime(); }
+
+    std::vector<GlobalIndexType> const* getActiveIndices() const override
+    {
+        return _ode.getActiveIndices();
+    }
+
     void pushMatrices() const override
     {
-        _mat_trans->pushMatrices(*_M, *_K, *_b);
+        // The time discretizations supporting the residual-only assembly do
+        // not store previous matrices.
+        if (!_residual_only_assembly)
+        {
+            _mat_trans->pushMatrices(*_M, *_K, *_b);
+        }
     }
 
     TimeDisc& getTimeDiscretization() override { return _time_disc; }
@@ -131,14 +145,18 @@ private:
     //! the object used to compute the matrix/vector for the nonlinear solver
     std::unique_ptr<MatTrans> _mat_trans;
 
+    //! If set, the ODE assembles the negative residual into \c _b and \c _M
+    //! and \c _K are not allocated.
+    bool const _residual_only_assembly;
+
     using Index = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
     std::vector<NumLib::IndexValueVector<Index>> const* _known_solutions =
         nullptr;  //!< stores precomputed values for known solutions
 
-    GlobalMatrix* _Jac;  //!< the Jacobian of the residual
-    GlobalMatrix* _M;    //!< Matrix \f$ M \f$.
-    GlobalMatrix* _K;    //!< Matrix \f$ K \f$.
-    GlobalVector* _b;    //!< Matrix \f$ b \f$.
+    GlobalMatrix* _Jac;           //!< the Jacobian of the residual
+    GlobalMatrix* _M = nullptr;   //!< Matrix \f$ M \f$.
+    GlobalMatrix* _K = nullptr;   //!< Matrix \f$ K \f$.
+    GlobalVector* _b;             //!< Matrix \f$ b \f$.
 
     std::size_t _Jac_id = 0u;  //!< ID of the \c _Jac matrix.
     std::size_t _M_id = 0u;    //!< ID of the \c _M matrix.
@@ -213,6 +231,13 @@ public:
         return _ode.postIteration(x);
     }
 
+    double getScatterTime() const override { return _ode.getScatterTime(); }
+
+    std::vector<GlobalIndexType> const* getActiveIndices() const override
+    {
+        return _ode.getActiveIndices();
+    }
+
     void pushMatrices() const override
     {
         _mat_trans->pushMatrices(*_M, *_K, *_b);
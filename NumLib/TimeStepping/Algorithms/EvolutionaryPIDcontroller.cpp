@@ -11,12 +11,16 @@
 
 #include "EvolutionaryPIDcontroller.h"
 
+#include <cstdint>
 #include <functional>
+#include <istream>
 #include <limits>
+#include <ostream>
 #include <vector>
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Algorithm.h"
+#include "BaseLib/FileTools.h"
 
 namespace NumLib
 {
@@ -173,4 +177,28 @@ void EvolutionaryPIDcontroller::addFixedOutputTimes(
     // Remove possible duplicated elements and sort in descending order.
     BaseLib::makeVectorUnique(_fixed_output_times, std::greater<double>());
 }
+
+void EvolutionaryPIDcontroller::writeCheckpoint(std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    BaseLib::writeValueBinary(os, _e_n_minus1);
+    BaseLib::writeValueBinary(os, _e_n_minus2);
+    BaseLib::writeValueBinary(os, static_cast<std::uint8_t>(_is_accepted));
+    // Fixed output times are removed once they have been reached.
+    BaseLib::writeValueBinary(
+        os, static_cast<std::uint64_t>(_fixed_output_times.size()));
+    BaseLib::writeArrayBinary(os, _fixed_output_times.data(),
+                              _fixed_output_times.size());
+}
+
+void EvolutionaryPIDcontroller::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    _e_n_minus1 = BaseLib::readBinaryValue<double>(is);
+    _e_n_minus2 = BaseLib::readBinaryValue<double>(is);
+    _is_accepted = BaseLib::readBinaryValue<std::uint8_t>(is) != 0;
+    _fixed_output_times.resize(BaseLib::readBinaryValue<std::uint64_t>(is));
+    BaseLib::readArrayBinary(is, _fixed_output_times.data(),
+                             _fixed_output_times.size());
+}
 }  // namespace NumLib
@@ -15,9 +15,14 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <istream>
 #include <limits>
+#include <ostream>
 #include <utility>
 
+#include "BaseLib/FileTools.h"
+
 namespace NumLib
 {
 IterationNumberBasedTimeStepping::IterationNumberBasedTimeStepping(
@@ -123,4 +128,20 @@ bool IterationNumberBasedTimeStepping::accepted() const
 {
     return _accepted;
 }
+
+void IterationNumberBasedTimeStepping::writeCheckpoint(std::ostream& os) const
+{
+    TimeStepAlgorithm::writeCheckpoint(os);
+    BaseLib::writeValueBinary(os, static_cast<std::int32_t>(_iter_times));
+    BaseLib::writeValueBinary(os, static_cast<std::int32_t>(_n_rejected_steps));
+    BaseLib::writeValueBinary(os, static_cast<std::uint8_t>(_accepted));
+}
+
+void IterationNumberBasedTimeStepping::readCheckpoint(std::istream& is)
+{
+    TimeStepAlgorithm::readCheckpoint(is);
+    _iter_times = BaseLib::readBinaryValue<std::int32_t>(is);
+    _n_rejected_steps = BaseLib::readBinaryValue<std::int32_t>(is);
+    _accepted = BaseLib::readBinaryValue<std::uint8_t>(is) != 0;
+}
 }  // namespace NumLib
@@ -102,6 +102,9 @@ public:
     /// Return the number of repeated steps.
     int getNumberOfRepeatedSteps() const { return _n_rejected_steps; }
 
+    void writeCheckpoint(std::ostream& os) const override;
+    void readCheckpoint(std::istream& is) override;
+
 private:
     /// Calculate the next time step size.
     double getNextTimeStepSize() const;
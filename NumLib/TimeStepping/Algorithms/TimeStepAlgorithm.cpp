@@ -0,0 +1,61 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "TimeStepAlgorithm.h"
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include "BaseLib/FileTools.h"
+
+namespace
+{
+void writeTimeStep(std::ostream& os, NumLib::TimeStep const& ts)
+{
+    BaseLib::writeValueBinary(os, ts.previous());
+    BaseLib::writeValueBinary(os, ts.current());
+    BaseLib::writeValueBinary(os, ts.dt());
+    BaseLib::writeValueBinary(os, static_cast<std::uint64_t>(ts.steps()));
+}
+
+NumLib::TimeStep readTimeStep(std::istream& is)
+{
+    auto const previous = BaseLib::readBinaryValue<double>(is);
+    auto const current = BaseLib::readBinaryValue<double>(is);
+    auto const dt = BaseLib::readBinaryValue<double>(is);
+    auto const steps = BaseLib::readBinaryValue<std::uint64_t>(is);
+    return {previous, current, dt, static_cast<std::size_t>(steps)};
+}
+}  // namespace
+
+namespace NumLib
+{
+void TimeStepAlgorithm::writeCheckpoint(std::ostream& os) const
+{
+    writeTimeStep(os, _ts_prev);
+    writeTimeStep(os, _ts_current);
+    BaseLib::writeValueBinary(os, static_cast<std::uint64_t>(_dt_vector.size()));
+    BaseLib::writeArrayBinary(os, _dt_vector.data(), _dt_vector.size());
+}
+
+void TimeStepAlgorithm::readCheckpoint(std::istream& is)
+{
+    _ts_prev = readTimeStep(is);
+    _ts_current = readTimeStep(is);
+    auto const n_dt = BaseLib::readBinaryValue<std::uint64_t>(is);
+    if (!is)
+    {
+        OGS_FATAL("Could not read the time stepper state from the checkpoint.");
+    }
+    _dt_vector.resize(n_dt);
+    BaseLib::readArrayBinary(is, _dt_vector.data(), _dt_vector.size());
+}
+}  // namespace NumLib
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <cmath>
+#include <iosfwd>
 #include <vector>
 
 #include "BaseLib/Error.h"
@@ -123,6 +124,14 @@ public:
     {
     }
 
+    /// Writes the internal state, i.e., the previous and current time steps,
+    /// the history of time step sizes and algorithm specific data, as binary
+    /// into \c os.
+    virtual void writeCheckpoint(std::ostream& os) const;
+
+    /// Restores the internal state written by writeCheckpoint().
+    virtual void readCheckpoint(std::istream& is);
+
 protected:
     /// initial time
     const double _t_initial;
@@ -53,6 +53,21 @@ public:
     {
     }
 
+    /**
+     * Initialize a time step with the given step size, which might differ
+     * from \c current_time - \c previous_time by round-off errors, e.g. if
+     * the time step is restored from a checkpoint.
+     * @param previous_time    previous time
+     * @param current_time     current time
+     * @param dt               time step size
+     * @param n                the number of time steps
+     */
+    TimeStep(double previous_time, double current_time, double dt,
+             std::size_t n)
+        : _previous(previous_time), _current(current_time), _dt(dt), _steps(n)
+    {
+    }
+
     /// copy a time step
     TimeStep(const TimeStep& src)
         : _previous(src._previous),
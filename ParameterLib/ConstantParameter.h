@@ -50,25 +50,31 @@ struct ConstantParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(_values, pos);
     }
 
-    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
-        MeshLib::Element const& element, double const /*t*/) const override
+    void evaluate(double const t, SpatialPosition const& pos,
+                  typename Parameter<T>::ValuesRef values) const override
     {
-        auto const n_nodes = element.getNumberOfNodes();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
-            n_nodes, getNumberOfComponents());
-
-        // Column vector of values, copied for each node.
-        auto const row_values =
-            Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                _values.data(), _values.size());
-        for (unsigned i = 0; i < n_nodes; ++i)
+        if (this->_coordinate_system)
         {
-            result.row(i) = row_values;
+            Parameter<T>::evaluate(t, pos, values);
+            return;
         }
-        return result;
+        values = valuesMap();
+    }
+
+    void evaluateNodalValuesOnElement(
+        MeshLib::Element const& /*element*/, double const /*t*/,
+        typename Parameter<T>::NodalValuesRef values) const override
+    {
+        // Column vector of values, copied for each node.
+        values.rowwise() = valuesMap().transpose();
     }
 
 private:
+    Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const> valuesMap() const
+    {
+        return {_values.data(), static_cast<Eigen::Index>(_values.size())};
+    }
+
     std::vector<T> const _values;
 };
 
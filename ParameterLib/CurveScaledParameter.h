@@ -65,6 +65,17 @@ struct CurveScaledParameter final : public Parameter<T>
         return cache;
     }
 
+    void evaluate(double const t, SpatialPosition const& pos,
+                  typename Parameter<T>::ValuesRef values) const override
+    {
+        assert(!this->_coordinate_system ||
+               "Coordinate system not expected to be set for curve scaled "
+               "parameters.");
+
+        _parameter->evaluate(t, pos, values);
+        values *= _curve.getValue(t);
+    }
+
 private:
     MathLib::PiecewiseLinearInterpolation const& _curve;
     Parameter<T> const* _parameter;
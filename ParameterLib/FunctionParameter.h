@@ -10,9 +10,14 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <exprtk.hpp>
 
 #include "MeshLib/Elements/Element.h"
@@ -28,6 +33,11 @@ namespace ParameterLib
 ///
 /// Currently, x, y, and z are supported as variables
 /// of the functions.
+///
+/// The compiled expressions store the values of x, y, and z in their symbol
+/// table. Therefore, the parameter holds a set of expressions for each OpenMP
+/// thread, and all evaluation methods may be called concurrently from the
+/// threads of a (non-nested) parallel region.
 template <typename T>
 struct FunctionParameter final : public Parameter<T>
 {
@@ -47,23 +57,19 @@ struct FunctionParameter final : public Parameter<T>
     FunctionParameter(std::string const& name,
                       MeshLib::Mesh const& mesh,
                       std::vector<std::string> const& vec_expression_str)
-        : Parameter<T>(name, &mesh), _vec_expression_str(vec_expression_str)
+        : Parameter<T>(name, &mesh),
+          _vec_expression_str(vec_expression_str)
     {
-        _symbol_table.add_constants();
-        _symbol_table.create_variable("x");
-        _symbol_table.create_variable("y");
-        _symbol_table.create_variable("z");
-
-        _vec_expression.resize(_vec_expression_str.size());
-        for (unsigned i = 0; i < _vec_expression_str.size(); i++)
+#ifdef _OPENMP
+        int const number_of_threads = omp_get_max_threads();
+#else
+        int const number_of_threads = 1;
+#endif
+        _thread_expressions.reserve(number_of_threads);
+        for (int i = 0; i < number_of_threads; ++i)
         {
-            _vec_expression[i].register_symbol_table(_symbol_table);
-            parser_t parser;
-            if (!parser.compile(_vec_expression_str[i], _vec_expression[i]))
-            {
-                OGS_FATAL("Error: %s\tExpression: %s\n", parser.error().c_str(),
-                          _vec_expression_str[i].c_str());
-            }
+            _thread_expressions.push_back(
+                std::make_unique<CompiledExpressions>(_vec_expression_str));
         }
     }
 
@@ -71,16 +77,123 @@ struct FunctionParameter final : public Parameter<T>
 
     int getNumberOfComponents() const override
     {
-        return _vec_expression.size();
+        return _vec_expression_str.size();
     }
 
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
         std::vector<T> cache(getNumberOfComponents());
-        auto& x = _symbol_table.get_variable("x")->ref();
-        auto& y = _symbol_table.get_variable("y")->ref();
-        auto& z = _symbol_table.get_variable("z")->ref();
+        evaluateExpressions(
+            threadExpressions(), pos,
+            Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1>>(cache.data(),
+                                                            cache.size()));
+
+        if (!this->_coordinate_system)
+        {
+            return cache;
+        }
+
+        return this->rotateWithCoordinateSystem(cache, pos);
+    }
+
+    void evaluate(double const t, SpatialPosition const& pos,
+                  typename Parameter<T>::ValuesRef values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+        evaluateExpressions(threadExpressions(), pos, values);
+    }
+
+    void evaluateAtNodes(
+        double const t, std::vector<MeshLib::Node*> const& nodes,
+        typename Parameter<T>::NodalValuesRef values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluateAtNodes(t, nodes, values);
+            return;
+        }
+        assert(values.rows() == static_cast<Eigen::Index>(nodes.size()));
+
+        auto const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+#pragma omp parallel
+        {
+            auto const& thread_expressions = threadExpressions();
+            SpatialPosition x_position;
+#pragma omp for schedule(static)
+            for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+            {
+                x_position.setNodeID(nodes[i]->getID());
+                evaluateExpressions(thread_expressions, x_position,
+                                    values.row(i).transpose());
+            }
+        }
+    }
+
+private:
+    //! Expressions of all components sharing a symbol table with the
+    //! variables x, y, and z.
+    struct CompiledExpressions
+    {
+        explicit CompiledExpressions(
+            std::vector<std::string> const& vec_expression_str)
+        {
+            symbol_table.add_constants();
+            symbol_table.create_variable("x");
+            symbol_table.create_variable("y");
+            symbol_table.create_variable("z");
+
+            vec_expression.resize(vec_expression_str.size());
+            for (unsigned i = 0; i < vec_expression_str.size(); i++)
+            {
+                vec_expression[i].register_symbol_table(symbol_table);
+                parser_t parser;
+                if (!parser.compile(vec_expression_str[i], vec_expression[i]))
+                {
+                    OGS_FATAL("Error: %s\tExpression: %s\n",
+                              parser.error().c_str(),
+                              vec_expression_str[i].c_str());
+                }
+            }
+        }
+
+        CompiledExpressions(CompiledExpressions const&) = delete;
+        CompiledExpressions& operator=(CompiledExpressions const&) = delete;
+
+        symbol_table_t symbol_table;
+        std::vector<expression_t> vec_expression;
+    };
+
+    //! Returns the expressions of the calling OpenMP thread.
+    CompiledExpressions const& threadExpressions() const
+    {
+#ifdef _OPENMP
+        auto const thread_id = static_cast<std::size_t>(omp_get_thread_num());
+#else
+        std::size_t const thread_id = 0;
+#endif
+        if (thread_id >= _thread_expressions.size())
+        {
+            OGS_FATAL(
+                "FunctionParameter '%s' was created for %d threads, but is "
+                "evaluated by thread %d.",
+                this->name.c_str(), _thread_expressions.size(), thread_id);
+        }
+        return *_thread_expressions[thread_id];
+    }
+
+    //! Evaluates the expressions at the given position without rotation.
+    void evaluateExpressions(CompiledExpressions const& expressions,
+                             SpatialPosition const& pos,
+                             typename Parameter<T>::ValuesRef values) const
+    {
+        auto& x = expressions.symbol_table.get_variable("x")->ref();
+        auto& y = expressions.symbol_table.get_variable("y")->ref();
+        auto& z = expressions.symbol_table.get_variable("z")->ref();
         if (pos.getCoordinates())
         {
             auto const coords = pos.getCoordinates().get();
@@ -97,23 +210,17 @@ struct FunctionParameter final : public Parameter<T>
             z = node[2];
         }
 
-        for (unsigned i = 0; i < _vec_expression.size(); i++)
+        for (unsigned i = 0; i < expressions.vec_expression.size(); i++)
         {
-            cache[i] = _vec_expression[i].value();
+            values[i] = expressions.vec_expression[i].value();
         }
-
-        if (!this->_coordinate_system)
-        {
-            return cache;
-        }
-
-        return this->rotateWithCoordinateSystem(cache, pos);
     }
 
-private:
     std::vector<std::string> const _vec_expression_str;
-    symbol_table_t _symbol_table;
-    std::vector<expression_t> _vec_expression;
+
+    //! Compiled expressions for each OpenMP thread, indexed by the thread
+    //! number.
+    std::vector<std::unique_ptr<CompiledExpressions>> _thread_expressions;
 };
 
 std::unique_ptr<ParameterBase> createFunctionParameter(
@@ -61,14 +61,7 @@ struct GroupBasedParameter final : public Parameter<T>
     std::vector<T> operator()(double const /*t*/,
                               SpatialPosition const& pos) const override
     {
-        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
-        assert(item_id);
-        int const index = _property_index[item_id.get()];
-        auto const& values = _vec_values[index];
-        if (values.empty())
-        {
-            OGS_FATAL("No data found for the group index %d", index);
-        }
+        auto const& values = getGroupValues(pos);
 
         if (!this->_coordinate_system)
         {
@@ -78,7 +71,33 @@ struct GroupBasedParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(values, pos);
     }
 
+    void evaluate(double const t, SpatialPosition const& pos,
+                  typename Parameter<T>::ValuesRef values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+        auto const& group_values = getGroupValues(pos);
+        values = Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
+            group_values.data(), group_values.size());
+    }
+
 private:
+    std::vector<T> const& getGroupValues(SpatialPosition const& pos) const
+    {
+        auto const item_id = getMeshItemID(pos, type<MeshItemType>());
+        assert(item_id);
+        int const index = _property_index[item_id.get()];
+        auto const& values = _vec_values[index];
+        if (values.empty())
+        {
+            OGS_FATAL("No data found for the group index %d", index);
+        }
+        return values;
+    }
+
     template <MeshLib::MeshItemType ITEM_TYPE>
     struct type
     {
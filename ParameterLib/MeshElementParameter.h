@@ -63,25 +63,44 @@ struct MeshElementParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(cache, pos);
     }
 
-    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
-        MeshLib::Element const& element, double const t) const override
+    void evaluate(double const t, SpatialPosition const& pos,
+                  typename Parameter<T>::ValuesRef values) const override
     {
-        auto const n_nodes = element.getNumberOfNodes();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
-            n_nodes, getNumberOfComponents());
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+        auto const e = pos.getElementID();
+        if (!e)
+        {
+            OGS_FATAL(
+                "Trying to access a MeshElementParameter but the element id is "
+                "not specified.");
+        }
+        for (Eigen::Index c = 0; c < values.size(); ++c)
+        {
+            values[c] = _property.getComponent(*e, c);
+        }
+    }
+
+    void evaluateNodalValuesOnElement(
+        MeshLib::Element const& element, double const t,
+        typename Parameter<T>::NodalValuesRef values) const override
+    {
+        if (values.rows() == 0)
+        {
+            return;
+        }
 
-        // Column vector of values, copied for each node.
+        // Row of values, copied for each node.
         SpatialPosition x_position;
         x_position.setElementID(element.getID());
-        auto const& values = this->operator()(t, x_position);
-        auto const row_values =
-            Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                values.data(), values.size());
-        for (unsigned i = 0; i < n_nodes; ++i)
+        evaluate(t, x_position, values.row(0).transpose());
+        for (Eigen::Index i = 1; i < values.rows(); ++i)
         {
-            result.row(i) = row_values;
+            values.row(i) = values.row(0);
         }
-        return result;
     }
 
 private:
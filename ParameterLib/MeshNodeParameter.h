@@ -67,25 +67,38 @@ struct MeshNodeParameter final : public Parameter<T>
         return this->rotateWithCoordinateSystem(cache, pos);
     }
 
-    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
-        MeshLib::Element const& element, double const t) const override
+    void evaluate(double const t, SpatialPosition const& pos,
+                  typename Parameter<T>::ValuesRef values) const override
     {
-        auto const n_nodes = element.getNumberOfNodes();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
-            n_nodes, getNumberOfComponents());
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::evaluate(t, pos, values);
+            return;
+        }
+        auto const n = pos.getNodeID();
+        if (!n)
+        {
+            OGS_FATAL(
+                "Trying to access a MeshNodeParameter but the node id is not "
+                "specified.");
+        }
+        for (Eigen::Index c = 0; c < values.size(); ++c)
+        {
+            values[c] = _property.getComponent(*n, c);
+        }
+    }
 
+    void evaluateNodalValuesOnElement(
+        MeshLib::Element const& element, double const t,
+        typename Parameter<T>::NodalValuesRef values) const override
+    {
         SpatialPosition x_position;
         auto const nodes = element.getNodes();
-        for (unsigned i = 0; i < n_nodes; ++i)
+        for (Eigen::Index i = 0; i < values.rows(); ++i)
         {
             x_position.setNodeID(nodes[i]->getID());
-            auto const& values = this->operator()(t, x_position);
-            result.row(i) =
-                Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                    values.data(), values.size());
+            evaluate(t, x_position, values.row(i).transpose());
         }
-
-        return result;
     }
 
 private:
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <map>
 #include <memory>
 #include <utility>
@@ -142,6 +143,18 @@ struct Parameter : public ParameterBase
 {
     using ParameterBase::ParameterBase;
 
+    //! Vector of the components of a parameter value, which is e.g. a map of
+    //! a caller-provided buffer or a row of a matrix of nodal values.
+    using ValuesRef = Eigen::Ref<Eigen::Matrix<T, Eigen::Dynamic, 1>, 0,
+                                 Eigen::InnerStride<>>;
+    //! Matrix of nodal values, one row per node and one column per component.
+    using NodalValuesRef =
+        Eigen::Ref<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>>;
+
+    //! Maximum number of components evaluated into a buffer on the stack by
+    //! scalarValue(), which covers all tensors in 3D.
+    static constexpr int max_stack_components = 9;
+
     ~Parameter() override = default;
 
     //! Returns the number of components this Parameter has at every position
@@ -152,39 +165,98 @@ struct Parameter : public ParameterBase
     virtual std::vector<T> operator()(double const t,
                                       SpatialPosition const& pos) const = 0;
 
+    //! Writes the parameter value at the given time and position into
+    //! \c values, which has getNumberOfComponents() entries.
+    //!
+    //! Contrary to operator() the parameters implementing this method do not
+    //! allocate memory unless a local coordinate system is set. The default
+    //! implementation copies the result of operator().
+    virtual void evaluate(double const t, SpatialPosition const& pos,
+                          ValuesRef values) const
+    {
+        auto const result = this->operator()(t, pos);
+        assert(values.size() == static_cast<Eigen::Index>(result.size()));
+        values = Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
+            result.data(), result.size());
+    }
+
+    //! Returns the first component of the parameter value at the given time
+    //! and position, e.g. the value of a scalar parameter, without allocating
+    //! memory.
+    T scalarValue(double const t, SpatialPosition const& pos) const
+    {
+        auto const n_components = getNumberOfComponents();
+        if (n_components > max_stack_components)
+        {
+            return this->operator()(t, pos)[0];
+        }
+        Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor,
+                      max_stack_components, 1>
+            values(n_components);
+        evaluate(t, pos, values);
+        return values[0];
+    }
+
     //! Returns a matrix of values for all nodes of the given element.
     //
     // The matrix is of the shape NxC, where N is the number of nodes and C is
     // the number of components, such that subsequent multiplication with shape
     // functions matrix from left (which is a row vector) results in a row
     // vector of length C.
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> getNodalValuesOnElement(
+        MeshLib::Element const& element, double const t) const
+    {
+        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(
+            element.getNumberOfNodes(), getNumberOfComponents());
+        evaluateNodalValuesOnElement(element, t, result);
+        return result;
+    }
+
+    //! Writes the values of the first \c values.rows() nodes of the given
+    //! element into the rows of \c values, which has getNumberOfComponents()
+    //! columns. In contrast to getNodalValuesOnElement() the values can be
+    //! written directly into e.g. a fixed-size nodal vector of a local
+    //! assembler.
     //
     // The default implementation covers all cases, but the derived classes may
     // provide faster implementations.
-    virtual Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>
-    getNodalValuesOnElement(MeshLib::Element const& element,
-                            double const t) const
+    virtual void evaluateNodalValuesOnElement(MeshLib::Element const& element,
+                                              double const t,
+                                              NodalValuesRef values) const
     {
-        auto const n_nodes = static_cast<int>(element.getNumberOfNodes());
-        auto const n_components = getNumberOfComponents();
-        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> result(n_nodes,
-                                                                n_components);
+        assert(values.rows() <=
+               static_cast<Eigen::Index>(element.getNumberOfNodes()));
+        assert(values.cols() == getNumberOfComponents());
 
-        // Column vector of values, copied for each node.
         SpatialPosition x_position;
         auto const nodes = element.getNodes();
-        for (int i = 0; i < n_nodes; ++i)
+        for (Eigen::Index i = 0; i < values.rows(); ++i)
         {
             x_position.setAll(
                 nodes[i]->getID(), element.getID(), boost::none, boost::none);
-            auto const& values = this->operator()(t, x_position);
-            auto const row_values =
-                Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, 1> const>(
-                    values.data(), values.size());
-            result.row(i) = row_values;
+            evaluate(t, x_position, values.row(i).transpose());
         }
+    }
 
-        return result;
+    //! Writes the values at the given nodes into the rows of \c values, which
+    //! has getNumberOfComponents() columns. The nodes are identified by their
+    //! ids like in operator().
+    //
+    // The default implementation evaluates the nodes one by one, but the
+    // derived classes may provide faster implementations.
+    virtual void evaluateAtNodes(double const t,
+                                 std::vector<MeshLib::Node*> const& nodes,
+                                 NodalValuesRef values) const
+    {
+        assert(values.rows() == static_cast<Eigen::Index>(nodes.size()));
+        assert(values.cols() == getNumberOfComponents());
+
+        SpatialPosition x_position;
+        for (Eigen::Index i = 0; i < values.rows(); ++i)
+        {
+            x_position.setNodeID(nodes[i]->getID());
+            evaluate(t, x_position, values.row(i).transpose());
+        }
     }
 };
 
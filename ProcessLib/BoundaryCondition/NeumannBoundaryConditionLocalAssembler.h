@@ -57,9 +57,10 @@ public:
 
         // Get element nodes for the interpolation from nodes to integration
         // point.
-        NodalVectorType parameter_node_values =
-            _neumann_bc_parameter.getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
+        NodalVectorType parameter_node_values(
+            ShapeFunction::MeshElement::n_all_nodes);
+        _neumann_bc_parameter.evaluateNodalValuesOnElement(
+            Base::_element, t, parameter_node_values);
 
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
@@ -70,7 +71,7 @@ public:
                                     ip_data.weight;
         }
 
-        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        auto const& indices = NumLib::getIndices(id, dof_table_boundary);
         b.add(indices, _local_rhs);
     }
 
@@ -124,8 +124,8 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
-        NodalVectorType pressure =
-            _pressure.getNodalValuesOnElement(_element, t);
+        NodalVectorType pressure(_element.getNumberOfNodes());
+        _pressure.evaluateNodalValuesOnElement(_element, t, pressure);
 
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
@@ -148,7 +148,7 @@ public:
             _local_rhs.noalias() -= n.transpose() * N_u * pressure.dot(N) * w;
         }
 
-        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        auto const& indices = NumLib::getIndices(id, dof_table_boundary);
         local_rhs.add(indices, _local_rhs);
     }
 
@@ -87,55 +87,33 @@ void PythonBoundaryCondition::getEssentialBCValues(
     FlushStdoutGuard guard(_flush_stdout);
     (void)guard;
 
-    auto const nodes = _bc_data.boundary_mesh.getNodes();
-
-    auto const& bulk_node_ids_map =
-        *_bc_data.boundary_mesh.getProperties().getPropertyVector<std::size_t>(
-            "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
-
     bc_values.ids.clear();
     bc_values.values.clear();
 
     bc_values.ids.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
     bc_values.values.reserve(_bc_data.boundary_mesh.getNumberOfNodes());
 
-    std::vector<double> primary_variables;
+    if (_bc_data.bc_object->isOverriddenEssentialBatched() &&
+        getEssentialBCValuesBatched(t, x, bc_values))
+    {
+        return;
+    }
+
+    auto const nodes = _bc_data.boundary_mesh.getNodes();
+
+    auto const& bulk_node_ids_map =
+        *_bc_data.boundary_mesh.getProperties().getPropertyVector<std::size_t>(
+            "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
+
+    std::vector<double> primary_variables(
+        _dof_table_boundary->getNumberOfComponents());
 
     for (auto const* node : _bc_data.boundary_mesh.getNodes())
     {
         auto const boundary_node_id = node->getID();
         auto const bulk_node_id = bulk_node_ids_map[boundary_node_id];
 
-        // gather primary variable values
-        primary_variables.clear();
-        auto const num_var = _dof_table_boundary->getNumberOfVariables();
-        for (int var = 0; var < num_var; ++var)
-        {
-            auto const num_comp =
-                _dof_table_boundary->getNumberOfVariableComponents(var);
-            for (int comp = 0; comp < num_comp; ++comp)
-            {
-                MeshLib::Location loc{_bc_data.bulk_mesh_id,
-                                      MeshLib::MeshItemType::Node,
-                                      bulk_node_id};
-                auto const dof_idx =
-                    _bc_data.dof_table_bulk.getGlobalIndex(loc, var, comp);
-
-                if (dof_idx == NumLib::MeshComponentMap::nop)
-                {
-                    // TODO extend Python BC to mixed FEM ansatz functions
-                    OGS_FATAL(
-                        "No d.o.f. found for (node=%d, var=%d, comp=%d).  "
-                        "That might be due to the use of mixed FEM ansatz "
-                        "functions, which is currently not supported by "
-                        "the implementation of Python BCs. That excludes, "
-                        "e.g., the HM process.",
-                        bulk_node_id, var, comp);
-                }
-
-                primary_variables.push_back(x[dof_idx]);
-            }
-        }
+        gatherPrimaryVariables(bulk_node_id, x, primary_variables.data());
 
         auto* xs = nodes[boundary_node_id]->getCoords();  // TODO DDC problems?
         auto pair_flag_value = _bc_data.bc_object->getDirichletBCValue(
@@ -153,32 +131,131 @@ void PythonBoundaryCondition::getEssentialBCValues(
             continue;
         }
 
-        MeshLib::Location l(_bc_data.bulk_mesh_id, MeshLib::MeshItemType::Node,
-                            bulk_node_id);
-        const auto dof_idx = _bc_data.dof_table_bulk.getGlobalIndex(
-            l, _bc_data.global_component_id);
-        if (dof_idx == NumLib::MeshComponentMap::nop)
+        addEssentialBCValue(bulk_node_id, pair_flag_value.second, bc_values);
+    }
+}
+
+bool PythonBoundaryCondition::getEssentialBCValuesBatched(
+    const double t, GlobalVector const& x,
+    NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
+{
+    using Interface = PythonBoundaryConditionPythonSideInterface;
+
+    auto const& nodes = _bc_data.boundary_mesh.getNodes();
+    auto const n_nodes = static_cast<Eigen::Index>(nodes.size());
+
+    auto const& bulk_node_ids_map =
+        *_bc_data.boundary_mesh.getProperties().getPropertyVector<std::size_t>(
+            "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
+
+    Interface::Matrix coords(n_nodes, 3);
+    Interface::NodeIds node_ids(n_nodes);
+    Interface::Matrix primary_variables(
+        n_nodes, _dof_table_boundary->getNumberOfComponents());
+    for (Eigen::Index i = 0; i < n_nodes; ++i)
+    {
+        auto const boundary_node_id = nodes[i]->getID();
+        coords.row(i) = Eigen::Map<Eigen::RowVector3d const>(
+            nodes[i]->getCoords());  // TODO DDC problems?
+        node_ids[i] = boundary_node_id;
+        gatherPrimaryVariables(bulk_node_ids_map[boundary_node_id], x,
+                               primary_variables.row(i).data());
+    }
+
+    auto const flags_values = _bc_data.bc_object->getDirichletBCValues(
+        t, coords, node_ids, primary_variables);
+    if (!_bc_data.bc_object->isOverriddenEssentialBatched())
+    {
+        DBUG(
+            "Method `getDirichletBCValues' not overridden in Python script. "
+            "Calling `getDirichletBCValue' for each node.");
+        return false;
+    }
+
+    auto const& is_dirichlet = flags_values.first;
+    auto const& values = flags_values.second;
+    if (is_dirichlet.size() != n_nodes || values.size() != n_nodes)
+    {
+        OGS_FATAL(
+            "The Python BC must return one flag and one value per node. %d "
+            "nodes expected. %d flags and %d values returned from Python.",
+            n_nodes, is_dirichlet.size(), values.size());
+    }
+
+    for (Eigen::Index i = 0; i < n_nodes; ++i)
+    {
+        if (is_dirichlet[i])
         {
-            OGS_FATAL(
-                "Logic error. This error should already have occured while "
-                "gathering primary variables. Something nasty is going on!");
+            addEssentialBCValue(bulk_node_ids_map[nodes[i]->getID()],
+                                values[i], bc_values);
         }
+    }
+    return true;
+}
 
-        // For the DDC approach (e.g. with PETSc option), the negative
-        // index of g_idx means that the entry by that index is a ghost
-        // one, which should be dropped. Especially for PETSc routines
-        // MatZeroRows and MatZeroRowsColumns, which are called to apply
-        // the Dirichlet BC, the negative index is not accepted like
-        // other matrix or vector PETSc routines. Therefore, the
-        // following if-condition is applied.
-        if (dof_idx >= 0)
+void PythonBoundaryCondition::gatherPrimaryVariables(
+    std::size_t const bulk_node_id, GlobalVector const& x,
+    double* const primary_variables) const
+{
+    int global_component = 0;
+    auto const num_var = _dof_table_boundary->getNumberOfVariables();
+    for (int var = 0; var < num_var; ++var)
+    {
+        auto const num_comp =
+            _dof_table_boundary->getNumberOfVariableComponents(var);
+        for (int comp = 0; comp < num_comp; ++comp)
         {
-            bc_values.ids.emplace_back(dof_idx);
-            bc_values.values.emplace_back(pair_flag_value.second);
+            MeshLib::Location loc{_bc_data.bulk_mesh_id,
+                                  MeshLib::MeshItemType::Node, bulk_node_id};
+            auto const dof_idx =
+                _bc_data.dof_table_bulk.getGlobalIndex(loc, var, comp);
+
+            if (dof_idx == NumLib::MeshComponentMap::nop)
+            {
+                // TODO extend Python BC to mixed FEM ansatz functions
+                OGS_FATAL(
+                    "No d.o.f. found for (node=%d, var=%d, comp=%d).  "
+                    "That might be due to the use of mixed FEM ansatz "
+                    "functions, which is currently not supported by "
+                    "the implementation of Python BCs. That excludes, "
+                    "e.g., the HM process.",
+                    bulk_node_id, var, comp);
+            }
+
+            primary_variables[global_component++] = x[dof_idx];
         }
     }
 }
 
+void PythonBoundaryCondition::addEssentialBCValue(
+    std::size_t const bulk_node_id, double const value,
+    NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
+{
+    MeshLib::Location l(_bc_data.bulk_mesh_id, MeshLib::MeshItemType::Node,
+                        bulk_node_id);
+    const auto dof_idx = _bc_data.dof_table_bulk.getGlobalIndex(
+        l, _bc_data.global_component_id);
+    if (dof_idx == NumLib::MeshComponentMap::nop)
+    {
+        OGS_FATAL(
+            "Logic error. This error should already have occured while "
+            "gathering primary variables. Something nasty is going on!");
+    }
+
+    // For the DDC approach (e.g. with PETSc option), the negative
+    // index of g_idx means that the entry by that index is a ghost
+    // one, which should be dropped. Especially for PETSc routines
+    // MatZeroRows and MatZeroRowsColumns, which are called to apply
+    // the Dirichlet BC, the negative index is not accepted like
+    // other matrix or vector PETSc routines. Therefore, the
+    // following if-condition is applied.
+    if (dof_idx >= 0)
+    {
+        bc_values.ids.emplace_back(dof_idx);
+        bc_values.values.emplace_back(value);
+    }
+}
+
 void PythonBoundaryCondition::applyNaturalBC(const double t,
                                              const GlobalVector& x,
                                              GlobalMatrix& K, GlobalVector& b,
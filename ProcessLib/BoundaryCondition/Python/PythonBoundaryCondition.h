@@ -58,6 +58,24 @@ public:
                         GlobalVector& b, GlobalMatrix* Jac) override;
 
 private:
+    //! Computes the Dirichlet BC values of all nodes by a single call of
+    //! PythonBoundaryConditionPythonSideInterface::getDirichletBCValues().
+    //! Returns false if that method is not overridden in the Python script.
+    bool getEssentialBCValuesBatched(
+        const double t, const GlobalVector& x,
+        NumLib::IndexValueVector<GlobalIndexType>& bc_values) const;
+
+    //! Writes the values of all primary variables at the given bulk node to
+    //! \c primary_variables, which must have space for all components.
+    void gatherPrimaryVariables(std::size_t const bulk_node_id,
+                                GlobalVector const& x,
+                                double* const primary_variables) const;
+
+    //! Adds the Dirichlet BC value at the given bulk node to \c bc_values.
+    void addEssentialBCValue(
+        std::size_t const bulk_node_id, double const value,
+        NumLib::IndexValueVector<GlobalIndexType>& bc_values) const;
+
     //! Auxiliary data.
     PythonBoundaryConditionData _bc_data;
 
@@ -171,15 +171,14 @@ public:
             }
         }
 
-        auto const& indices_specific_component =
-            dof_table_boundary(boundary_element_id, _data.global_component_id)
-                .rows;
+        auto const indices_specific_component =
+            dof_table_boundary(boundary_element_id, _data.global_component_id);
         b.add(indices_specific_component, local_rhs);
 
         if (Jac)
         {
             // only assemble a block of the Jacobian, not the whole local matrix
-            auto const indices_all_components =
+            auto const& indices_all_components =
                 NumLib::getIndices(boundary_element_id, dof_table_boundary);
             MathLib::RowColumnIndices<GlobalIndexType> rci{
                 indices_specific_component, indices_all_components};
@@ -10,6 +10,7 @@
 
 #include "PythonBoundaryConditionModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/stl.h>
 
 #include "PythonBoundaryConditionPythonSideInterface.h"
@@ -36,6 +37,17 @@ public:
                           primary_variables);
     }
 
+    std::pair<Flags, Eigen::VectorXd> getDirichletBCValues(
+        double t, Eigen::Ref<Matrix const> coords,
+        Eigen::Ref<NodeIds const> node_ids,
+        Eigen::Ref<Matrix const> primary_variables) const override
+    {
+        using Ret = std::pair<Flags, Eigen::VectorXd>;
+        PYBIND11_OVERLOAD(Ret, PythonBoundaryConditionPythonSideInterface,
+                          getDirichletBCValues, t, coords, node_ids,
+                          primary_variables);
+    }
+
     std::tuple<bool, double, std::vector<double>> getFlux(
         double t, std::array<double, 3> x,
         std::vector<double> const& primary_variables) const override
@@ -58,6 +70,8 @@ void pythonBindBoundaryCondition(pybind11::module& m)
 
     pybc.def("getDirichletBCValue",
              &PythonBoundaryConditionPythonSideInterface::getDirichletBCValue);
+    pybc.def("getDirichletBCValues",
+             &PythonBoundaryConditionPythonSideInterface::getDirichletBCValues);
     pybc.def("getFlux", &PythonBoundaryConditionPythonSideInterface::getFlux);
 }
 
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 //! Base class for boundary conditions.
@@ -18,6 +20,13 @@ namespace ProcessLib
 class PythonBoundaryConditionPythonSideInterface
 {
 public:
+    //! Row-major s.t. each row, e.g. the coordinates of one node, is
+    //! contiguous in memory.
+    using Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                                 Eigen::RowMajor>;
+    using NodeIds = Eigen::Matrix<std::size_t, Eigen::Dynamic, 1>;
+    using Flags = Eigen::Matrix<bool, Eigen::Dynamic, 1>;
+
     /*!
      * Computes Dirichlet boundary condition values for the provided arguments
      * (time, position of the node, node id, primary variables at the node).
@@ -34,6 +43,29 @@ public:
         return {false, std::numeric_limits<double>::quiet_NaN()};
     }
 
+    /*!
+     * Computes Dirichlet boundary condition values for all nodes of the
+     * boundary at once. This is the batched version of getDirichletBCValue(),
+     * which is called for each node separately if this method is not
+     * overridden.
+     *
+     * The arguments are the time, the coordinates of the nodes (one row per
+     * node), the node ids, and the primary variables at the nodes (one row
+     * per node). On the Python side they are NumPy arrays referencing the
+     * memory of OpenGeoSys, which are only valid during the call.
+     *
+     * \return a pair (is_dirichlet, values) of arrays with one entry per node
+     * with the same meaning as the return value of getDirichletBCValue().
+     */
+    virtual std::pair<Flags, Eigen::VectorXd> getDirichletBCValues(
+        double /*t*/, Eigen::Ref<Matrix const> /*coords*/,
+        Eigen::Ref<NodeIds const> /*node_ids*/,
+        Eigen::Ref<Matrix const> /*primary_variables*/) const
+    {
+        _overridden_essential_batched = false;
+        return {};
+    }
+
     /*!
      * Computes the flux for the provided arguments (time, position, primary
      * variables at that position).
@@ -59,6 +91,15 @@ public:
     //! once.
     bool isOverriddenEssential() const { return _overridden_essential; }
 
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    //!
+    //! \pre getDirichletBCValues() must already have been called once.
+    bool isOverriddenEssentialBatched() const
+    {
+        return _overridden_essential_batched;
+    }
+
     //! Tells if getFlux() has been overridden in the derived class in Python.
     //!
     //! \pre getFlux() must already have been called once.
@@ -70,6 +111,9 @@ private:
     //! Tells if getDirichletBCValue() has been overridden in the derived class
     //! in Python.
     mutable bool _overridden_essential = true;
+    //! Tells if getDirichletBCValues() has been overridden in the derived
+    //! class in Python.
+    mutable bool _overridden_essential_batched = true;
     //! Tells if getFlux() has been overridden in the derived class in Python.
     mutable bool _overridden_natural = true;
 };
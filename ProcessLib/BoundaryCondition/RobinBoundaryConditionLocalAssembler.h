@@ -11,6 +11,7 @@
 #pragma once
 
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ParameterLib/Parameter.h"
 
@@ -46,8 +47,8 @@ public:
     // TODO also implement derivative for Jacobian in Newton scheme.
     void assemble(std::size_t const id,
                   NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
-                  double const t, const GlobalVector& /*x*/, GlobalMatrix& K,
-                  GlobalVector& b, GlobalMatrix* /*Jac*/) override
+                  double const t, const GlobalVector& x, GlobalMatrix& K,
+                  GlobalVector& b, GlobalMatrix* Jac) override
     {
         _local_K.setZero();
         _local_rhs.setZero();
@@ -55,12 +56,12 @@ public:
         unsigned const n_integration_points =
             Base::_integration_method.getNumberOfPoints();
 
-        typename Base::NodalVectorType const alpha =
-            _data.alpha.getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
-        typename Base::NodalVectorType const u_0 =
-            _data.u_0.getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
+        typename Base::NodalVectorType alpha(
+            ShapeFunction::MeshElement::n_all_nodes);
+        _data.alpha.evaluateNodalValuesOnElement(Base::_element, t, alpha);
+        typename Base::NodalVectorType u_0(
+            ShapeFunction::MeshElement::n_all_nodes);
+        _data.u_0.evaluateNodalValuesOnElement(Base::_element, t, u_0);
 
         for (unsigned ip = 0; ip < n_integration_points; ++ip)
         {
@@ -75,7 +76,18 @@ public:
             _local_rhs.noalias() += N * alpha.dot(N) * u_0.dot(N) * w;
         }
 
-        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        auto const& indices = NumLib::getIndices(id, dof_table_boundary);
+
+        // For the Newton method the K term is added to the residual directly,
+        // s.t. the global K is not needed.
+        if (Jac != nullptr)
+        {
+            auto const local_x = x.get(indices);
+            _local_rhs.noalias() -= _local_K * MathLib::toVector(local_x);
+            b.add(indices, _local_rhs);
+            return;
+        }
+
         K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices),
               _local_K);
         b.add(indices, _local_rhs);
@@ -64,21 +64,19 @@ public:
         _local_rhs.setZero();
         // Get element nodes for the interpolation from nodes to
         // integration point.
-        NodalVectorType const constant_node_values =
-            _data.constant.getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
-        NodalVectorType const coefficient_current_variable_node_values =
-            _data.coefficient_current_variable
-                .getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
-        NodalVectorType const coefficient_other_variable_node_values =
-            _data.coefficient_other_variable
-                .getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
-        NodalVectorType const coefficient_mixed_variables_node_values =
-            _data.coefficient_mixed_variables
-                .getNodalValuesOnElement(Base::_element, t)
-                .template topRows<ShapeFunction::MeshElement::n_all_nodes>();
+        auto const n_nodes = ShapeFunction::MeshElement::n_all_nodes;
+        NodalVectorType constant_node_values(n_nodes);
+        _data.constant.evaluateNodalValuesOnElement(Base::_element, t,
+                                                    constant_node_values);
+        NodalVectorType coefficient_current_variable_node_values(n_nodes);
+        _data.coefficient_current_variable.evaluateNodalValuesOnElement(
+            Base::_element, t, coefficient_current_variable_node_values);
+        NodalVectorType coefficient_other_variable_node_values(n_nodes);
+        _data.coefficient_other_variable.evaluateNodalValuesOnElement(
+            Base::_element, t, coefficient_other_variable_node_values);
+        NodalVectorType coefficient_mixed_variables_node_values(n_nodes);
+        _data.coefficient_mixed_variables.evaluateNodalValuesOnElement(
+            Base::_element, t, coefficient_mixed_variables_node_values);
         unsigned const n_integration_points =
             Base::_integration_method.getNumberOfPoints();
 
@@ -13,6 +13,17 @@
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "LocalAssemblerInterface.h"
 
+namespace
+{
+// Temporary data only stored here in order to avoid frequent memory
+// reallocations. Thread-local, because the Jacobian might be assembled
+// concurrently for different elements, see NumLib::ParallelExecutor.
+thread_local std::vector<double> local_M_data_m;
+thread_local std::vector<double> local_K_data_m;
+thread_local std::vector<double> local_b_data_m;
+thread_local std::vector<double> local_x_perturbed_data;
+}  // namespace
+
 namespace ProcessLib
 {
 CentralDifferencesJacobianAssembler::CentralDifferencesJacobianAssembler(
@@ -52,7 +63,7 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
 
     auto local_Jac = MathLib::createZeroedMatrix(local_Jac_data,
                                              num_r_c, num_r_c);
-    _local_x_perturbed_data = local_x_data;
+    local_x_perturbed_data = local_x_data;
 
     auto const num_dofs_per_component =
         local_x_data.size() / _absolute_epsilons.size();
@@ -70,48 +81,48 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
         auto const component = i / num_dofs_per_component;
         auto const eps = _absolute_epsilons[component];
 
-        _local_x_perturbed_data[i] += eps;
-        local_assembler.assemble(t, dt, _local_x_perturbed_data, local_M_data,
+        local_x_perturbed_data[i] += eps;
+        local_assembler.assemble(t, dt, local_x_perturbed_data, local_M_data,
                                  local_K_data, local_b_data);
 
-        _local_x_perturbed_data[i] = local_x_data[i] - eps;
-        local_assembler.assemble(t, dt, _local_x_perturbed_data, _local_M_data,
-                                 _local_K_data, _local_b_data);
+        local_x_perturbed_data[i] = local_x_data[i] - eps;
+        local_assembler.assemble(t, dt, local_x_perturbed_data, local_M_data_m,
+                                 local_K_data_m, local_b_data_m);
 
-        _local_x_perturbed_data[i] = local_x_data[i];
+        local_x_perturbed_data[i] = local_x_data[i];
 
         if (!local_M_data.empty()) {
             auto const local_M_p =
                 MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
             auto const local_M_m =
-                MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
+                MathLib::toMatrix(local_M_data_m, num_r_c, num_r_c);
             local_Jac.col(i).noalias() +=
                 // dM/dxi * x_dot
                 (local_M_p - local_M_m) * local_xdot / (2.0 * eps);
             local_M_data.clear();
-            _local_M_data.clear();
+            local_M_data_m.clear();
         }
         if (!local_K_data.empty()) {
             auto const local_K_p =
                 MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
             auto const local_K_m =
-                MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
+                MathLib::toMatrix(local_K_data_m, num_r_c, num_r_c);
             local_Jac.col(i).noalias() +=
                 // dK/dxi * x
                 (local_K_p - local_K_m) * local_x / (2.0 * eps);
             local_K_data.clear();
-            _local_K_data.clear();
+            local_K_data_m.clear();
         }
         if (!local_b_data.empty()) {
             auto const local_b_p =
                 MathLib::toVector<Eigen::VectorXd>(local_b_data, num_r_c);
             auto const local_b_m =
-                MathLib::toVector<Eigen::VectorXd>(_local_b_data, num_r_c);
+                MathLib::toVector<Eigen::VectorXd>(local_b_data_m, num_r_c);
             local_Jac.col(i).noalias() -=
                 // db/dxi
                 (local_b_p - local_b_m) / (2.0 * eps);
             local_b_data.clear();
-            _local_b_data.clear();
+            local_b_data_m.clear();
         }
     }
 
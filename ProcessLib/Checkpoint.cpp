@@ -0,0 +1,151 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "Checkpoint.h"
+
+#include <logog/include/logog.hpp>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <utility>
+
+#ifdef USE_PETSC
+#include <petscsys.h>
+#endif
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+
+namespace
+{
+std::array<char, 8> const checkpoint_magic = {
+    {'O', 'G', 'S', 'C', 'H', 'K', 'P', 'T'}};
+std::uint32_t const checkpoint_version = 1;
+
+int getNumberOfRanks()
+{
+#ifdef USE_PETSC
+    int size;
+    MPI_Comm_size(PETSC_COMM_WORLD, &size);
+    return size;
+#else
+    return 1;
+#endif
+}
+}  // namespace
+
+namespace ProcessLib
+{
+CheckpointControl::CheckpointControl(std::string file_name,
+                                     int const each_steps,
+                                     double const wall_clock_interval)
+    : _file_name(std::move(file_name)),
+      _each_steps(each_steps),
+      _wall_clock_interval(wall_clock_interval)
+{
+    _run_time.start();
+}
+
+bool CheckpointControl::isCheckpointDue(std::size_t const timestep) const
+{
+    bool const is_step_due = _each_steps > 0 && timestep % _each_steps == 0;
+    bool const is_wall_clock_due = _wall_clock_interval > 0 &&
+                                   _run_time.elapsed() >= _wall_clock_interval;
+
+    int is_due = is_step_due || is_wall_clock_due;
+#ifdef USE_PETSC
+    // The elapsed wall clock time differs between the ranks.
+    MPI_Allreduce(MPI_IN_PLACE, &is_due, 1, MPI_INT, MPI_LOR,
+                  PETSC_COMM_WORLD);
+#endif
+    return is_due != 0;
+}
+
+std::string getCheckpointFileNameOfRank(std::string const& file_name)
+{
+#ifdef USE_PETSC
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    auto const extension = BaseLib::getFileExtension(file_name);
+    return BaseLib::dropFileExtension(file_name) + "_" +
+           std::to_string(rank) + (extension.empty() ? "" : "." + extension);
+#else
+    return file_name;
+#endif
+}
+
+void writeCheckpointHeader(std::ostream& os)
+{
+    BaseLib::writeArrayBinary(os, checkpoint_magic.data(),
+                              checkpoint_magic.size());
+    BaseLib::writeValueBinary(os, checkpoint_version);
+    BaseLib::writeValueBinary(os, static_cast<std::int32_t>(getNumberOfRanks()));
+}
+
+void readCheckpointHeader(std::istream& is, std::string const& file_name)
+{
+    std::array<char, 8> magic;
+    BaseLib::readArrayBinary(is, magic.data(), magic.size());
+    auto const version = BaseLib::readBinaryValue<std::uint32_t>(is);
+    auto const n_ranks = BaseLib::readBinaryValue<std::int32_t>(is);
+    if (!is || magic != checkpoint_magic)
+    {
+        OGS_FATAL("The file '%s' is not an OGS checkpoint.", file_name.c_str());
+    }
+    if (version != checkpoint_version)
+    {
+        OGS_FATAL(
+            "The checkpoint '%s' has version %d, but version %d is required.",
+            file_name.c_str(), version, checkpoint_version);
+    }
+    if (n_ranks != getNumberOfRanks())
+    {
+        OGS_FATAL(
+            "The checkpoint '%s' was written by %d MPI ranks, but %d are "
+            "running.",
+            file_name.c_str(), n_ranks, getNumberOfRanks());
+    }
+}
+
+std::unique_ptr<CheckpointControl> createCheckpointControl(
+    BaseLib::ConfigTree const& config, std::string const& output_directory)
+{
+    auto const prefix =
+        //! \ogs_file_param{prj__time_loop__checkpoint__prefix}
+        config.getConfigParameter<std::string>("prefix");
+
+    auto const each_steps =
+        //! \ogs_file_param{prj__time_loop__checkpoint__each_steps}
+        config.getConfigParameter<int>("each_steps", 0);
+
+    auto const wall_clock_interval =
+        //! \ogs_file_param{prj__time_loop__checkpoint__wall_clock_interval}
+        config.getConfigParameter<double>("wall_clock_interval", 0.0);
+
+    if (each_steps <= 0 && wall_clock_interval <= 0)
+    {
+        OGS_FATAL(
+            "Checkpoints require a positive number of time steps "
+            "<each_steps> or a positive <wall_clock_interval>.");
+    }
+
+    auto const file_name = BaseLib::joinPaths(
+        output_directory, prefix + "_checkpoint.bin");
+
+    INFO("Checkpoints are written to '%s'.", file_name.c_str());
+
+    return std::make_unique<CheckpointControl>(
+        getCheckpointFileNameOfRank(file_name), each_steps,
+        wall_clock_interval);
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,73 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include "BaseLib/RunTime.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace ProcessLib
+{
+/// Decides when the time loop writes a checkpoint, from which a simulation can
+/// be restarted, and where it is written to.
+///
+/// A checkpoint is due after every \c each_steps accepted time steps and/or if
+/// more than \c wall_clock_interval seconds passed since the last checkpoint
+/// was written. A non-positive value disables the respective criterion.
+class CheckpointControl
+{
+public:
+    CheckpointControl(std::string file_name, int const each_steps,
+                      double const wall_clock_interval);
+
+    /// Checks whether a checkpoint is due after the given accepted time step.
+    /// With PETSc this is a collective operation, all ranks get the same
+    /// answer.
+    bool isCheckpointDue(std::size_t const timestep) const;
+
+    /// Restarts the wall clock interval.
+    void checkpointWritten() { _run_time.start(); }
+
+    /// The checkpoint file name of this rank.
+    std::string const& getFileName() const { return _file_name; }
+
+private:
+    std::string const _file_name;
+    int const _each_steps;
+    double const _wall_clock_interval;
+    BaseLib::RunTime _run_time;
+};
+
+/// Returns the name of the checkpoint file of this rank. That is \c file_name
+/// itself in serial runs and \c file_name with the MPI rank inserted before
+/// the extension with PETSc, i.e., each rank writes and reads its own file.
+std::string getCheckpointFileNameOfRank(std::string const& file_name);
+
+/// Writes the identification of the checkpoint file format and the number
+/// of MPI ranks.
+void writeCheckpointHeader(std::ostream& os);
+
+/// Checks the header written by writeCheckpointHeader() against the running
+/// program.
+void readCheckpointHeader(std::istream& is, std::string const& file_name);
+
+std::unique_ptr<CheckpointControl> createCheckpointControl(
+    BaseLib::ConfigTree const& config, std::string const& output_directory);
+
+}  // namespace ProcessLib
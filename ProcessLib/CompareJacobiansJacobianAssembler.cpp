@@ -131,7 +131,9 @@ void CompareJacobiansJacobianAssembler::assembleWithJacobian(
     std::vector<double>& local_M_data, std::vector<double>& local_K_data,
     std::vector<double>& local_b_data, std::vector<double>& local_Jac_data)
 {
-    ++_counter;
+    // The counter identifies this call also if several local assemblers are
+    // compared concurrently.
+    auto const counter = ++_counter;
 
     auto const num_dof = local_x.size();
     auto to_mat = [num_dof](std::vector<double> const& data) {
@@ -282,113 +284,125 @@ void CompareJacobiansJacobianAssembler::assembleWithJacobian(
 
     bool const output = tol_exceeded || fatal_error;
 
+    // The block is written to the log file at once, such that the blocks of
+    // concurrently compared local assemblers are not interleaved.
+    std::ostringstream log;
+    log.precision(_log_file.precision());
+
     if (output)
     {
-        _log_file << "\n### counter: " << std::to_string(_counter)
-                  << " (begin)\n";
+        log << "\n### counter: " << std::to_string(counter) << " (begin)\n";
     }
 
     if (fatal_error)
     {
-        _log_file << '\n'
-                  << "#######################################################\n"
-                  << "# FATAL ERROR: " << msg_fatal << '\n'
-                  << "#              You cannot expect any meaningful insights "
-                     "from the Jacobian data printed below!\n"
-                  << "#              The reason for the mentioned differences "
-                     "might be\n"
-                  << "#              (a) that the assembly routine has side "
-                     "effects or\n"
-                  << "#              (b) that the assembly routines for M, K "
-                     "and b themselves differ.\n"
-                  << "#######################################################\n"
-                  << '\n';
+        log << '\n'
+            << "#######################################################\n"
+            << "# FATAL ERROR: " << msg_fatal << '\n'
+            << "#              You cannot expect any meaningful insights "
+               "from the Jacobian data printed below!\n"
+            << "#              The reason for the mentioned differences "
+               "might be\n"
+            << "#              (a) that the assembly routine has side "
+               "effects or\n"
+            << "#              (b) that the assembly routines for M, K "
+               "and b themselves differ.\n"
+            << "#######################################################\n"
+            << '\n';
     }
 
     if (tol_exceeded)
     {
-        _log_file << "# " << msg_tolerance.str() << "\n\n";
+        log << "# " << msg_tolerance.str() << "\n\n";
     }
 
     if (output)
     {
-        dump_py(_log_file, "counter", _counter);
-        dump_py(_log_file, "num_dof", num_dof);
-        dump_py(_log_file, "abs_tol", _abs_tol);
-        dump_py(_log_file, "rel_tol", _rel_tol);
+        dump_py(log, "counter", counter);
+        dump_py(log, "num_dof", num_dof);
+        dump_py(log, "abs_tol", _abs_tol);
+        dump_py(log, "rel_tol", _rel_tol);
 
-        _log_file << '\n';
+        log << '\n';
 
-        dump_py(_log_file, "local_x", local_x);
-        dump_py(_log_file, "local_x_dot", local_xdot);
-        dump_py(_log_file, "dxdot_dx", dxdot_dx);
-        dump_py(_log_file, "dx_dx", dx_dx);
+        dump_py(log, "local_x", local_x);
+        dump_py(log, "local_x_dot", local_xdot);
+        dump_py(log, "dxdot_dx", dxdot_dx);
+        dump_py(log, "dx_dx", dx_dx);
 
-        _log_file << '\n';
+        log << '\n';
 
-        dump_py(_log_file, "Jacobian_1", local_Jac1);
-        dump_py(_log_file, "Jacobian_2", local_Jac2);
+        dump_py(log, "Jacobian_1", local_Jac1);
+        dump_py(log, "Jacobian_2", local_Jac2);
 
-        _log_file << '\n';
+        log << '\n';
 
-        _log_file << "# Jacobian_2 - Jacobian_1\n";
-        dump_py(_log_file, "abs_diff", abs_diff);
-        _log_file << "# Componentwise: 2 * abs_diff / (|Jacobian_1| + "
-                     "|Jacobian_2|)\n";
-        dump_py(_log_file, "rel_diff", rel_diff);
+        log << "# Jacobian_2 - Jacobian_1\n";
+        dump_py(log, "abs_diff", abs_diff);
+        log << "# Componentwise: 2 * abs_diff / (|Jacobian_1| + "
+               "|Jacobian_2|)\n";
+        dump_py(log, "rel_diff", rel_diff);
 
-        _log_file << '\n';
+        log << '\n';
 
-        _log_file << "# Masks: 0 ... tolerance met, 1 ... tolerance exceeded\n";
-        dump_py(_log_file, "abs_diff_mask", abs_diff_mask);
-        dump_py(_log_file, "rel_diff_mask", rel_diff_mask);
+        log << "# Masks: 0 ... tolerance met, 1 ... tolerance exceeded\n";
+        dump_py(log, "abs_diff_mask", abs_diff_mask);
+        dump_py(log, "rel_diff_mask", rel_diff_mask);
 
-        _log_file << '\n';
+        log << '\n';
 
-        dump_py(_log_file, "M_1", local_M1);
-        dump_py(_log_file, "M_2", local_M2);
+        dump_py(log, "M_1", local_M1);
+        dump_py(log, "M_2", local_M2);
         if (fatal_error && local_M1.size() == local_M2.size())
         {
-            dump_py(_log_file, "delta_M", local_M2 - local_M1);
-            _log_file << '\n';
+            dump_py(log, "delta_M", local_M2 - local_M1);
+            log << '\n';
         }
 
-        dump_py(_log_file, "K_1", local_K1);
-        dump_py(_log_file, "K_2", local_K2);
+        dump_py(log, "K_1", local_K1);
+        dump_py(log, "K_2", local_K2);
         if (fatal_error && local_K1.size() == local_K2.size())
         {
-            dump_py(_log_file, "delta_K", local_K2 - local_K1);
-            _log_file << '\n';
+            dump_py(log, "delta_K", local_K2 - local_K1);
+            log << '\n';
         }
 
-        dump_py(_log_file, "b_1", local_b_data);
-        dump_py(_log_file, "b_2", local_b_data2);
+        dump_py(log, "b_1", local_b_data);
+        dump_py(log, "b_2", local_b_data2);
         if (fatal_error && local_b1.size() == local_b2.size())
         {
-            dump_py(_log_file, "delta_b", local_b2 - local_b1);
-            _log_file << '\n';
+            dump_py(log, "delta_b", local_b2 - local_b1);
+            log << '\n';
         }
 
-        dump_py(_log_file, "res_1", res1);
-        dump_py(_log_file, "res_2", res2);
+        dump_py(log, "res_1", res1);
+        dump_py(log, "res_2", res2);
         if (fatal_error)
         {
-            dump_py(_log_file, "delta_res", res2 - res1);
+            dump_py(log, "delta_res", res2 - res1);
         }
 
-        _log_file << '\n';
+        log << '\n';
+
+        log << "### counter: " << std::to_string(counter) << " (end)\n";
+    }
 
-        _log_file << "### counter: " << std::to_string(_counter) << " (end)\n";
+    if (output)
+    {
+#pragma omp critical(ogs_compare_jacobians_log)
+        _log_file << log.str();
     }
 
     if (fatal_error)
     {
+#pragma omp critical(ogs_compare_jacobians_log)
         _log_file << std::flush;
         OGS_FATAL("%s", msg_fatal.c_str());
     }
 
     if (tol_exceeded && _fail_on_error)
     {
+#pragma omp critical(ogs_compare_jacobians_log)
         _log_file << std::flush;
         OGS_FATAL(
             "OGS failed, because the two Jacobian implementations returned "
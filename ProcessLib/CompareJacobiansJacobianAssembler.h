@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <fstream>
 #include <limits>
 #include <memory>
@@ -79,7 +80,7 @@ private:
     //! Counter used for identifying blocks in the \c _log_file. It is
     //! incremented upon each call of the assembly routine, i.e., for each
     //! element in each iteration etc.
-    std::size_t _counter = 0;
+    std::atomic<std::size_t> _counter{0};
 };
 
 std::unique_ptr<CompareJacobiansJacobianAssembler>
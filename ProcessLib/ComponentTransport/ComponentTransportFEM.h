@@ -129,11 +129,22 @@ public:
             transport_process_variables)
         : _element(element),
           _process_data(process_data),
+          _medium(*process_data.media_map->getMedium(element.getID())),
+          _liquid_phase(_medium.phase("AqueousLiquid")),
           _integration_method(integration_order),
           _transport_process_variables(transport_process_variables)
     {
         (void)local_matrix_size;
 
+        // Assume that the component name is the same as the process variable
+        // name.
+        _components.reserve(_transport_process_variables.size());
+        for (auto const& pv : _transport_process_variables)
+        {
+            _components.push_back(
+                &_liquid_phase.component(pv.get().getName()));
+        }
+
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
         _ip_data.reserve(n_integration_points);
@@ -246,16 +257,10 @@ public:
             GlobalDimMatrixType::Identity(GlobalDim, GlobalDim));
 
         // Get material properties
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
+        auto const& medium = _medium;
         // Select the only valid for component transport liquid phase.
-        auto const& phase = medium.phase("AqueousLiquid");
-
-        // Assume that the component name is the same as the process variable
-        // name. Components are shifted by one because the first one is always
-        // pressure.
-        auto const& component = phase.component(
-            _transport_process_variables[component_id].get().getName());
+        auto const& phase = _liquid_phase;
+        auto const& component = *_components[component_id];
 
         for (unsigned ip(0); ip < n_integration_points; ++ip)
         {
@@ -280,13 +285,13 @@ public:
             // porosity model
             auto const porosity =
                 medium.property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& retardation_factor =
                 component
                     .property(
                         MaterialPropertyLib::PropertyType::retardation_factor)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& solute_dispersivity_transverse = medium.template value<
                 double>(
@@ -302,18 +307,18 @@ public:
             // for calculation of fluid density
             auto const density =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const decay_rate =
                 component
                     .property(MaterialPropertyLib::PropertyType::decay_rate)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& molecular_diffusion_coefficient =
                 component
                     .property(
                         MaterialPropertyLib::PropertyType::molecular_diffusion)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
                 medium.property(MaterialPropertyLib::PropertyType::permeability)
@@ -322,7 +327,7 @@ public:
             // Use the viscosity model to compute the viscosity
             auto const mu =
                 phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             GlobalDimMatrixType const K_over_mu = K / mu;
             GlobalDimVectorType const velocity =
@@ -333,13 +338,13 @@ public:
 
             const double drho_dp =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
+                    .scalarDValue(
                         vars, MaterialPropertyLib::Variable::phase_pressure,
                         pos, t);
 
             const double drho_dC =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
+                    .scalarDValue(
                         vars, MaterialPropertyLib::Variable::concentration, pos,
                         t);
 
@@ -450,9 +455,8 @@ public:
 
         auto const& b = _process_data.specific_body_force;
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& phase = _liquid_phase;
 
         MaterialPropertyLib::VariableArray vars;
 
@@ -479,14 +483,14 @@ public:
             // porosity model
             auto const porosity =
                 medium.property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             // Use the fluid density model to compute the density
             // TODO: Concentration of which component as one of arguments for
             // calculation of fluid density
             auto const density =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
                 medium.property(MaterialPropertyLib::PropertyType::permeability)
@@ -495,18 +499,18 @@ public:
             // Use the viscosity model to compute the viscosity
             auto const mu =
                 phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             GlobalDimMatrixType const K_over_mu = K / mu;
 
             const double drho_dp =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
+                    .scalarDValue(
                         vars, MaterialPropertyLib::Variable::phase_pressure,
                         pos, t);
             const double drho_dC =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
+                    .scalarDValue(
                         vars, MaterialPropertyLib::Variable::concentration, pos,
                         t);
 
@@ -565,14 +569,12 @@ public:
         GlobalDimMatrixType const& I(
             GlobalDimMatrixType::Identity(GlobalDim, GlobalDim));
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& phase = _liquid_phase;
         // Hydraulic process id is 0 and thus transport process id starts
         // from 1.
         auto const component_id = transport_process_id - 1;
-        auto const& component = phase.component(
-            _transport_process_variables[component_id].get().getName());
+        auto const& component = *_components[component_id];
 
         for (unsigned ip(0); ip < n_integration_points; ++ip)
         {
@@ -597,13 +599,13 @@ public:
             // porosity model
             auto const porosity =
                 medium.property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& retardation_factor =
                 component
                     .property(
                         MaterialPropertyLib::PropertyType::retardation_factor)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& solute_dispersivity_transverse = medium.template value<
                 double>(
@@ -616,17 +618,17 @@ public:
             // Use the fluid density model to compute the density
             auto const density =
                 phase.property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
             auto const decay_rate =
                 component
                     .property(MaterialPropertyLib::PropertyType::decay_rate)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& molecular_diffusion_coefficient =
                 component
                     .property(
                         MaterialPropertyLib::PropertyType::molecular_diffusion)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
                 medium.property(MaterialPropertyLib::PropertyType::permeability)
@@ -634,7 +636,7 @@ public:
             // Use the viscosity model to compute the viscosity
             auto const mu =
                 phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             GlobalDimMatrixType const K_over_mu = K / mu;
             GlobalDimVectorType const velocity =
@@ -669,7 +671,7 @@ public:
             {
                 const double drho_dC =
                     phase.property(MaterialPropertyLib::PropertyType::density)
-                        .template dValue<double>(
+                        .scalarDValue(
                             vars, MaterialPropertyLib::Variable::concentration,
                             pos, t);
                 local_M.noalias() +=
@@ -687,7 +689,7 @@ public:
                 NumLib::shapeFunctionInterpolate(local_p0, N, p0_int_pt);
                 const double drho_dp =
                     phase.property(MaterialPropertyLib::PropertyType::density)
-                        .template dValue<double>(
+                        .scalarDValue(
                             vars, MaterialPropertyLib::Variable::phase_pressure,
                             pos, t);
                 local_K.noalias() +=
@@ -766,9 +768,8 @@ public:
 
         MaterialPropertyLib::VariableArray vars;
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& phase = _liquid_phase;
 
         for (unsigned ip = 0; ip < n_integration_points; ++ip)
         {
@@ -794,7 +795,7 @@ public:
                     .value(vars, pos, t));
             auto const mu =
                 phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
             GlobalDimMatrixType const K_over_mu = K / mu;
 
             cache_mat.col(ip).noalias() = -K_over_mu * dNdx * p_nodal_values;
@@ -802,7 +803,7 @@ public:
             {
                 auto const rho_w =
                     phase.property(MaterialPropertyLib::PropertyType::density)
-                        .template value<double>(vars, pos, t);
+                        .scalarValue(vars, pos, t);
                 auto const b = _process_data.specific_body_force;
                 // here it is assumed that the vector b is directed 'downwards'
                 cache_mat.col(ip).noalias() += K_over_mu * rho_w * b;
@@ -872,9 +873,8 @@ public:
 
         MaterialPropertyLib::VariableArray vars;
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& phase = _liquid_phase;
 
         // local_x contains the local concentration and pressure values
         NumLib::shapeFunctionInterpolate(
@@ -892,14 +892,14 @@ public:
 
         auto const mu =
             phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
         GlobalDimMatrixType const K_over_mu = K / mu;
 
         GlobalDimVectorType q =
             -K_over_mu * shape_matrices.dNdx * p_nodal_values;
         auto const rho_w =
             phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
         if (_process_data.has_gravity)
         {
             auto const b = _process_data.specific_body_force;
@@ -913,10 +913,16 @@ public:
 private:
     MeshLib::Element const& _element;
     ComponentTransportProcessData const& _process_data;
+    /// The medium of the element, its liquid phase, and the components of the
+    /// transport process variables are looked up once on construction instead
+    /// of by name in each assembly.
+    MaterialPropertyLib::Medium const& _medium;
+    MaterialPropertyLib::Phase const& _liquid_phase;
 
     IntegrationMethod const _integration_method;
     std::vector<std::reference_wrapper<ProcessVariable>> const
         _transport_process_variables;
+    std::vector<MaterialPropertyLib::Component const*> _components;
 
     std::vector<
         IntegrationPointData<NodalRowVectorType, GlobalDimNodalMatrixType>,
@@ -113,6 +113,8 @@ public:
     bool isLinear() const override { return false; }
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+
     Eigen::Vector3d getFlux(std::size_t const element_id,
                             MathLib::Point3d const& p, double const t,
                             GlobalVector const& x) const override;
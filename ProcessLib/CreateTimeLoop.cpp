@@ -15,6 +15,7 @@
 #include "ProcessLib/Output/CreateOutput.h"
 #include "ProcessLib/Output/Output.h"
 
+#include "Checkpoint.h"
 #include "TimeLoop.h"
 
 namespace ProcessLib
@@ -91,9 +92,18 @@ std::unique_ptr<TimeLoop> createTimeLoop(
         per_process_data[minmax_iter.second - per_process_data.begin()]
             ->timestepper->end();
 
+    std::unique_ptr<CheckpointControl> checkpoint_control;
+    if (auto const checkpoint_config =
+            //! \ogs_file_param{prj__time_loop__checkpoint}
+        config.getConfigSubtreeOptional("checkpoint"))
+    {
+        checkpoint_control =
+            createCheckpointControl(*checkpoint_config, output_directory);
+    }
+
     return std::make_unique<TimeLoop>(
         std::move(output), std::move(per_process_data), max_coupling_iterations,
         std::move(global_coupling_conv_criteria), std::move(phreeqc_io),
-        start_time, end_time);
+        std::move(checkpoint_control), start_time, end_time);
 }
 }  // namespace ProcessLib
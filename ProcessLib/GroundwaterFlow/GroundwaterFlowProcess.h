@@ -47,6 +47,8 @@ public:
     bool isLinear() const override { return true; }
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+
     Eigen::Vector3d getFlux(std::size_t element_id,
                             MathLib::Point3d const& p,
                             double const t,
@@ -56,6 +56,9 @@ public:
         : HTLocalAssemblerInterface(),
           _element(element),
           _process_data(process_data),
+          _medium(*process_data.media_map->getMedium(element.getID())),
+          _liquid_phase(_medium.phase("AqueousLiquid")),
+          _solid_phase(_medium.phase("Solid")),
           _integration_method(integration_order)
     {
         // This assertion is valid only if all nodal d.o.f. use the same shape
@@ -127,9 +130,8 @@ public:
         vars[static_cast<int>(MaterialPropertyLib::Variable::phase_pressure)] =
             p_int_pt;
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& liquid_phase = _liquid_phase;
 
         auto const K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
             medium.property(MaterialPropertyLib::PropertyType::permeability)
@@ -137,7 +139,7 @@ public:
 
         auto const mu =
             liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
         GlobalDimMatrixType const K_over_mu = K / mu;
 
         auto const p_nodal_values = Eigen::Map<const NodalVectorType>(
@@ -150,7 +152,7 @@ public:
             auto const rho_w =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
             auto const b = this->_process_data.specific_body_force;
             q += K_over_mu * rho_w * b;
         }
@@ -163,6 +165,11 @@ public:
 protected:
     MeshLib::Element const& _element;
     HTProcessData const& _process_data;
+    /// The medium of the element and its phases are looked up once on
+    /// construction instead of by name in each assembly.
+    MaterialPropertyLib::Medium const& _medium;
+    MaterialPropertyLib::Phase const& _liquid_phase;
+    MaterialPropertyLib::Phase const& _solid_phase;
 
     IntegrationMethod const _integration_method;
     std::vector<
@@ -176,19 +183,17 @@ protected:
         const double fluid_density, const double specific_heat_capacity_fluid,
         ParameterLib::SpatialPosition const& pos, double const t)
     {
-        auto const& medium =
-            *_process_data.media_map->getMedium(this->_element.getID());
-        auto const& solid_phase = medium.phase("Solid");
+        auto const& solid_phase = _solid_phase;
 
         auto const specific_heat_capacity_solid =
             solid_phase
                 .property(
                     MaterialPropertyLib::PropertyType::specific_heat_capacity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         auto const solid_density =
             solid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         return solid_density * specific_heat_capacity_solid * (1 - porosity) +
                fluid_density * specific_heat_capacity_fluid * porosity;
@@ -200,22 +205,21 @@ protected:
         const GlobalDimVectorType& velocity, const GlobalDimMatrixType& I,
         ParameterLib::SpatialPosition const& pos, double const t)
     {
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& solid_phase = medium.phase("Solid");
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& solid_phase = _solid_phase;
+        auto const& liquid_phase = _liquid_phase;
 
         auto const thermal_conductivity_solid =
             solid_phase
                 .property(
                     MaterialPropertyLib::PropertyType::thermal_conductivity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         auto const thermal_conductivity_fluid =
             liquid_phase
                 .property(
                     MaterialPropertyLib::PropertyType::thermal_conductivity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         double const thermal_conductivity =
             thermal_conductivity_solid * (1 - porosity) +
@@ -268,9 +272,8 @@ protected:
         auto const p_nodal_values = Eigen::Map<const NodalVectorType>(
             &local_p[0], ShapeFunction::NPOINTS);
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
+        auto const& medium = _medium;
+        auto const& liquid_phase = _liquid_phase;
 
         for (unsigned ip = 0; ip < n_integration_points; ++ip)
         {
@@ -297,7 +300,7 @@ protected:
             auto const mu =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
             GlobalDimMatrixType const K_over_mu = K / mu;
 
             cache_mat.col(ip).noalias() = -K_over_mu * dNdx * p_nodal_values;
@@ -307,7 +310,7 @@ protected:
                 auto const rho_w =
                     liquid_phase
                         .property(MaterialPropertyLib::PropertyType::density)
-                        .template value<double>(vars, pos, t);
+                        .scalarValue(vars, pos, t);
                 auto const b = _process_data.specific_body_force;
                 // here it is assumed that the vector b is directed 'downwards'
                 cache_mat.col(ip).noalias() += K_over_mu * rho_w * b;
@@ -101,10 +101,9 @@ public:
             &local_x[pressure_index], pressure_size);
 
         auto const& process_data = this->_process_data;
-        auto const& medium =
-            *process_data.media_map->getMedium(this->_element.getID());
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
-        auto const& solid_phase = medium.phase("Solid");
+        auto const& medium = this->_medium;
+        auto const& liquid_phase = this->_liquid_phase;
+        auto const& solid_phase = this->_solid_phase;
 
         auto const& b = process_data.specific_body_force;
 
@@ -124,7 +123,7 @@ public:
             // constant storage model
             auto const specific_storage =
                 solid_phase.property(MaterialPropertyLib::PropertyType::storage)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const& ip_data = this->_ip_data[ip];
             auto const& N = ip_data.N;
@@ -138,7 +137,7 @@ public:
 
             auto const porosity =
                 medium.property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             auto const intrinsic_permeability =
                 MaterialPropertyLib::formEigenTensor<GlobalDim>(
@@ -155,19 +154,19 @@ public:
             auto const specific_heat_capacity_fluid =
                 liquid_phase
                     .property(MaterialPropertyLib::specific_heat_capacity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             // Use the fluid density model to compute the density
             auto const fluid_density =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
 
             // Use the viscosity model to compute the viscosity
             auto const viscosity =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                    .scalarValue(vars, pos, t);
             GlobalDimMatrixType K_over_mu = intrinsic_permeability / viscosity;
 
             GlobalDimVectorType const velocity =
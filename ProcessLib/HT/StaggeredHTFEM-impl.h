@@ -72,10 +72,9 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
     pos.setElementID(this->_element.getID());
 
     auto const& process_data = this->_process_data;
-    auto const& medium = *this->_process_data.media_map->getMedium(
-        this->_element.getID());
-    auto const& liquid_phase = medium.phase("AqueousLiquid");
-    auto const& solid_phase = medium.phase("Solid");
+    auto const& medium = this->_medium;
+    auto const& liquid_phase = this->_liquid_phase;
+    auto const& solid_phase = this->_solid_phase;
 
     auto const& b = process_data.specific_body_force;
 
@@ -105,27 +104,27 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
 
         auto const porosity =
             medium.property(MaterialPropertyLib::PropertyType::porosity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
         auto const fluid_density =
             liquid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         const double dfluid_density_dp =
             liquid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template dValue<double>(
+                .scalarDValue(
                     vars, MaterialPropertyLib::Variable::phase_pressure, pos,
                     t);
 
         // Use the viscosity model to compute the viscosity
         auto const viscosity =
             liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         // \todo the argument to getValue() has to be changed for non
         // constant storage model
         auto const specific_storage =
             solid_phase.property(MaterialPropertyLib::PropertyType::storage)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         auto const intrinsic_permeability =
             MaterialPropertyLib::formEigenTensor<GlobalDim>(
@@ -156,17 +155,17 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
         // Add the thermal expansion term
         {
             auto const solid_thermal_expansion =
-                process_data.solid_thermal_expansion(t, pos)[0];
+                process_data.solid_thermal_expansion.scalarValue(t, pos);
             const double dfluid_density_dT =
                 liquid_phase
                     .property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
+                    .scalarDValue(
                         vars, MaterialPropertyLib::Variable::temperature, pos,
                         t);
             double T0_int_pt = 0.;
             NumLib::shapeFunctionInterpolate(local_T0, N, T0_int_pt);
             auto const biot_constant =
-                process_data.biot_constant(t, pos)[0];
+                process_data.biot_constant.scalarValue(t, pos);
             const double eff_thermal_expansion =
                 3.0 * (biot_constant - porosity) * solid_thermal_expansion -
                 porosity * dfluid_density_dT / fluid_density;
@@ -206,9 +205,8 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
     pos.setElementID(this->_element.getID());
 
     auto const& process_data = this->_process_data;
-    auto const& medium =
-        *process_data.media_map->getMedium(this->_element.getID());
-    auto const& liquid_phase = medium.phase("AqueousLiquid");
+    auto const& medium = this->_medium;
+    auto const& liquid_phase = this->_liquid_phase;
 
     auto const& b = process_data.specific_body_force;
 
@@ -241,15 +239,15 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
 
         auto const porosity =
             medium.property(MaterialPropertyLib::PropertyType::porosity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         // Use the fluid density model to compute the density
         auto const fluid_density =
             liquid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
         auto const specific_heat_capacity_fluid =
             liquid_phase.property(MaterialPropertyLib::specific_heat_capacity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         // Assemble mass matrix
         local_M.noalias() += w *
@@ -261,7 +259,7 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
         // Assemble Laplace matrix
         auto const viscosity =
             liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+                .scalarValue(vars, pos, t);
 
         auto const intrinsic_permeability =
             MaterialPropertyLib::formEigenTensor<GlobalDim>(
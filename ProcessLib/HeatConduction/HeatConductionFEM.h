@@ -117,9 +117,11 @@ public:
             pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
             auto const& wp = _integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.thermal_conductivity(t, pos)[0];
-            auto const heat_capacity = _process_data.heat_capacity(t, pos)[0];
-            auto const density = _process_data.density(t, pos)[0];
+            auto const k =
+                _process_data.thermal_conductivity.scalarValue(t, pos);
+            auto const heat_capacity =
+                _process_data.heat_capacity.scalarValue(t, pos);
+            auto const density = _process_data.density.scalarValue(t, pos);
 
             local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
                                  wp.getWeight() * sm.integralMeasure;
@@ -149,7 +151,8 @@ public:
         {
             pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
-            auto const k = _process_data.thermal_conductivity(t, pos)[0];
+            auto const k =
+                _process_data.thermal_conductivity.scalarValue(t, pos);
             // heat flux only computed for output.
             GlobalDimVectorType const heat_flux = -k * sm.dNdx * local_x_vec;
 
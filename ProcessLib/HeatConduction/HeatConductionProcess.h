@@ -41,6 +41,8 @@ public:
 
     bool isLinear() const override { return true; }
 
+    bool isCheckpointSupported() const override { return true; }
+
     void computeSecondaryVariableConcrete(
         double const t, GlobalVector const& x, int const process_id) override;
 
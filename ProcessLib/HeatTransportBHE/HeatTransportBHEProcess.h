@@ -42,6 +42,8 @@ public:
     //! @{
     bool isLinear() const override { return false; }
 
+    bool isCheckpointSupported() const override { return true; }
+
     void computeSecondaryVariableConcrete(double const t,
                                           GlobalVector const& x,
                                           int const process_id) override;
@@ -207,11 +207,13 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
         auto const& sigma_eff = _ip_data[ip].sigma_eff;
 
         double const K_over_mu =
-            _process_data.intrinsic_permeability(t, x_position)[0] /
-            _process_data.fluid_viscosity(t, x_position)[0];
-        auto const alpha = _process_data.biot_coefficient(t, x_position)[0];
+            _process_data.intrinsic_permeability.scalarValue(t, x_position) /
+            _process_data.fluid_viscosity.scalarValue(t, x_position);
+        auto const alpha =
+            _process_data.biot_coefficient.scalarValue(t, x_position);
         auto const K_S = solid_material.getBulkModulus(t, x_position);
-        auto const rho_sr = _process_data.solid_density(t, x_position)[0];
+        auto const rho_sr =
+            _process_data.solid_density.scalarValue(t, x_position);
         // TODO (FZill) get fluid properties from GPML
         double const p_fr =
             (_process_data.fluid_type == FluidType::Fluid_Type::IDEAL_GAS)
@@ -219,7 +221,7 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
                 : std::numeric_limits<double>::quiet_NaN();
         double const rho_fr = _process_data.getFluidDensity(t, x_position, p_fr);
         double const beta_p = _process_data.getFluidCompressibility(p_fr);
-        auto const porosity = _process_data.porosity(t, x_position)[0];
+        auto const porosity = _process_data.porosity.scalarValue(t, x_position);
         auto const& identity2 = MathLib::KelvinVector::Invariants<
             MathLib::KelvinVector::KelvinVectorDimensions<
                 DisplacementDim>::value>::identity2;
@@ -329,10 +331,11 @@ HydroMechanicsLocalAssembler<ShapeFunctionDisplacement, ShapeFunctionPressure,
     {
         x_position.setIntegrationPoint(ip);
         double const K_over_mu =
-            _process_data.intrinsic_permeability(t, x_position)[0] /
-            _process_data.fluid_viscosity(t, x_position)[0];
+            _process_data.intrinsic_permeability.scalarValue(t, x_position) /
+            _process_data.fluid_viscosity.scalarValue(t, x_position);
 
-        auto const rho_fr = _process_data.fluid_density(t, x_position)[0];
+        auto const rho_fr =
+            _process_data.fluid_density.scalarValue(t, x_position);
         auto const& b = _process_data.specific_body_force;
 
         // Compute the velocity
@@ -412,9 +415,10 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
         auto const& dNdx_p = _ip_data[ip].dNdx_p;
 
         double const K_over_mu =
-            _process_data.intrinsic_permeability(t, x_position)[0] /
-            _process_data.fluid_viscosity(t, x_position)[0];
-        auto const alpha_b = _process_data.biot_coefficient(t, x_position)[0];
+            _process_data.intrinsic_permeability.scalarValue(t, x_position) /
+            _process_data.fluid_viscosity.scalarValue(t, x_position);
+        auto const alpha_b =
+            _process_data.biot_coefficient.scalarValue(t, x_position);
         // TODO (FZill) get fluid properties from GPML
         double const p_fr =
             (_process_data.fluid_type == FluidType::Fluid_Type::IDEAL_GAS)
@@ -422,7 +426,7 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
                 : std::numeric_limits<double>::quiet_NaN();
         double const rho_fr = _process_data.getFluidDensity(t, x_position, p_fr);
         double const beta_p = _process_data.getFluidCompressibility(p_fr);
-        auto const porosity = _process_data.porosity(t, x_position)[0];
+        auto const porosity = _process_data.porosity.scalarValue(t, x_position);
         auto const K_S = solid_material.getBulkModulus(t, x_position);
 
         laplace.noalias() += dNdx_p.transpose() * K_over_mu * dNdx_p * w;
@@ -517,10 +521,13 @@ void HydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
         auto& eps = _ip_data[ip].eps;
         auto const& sigma_eff = _ip_data[ip].sigma_eff;
 
-        auto const alpha = _process_data.biot_coefficient(t, x_position)[0];
-        auto const rho_sr = _process_data.solid_density(t, x_position)[0];
-        auto const rho_fr = _process_data.fluid_density(t, x_position)[0];
-        auto const porosity = _process_data.porosity(t, x_position)[0];
+        auto const alpha =
+            _process_data.biot_coefficient.scalarValue(t, x_position);
+        auto const rho_sr =
+            _process_data.solid_density.scalarValue(t, x_position);
+        auto const rho_fr =
+            _process_data.fluid_density.scalarValue(t, x_position);
+        auto const porosity = _process_data.porosity.scalarValue(t, x_position);
         auto const& b = _process_data.specific_body_force;
         auto const& identity2 = MathLib::KelvinVector::Invariants<
             MathLib::KelvinVector::KelvinVectorDimensions<
@@ -78,18 +78,14 @@ struct IntegrationPointData final
         DisplacementVectorType const& /*u*/,
         double const T)
     {
-        auto&& solution = solid_material.integrateStress(
-            t, x_position, dt, eps_prev, eps, sigma_eff_prev,
-            *material_state_variables, T);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+        if (!solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_prev, eps, sigma_eff_prev,
+                material_state_variables, T, sigma_eff, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma_eff, material_state_variables, C) = std::move(*solution);
-
         return C;
     }
 
@@ -226,10 +226,13 @@ void HydroMechanicsLocalAssemblerFracture<ShapeFunctionDisplacement,
         auto& state = *ip_data.material_state_variables;
         auto& b_m = ip_data.aperture;
 
-        double const S = frac_prop.specific_storage(t, x_position)[0];
-        double const mu = _process_data.fluid_viscosity(t, x_position)[0];
-        auto const alpha = frac_prop.biot_coefficient(t, x_position)[0];
-        auto const rho_fr = _process_data.fluid_density(t, x_position)[0];
+        double const S = frac_prop.specific_storage.scalarValue(t, x_position);
+        double const mu =
+            _process_data.fluid_viscosity.scalarValue(t, x_position);
+        auto const alpha =
+            frac_prop.biot_coefficient.scalarValue(t, x_position);
+        auto const rho_fr =
+            _process_data.fluid_density.scalarValue(t, x_position);
 
         // displacement jumps in local coordinates
         w.noalias() = R * H_g * g;
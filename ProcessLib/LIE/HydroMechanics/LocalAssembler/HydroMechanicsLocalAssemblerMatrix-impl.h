@@ -220,10 +220,13 @@ void HydroMechanicsLocalAssemblerMatrix<ShapeFunctionDisplacement,
 
         auto q = ip_data.darcy_velocity.head(GlobalDim);
 
-        auto const alpha = _process_data.biot_coefficient(t, x_position)[0];
-        auto const rho_sr = _process_data.solid_density(t, x_position)[0];
-        auto const rho_fr = _process_data.fluid_density(t, x_position)[0];
-        auto const porosity = _process_data.porosity(t, x_position)[0];
+        auto const alpha =
+            _process_data.biot_coefficient.scalarValue(t, x_position);
+        auto const rho_sr =
+            _process_data.solid_density.scalarValue(t, x_position);
+        auto const rho_fr =
+            _process_data.fluid_density.scalarValue(t, x_position);
+        auto const porosity = _process_data.porosity.scalarValue(t, x_position);
 
         double const rho = rho_sr * (1 - porosity) + porosity * rho_fr;
         auto const& identity2 =
@@ -231,18 +234,14 @@ void HydroMechanicsLocalAssemblerMatrix<ShapeFunctionDisplacement,
 
         eps.noalias() = B * u;
 
-        auto&& solution = _ip_data[ip].solid_material.integrateStress(
-            t, x_position, dt, eps_prev, eps, sigma_eff_prev, *state,
-            _process_data.reference_temperature);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<GlobalDim> C;
+        if (!_ip_data[ip].solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_prev, eps, sigma_eff_prev, state,
+                _process_data.reference_temperature, sigma_eff, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<GlobalDim> C;
-        std::tie(sigma_eff, state, C) = std::move(*solution);
-
         J_uu.noalias() += B.transpose() * C * B * ip_w;
 
         rhs_u.noalias() -= B.transpose() * sigma_eff * ip_w;
@@ -260,9 +259,11 @@ void HydroMechanicsLocalAssemblerMatrix<ShapeFunctionDisplacement,
                                                        // active matrix
         {
             double const k_over_mu =
-                _process_data.intrinsic_permeability(t, x_position)[0] /
-                _process_data.fluid_viscosity(t, x_position)[0];
-            double const S = _process_data.specific_storage(t, x_position)[0];
+                _process_data.intrinsic_permeability.scalarValue(t,
+                                                                 x_position) /
+                _process_data.fluid_viscosity.scalarValue(t, x_position);
+            double const S =
+                _process_data.specific_storage.scalarValue(t, x_position);
 
             q.noalias() = -k_over_mu * (dNdx_p * p + rho_fr * gravity_vec);
 
@@ -352,25 +353,23 @@ void HydroMechanicsLocalAssemblerMatrix<ShapeFunctionDisplacement,
 
         eps.noalias() = B * u;
 
-        auto&& solution = _ip_data[ip].solid_material.integrateStress(
-            t, x_position, dt, eps_prev, eps, sigma_eff_prev, *state,
-            _process_data.reference_temperature);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<GlobalDim> C;
+        if (!_ip_data[ip].solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_prev, eps, sigma_eff_prev, state,
+                _process_data.reference_temperature, sigma_eff, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<GlobalDim> C;
-        std::tie(sigma_eff, state, C) = std::move(*solution);
-
         if (!_process_data.deactivate_matrix_in_flow)  // Only for hydraulically
                                                        // active matrix
         {
             double const k_over_mu =
-                _process_data.intrinsic_permeability(t, x_position)[0] /
-                _process_data.fluid_viscosity(t, x_position)[0];
-            auto const rho_fr = _process_data.fluid_density(t, x_position)[0];
+                _process_data.intrinsic_permeability.scalarValue(t,
+                                                                 x_position) /
+                _process_data.fluid_viscosity.scalarValue(t, x_position);
+            auto const rho_fr =
+                _process_data.fluid_density.scalarValue(t, x_position);
             auto const& gravity_vec = _process_data.specific_body_force;
             auto const& dNdx_p = ip_data.dNdx_p;
 
@@ -446,7 +445,7 @@ void HydroMechanicsLocalAssemblerMatrix<
             continue;
         }
         x_position.setNodeID(_element.getNodeIndex(i));
-        auto const p0 = (*_process_data.p0)(t, x_position)[0];
+        auto const p0 = _process_data.p0->scalarValue(t, x_position);
         p[i] = p0;
     }
 }
@@ -99,7 +99,8 @@ SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
 
         ip_data.C.resize(DisplacementDim, DisplacementDim);
 
-        ip_data.aperture0 = _fracture_property->aperture0(0, x_position)[0];
+        ip_data.aperture0 =
+            _fracture_property->aperture0.scalarValue(0, x_position);
         ip_data.aperture_prev = ip_data.aperture0;
 
         _secondary_data.N[ip] = sm.N;
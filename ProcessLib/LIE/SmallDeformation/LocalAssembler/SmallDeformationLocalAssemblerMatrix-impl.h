@@ -151,18 +151,14 @@ void SmallDeformationLocalAssemblerMatrix<ShapeFunction, IntegrationMethod,
             B * Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
                     local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
 
-        auto&& solution = _ip_data[ip]._solid_material.integrateStress(
-            t, x_position, dt, eps_prev, eps, sigma_prev, *state,
-            _process_data._reference_temperature);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+        if (!_ip_data[ip]._solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_prev, eps, sigma_prev, state,
+                _process_data._reference_temperature, sigma, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
-
         local_b.noalias() -= B.transpose() * sigma * w;
         local_Jac.noalias() += B.transpose() * C * B * w;
     }
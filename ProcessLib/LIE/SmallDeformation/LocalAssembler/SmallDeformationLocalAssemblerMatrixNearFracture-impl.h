@@ -252,18 +252,14 @@ void SmallDeformationLocalAssemblerMatrixNearFracture<
 
         eps.noalias() = B * nodal_total_u;
 
-        auto&& solution = _ip_data[ip]._solid_material.integrateStress(
-            t, x_position, dt, eps_prev, eps, sigma_prev, *state,
-            _process_data._reference_temperature);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+        if (!_ip_data[ip]._solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_prev, eps, sigma_prev, state,
+                _process_data._reference_temperature, sigma, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
-
         // r_u = B^T * Sigma = B^T * C * B * (u+phi*[u])
         // r_[u] = (phi*B)^T * Sigma = (phi*B)^T * C * B * (u+phi*[u])
         local_b_u.noalias() -= B.transpose() * sigma * w;
@@ -78,6 +78,9 @@ public:
                                           int const process_id) override;
 
     bool isLinear() const override { return true; }
+
+    bool isCheckpointSupported() const override { return true; }
+
     int getGravitationalAxisID() const { return _gravitational_axis_id; }
     double getGravitationalAcceleration() const
     {
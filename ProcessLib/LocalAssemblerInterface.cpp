@@ -72,7 +72,7 @@ void LocalAssemblerInterface::computeSecondaryVariable(
     NumLib::LocalToGlobalIndexMap const& dof_table, double const t,
     GlobalVector const& x, CoupledSolutionsForStaggeredScheme const* coupled_xs)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const& indices = NumLib::getIndices(mesh_item_id, dof_table);
 
     if (coupled_xs != nullptr)
     {
@@ -88,7 +88,7 @@ void LocalAssemblerInterface::setInitialConditions(
     NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
     double const t)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const& indices = NumLib::getIndices(mesh_item_id, dof_table);
     auto const local_x = x.get(indices);
 
     setInitialConditionsConcrete(local_x, t);
@@ -106,7 +106,7 @@ void LocalAssemblerInterface::preTimestep(
     NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
     double const t, double const delta_t)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const& indices = NumLib::getIndices(mesh_item_id, dof_table);
     auto const local_x = x.get(indices);
 
     preTimestepConcrete(local_x, t, delta_t);
@@ -117,7 +117,7 @@ void LocalAssemblerInterface::postTimestep(
     NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
     double const t, double const dt)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const& indices = NumLib::getIndices(mesh_item_id, dof_table);
     auto const local_x = x.get(indices);
 
     postTimestepConcrete(local_x, t, dt);
@@ -128,7 +128,7 @@ void LocalAssemblerInterface::postNonLinearSolver(
     NumLib::LocalToGlobalIndexMap const& dof_table, GlobalVector const& x,
     double const t, double const dt, bool const use_monolithic_scheme)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const& indices = NumLib::getIndices(mesh_item_id, dof_table);
     auto const local_x = x.get(indices);
 
     postNonLinearSolverConcrete(local_x, t, dt, use_monolithic_scheme);
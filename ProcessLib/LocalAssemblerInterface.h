@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <iosfwd>
+
 #include <Eigen/Dense>
 
 #include "NumLib/NumericsConfig.h"
@@ -94,6 +96,14 @@ public:
                              GlobalVector const& x, double const t,
                              double const dt, bool const use_monolithic_scheme);
 
+    /// Writes the integration point data, e.g. stresses, strains and
+    /// material state variables, as binary into \c os for checkpointing.
+    virtual void writeIntegrationPointCheckpoint(std::ostream& /*os*/) const {}
+
+    /// Restores the integration point data written by
+    /// writeIntegrationPointCheckpoint().
+    virtual void readIntegrationPointCheckpoint(std::istream& /*is*/) {}
+
     /// Computes the flux in the point \c p_local_coords that is given in local
     /// coordinates using the values from \c local_x.
     /// Fits to monolithic scheme.
@@ -0,0 +1,153 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "AsynchronousOutputWriter.h"
+
+#include <cassert>
+#include <utility>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/RunTime.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+
+namespace ProcessLib
+{
+AsynchronousOutputWriter::AsynchronousOutputWriter(
+    std::size_t const max_pending_writes)
+    : _max_pending_writes(max_pending_writes)
+{
+    assert(_max_pending_writes > 0);
+    _thread = std::thread(&AsynchronousOutputWriter::run, this);
+}
+
+AsynchronousOutputWriter::~AsynchronousOutputWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _job_available.notify_one();
+    // The background thread finishes all pending jobs before it returns.
+    _thread.join();
+
+    if (_background_error)
+    {
+        try
+        {
+            std::rethrow_exception(_background_error);
+        }
+        catch (std::exception const& e)
+        {
+            ERR("Asynchronous output failed: %s", e.what());
+        }
+        catch (...)
+        {
+            ERR("Asynchronous output failed with an unknown error.");
+        }
+    }
+}
+
+void AsynchronousOutputWriter::write(std::string file_name,
+                                     MeshLib::Mesh const& mesh,
+                                     bool const compress_output,
+                                     int const data_mode,
+                                     bool const raw_appended_data)
+{
+    // The snapshot is taken before waiting, s.t. the caller may modify the
+    // mesh properties as soon as this function returns.
+    Job job{std::move(file_name), &mesh, mesh.getProperties(),
+            compress_output, data_mode, raw_appended_data};
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    rethrowBackgroundError();
+    if (_jobs.size() >= _max_pending_writes)
+    {
+        BaseLib::RunTime time_waiting;
+        time_waiting.start();
+        _job_taken.wait(lock,
+                        [this] { return _jobs.size() < _max_pending_writes; });
+        DBUG("Waited %g s for the asynchronous output.",
+             time_waiting.elapsed());
+    }
+    _jobs.push_back(std::move(job));
+    lock.unlock();
+    _job_available.notify_one();
+}
+
+void AsynchronousOutputWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _job_taken.wait(lock, [this] { return _jobs.empty() && !_is_writing; });
+    rethrowBackgroundError();
+}
+
+void AsynchronousOutputWriter::rethrowBackgroundError()
+{
+    if (!_background_error)
+    {
+        return;
+    }
+    auto const error = std::move(_background_error);
+    _background_error = nullptr;
+    std::rethrow_exception(error);
+}
+
+void AsynchronousOutputWriter::run()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _job_available.wait(lock,
+                            [this] { return !_jobs.empty() || _terminate; });
+        if (_jobs.empty())
+        {
+            return;  // terminate
+        }
+
+        auto const job = std::move(_jobs.front());
+        _jobs.pop_front();
+        _is_writing = true;
+        lock.unlock();
+        _job_taken.notify_all();
+
+        try
+        {
+            BaseLib::RunTime time_output;
+            time_output.start();
+
+            MeshLib::IO::VtuInterface vtu_interface(
+                job.mesh, job.data_mode, job.compress_output, &job.properties,
+                job.raw_appended_data);
+            if (!vtu_interface.writeToFile(job.file_name))
+            {
+                ERR("Could not write the output file '%s'.",
+                    job.file_name.c_str());
+            }
+
+            DBUG("[time] Asynchronous output to '%s' took %g s.",
+                 job.file_name.c_str(), time_output.elapsed());
+        }
+        catch (...)
+        {
+            lock.lock();
+            _background_error = std::current_exception();
+            lock.unlock();
+        }
+
+        lock.lock();
+        _is_writing = false;
+        lock.unlock();
+        _job_taken.notify_all();
+    }
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "MeshLib/Properties.h"
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace ProcessLib
+{
+/*! Writes VTU files in a background thread.
+ *
+ * write() takes a snapshot of the mesh properties and returns immediately,
+ * the encoding, compression and writing of the file happens in the background
+ * thread. At most \c max_pending_writes snapshots are kept; if that many are
+ * waiting, write() blocks until the background thread has taken one of them.
+ *
+ * The geometry and topology of the meshes must not change and the meshes must
+ * outlive the writer or the next flush().
+ */
+class AsynchronousOutputWriter final
+{
+public:
+    explicit AsynchronousOutputWriter(std::size_t const max_pending_writes);
+
+    AsynchronousOutputWriter(AsynchronousOutputWriter const&) = delete;
+    AsynchronousOutputWriter& operator=(AsynchronousOutputWriter const&) =
+        delete;
+
+    //! Waits for all pending writes.
+    ~AsynchronousOutputWriter();
+
+    //! Enqueues writing the \c mesh with a snapshot of its current properties
+    //! to \c file_name. See makeOutput() for the remaining parameters.
+    void write(std::string file_name, MeshLib::Mesh const& mesh,
+               bool const compress_output, int const data_mode,
+               bool const raw_appended_data);
+
+    //! Blocks until all enqueued files are written. Errors of the background
+    //! thread are reported here or in the next call of write().
+    void flush();
+
+private:
+    struct Job
+    {
+        std::string file_name;
+        MeshLib::Mesh const* mesh;
+        MeshLib::Properties properties;
+        bool compress_output;
+        int data_mode;
+        bool raw_appended_data;
+    };
+
+    void run();
+
+    //! Rethrows an exception of the background thread. The lock must be held.
+    void rethrowBackgroundError();
+
+    std::size_t const _max_pending_writes;
+
+    std::mutex _mutex;
+    //! Notifies the background thread about new jobs or termination.
+    std::condition_variable _job_available;
+    //! Notifies the solver thread about finished or dequeued jobs.
+    std::condition_variable _job_taken;
+
+    std::deque<Job> _jobs;
+    //! True while the background thread is writing a file.
+    bool _is_writing = false;
+    bool _terminate = false;
+    std::exception_ptr _background_error;
+
+    std::thread _thread;
+};
+
+}  // namespace ProcessLib
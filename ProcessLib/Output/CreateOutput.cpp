@@ -31,8 +31,26 @@ std::unique_ptr<Output> createOutput(
 {
     DBUG("Parse output configuration:");
 
-    //! \ogs_file_param{prj__time_loop__output__type}
-    config.checkConfigParameter("type", "VTK");
+    auto const type =
+        //! \ogs_file_param{prj__time_loop__output__type}
+        config.getConfigParameter<std::string>("type");
+    auto const output_type = [&type]() {
+        if (type == "VTK")
+        {
+            return Output::OutputType::vtk;
+        }
+        if (type == "XDMF")
+        {
+#ifndef OGS_USE_XDMF
+            OGS_FATAL(
+                "The XDMF output requires OGS to be built with "
+                "OGS_USE_XDMF=ON.");
+#endif
+            return Output::OutputType::xdmf;
+        }
+        OGS_FATAL("Unsupported output type '%s'. Expected VTK or XDMF.",
+                  type.c_str());
+    }();
 
     auto const prefix =
         //! \ogs_file_param{prj__time_loop__output__prefix}
@@ -132,9 +150,14 @@ std::unique_ptr<Output> createOutput(
         //! \ogs_file_param{prj__time_loop__output__output_iteration_results}
         config.getConfigParameter<bool>("output_iteration_results", false);
 
+    bool const asynchronous_output =
+        //! \ogs_file_param{prj__time_loop__output__asynchronous_output}
+        config.getConfigParameter<bool>("asynchronous_output", false);
+
     return std::make_unique<Output>(
-        output_directory, prefix, compress_output, data_mode,
-        output_iteration_results, std::move(repeats_each_steps),
+        output_directory, output_type, prefix, compress_output, data_mode,
+        output_iteration_results, asynchronous_output,
+        std::move(repeats_each_steps),
         std::move(fixed_output_times), std::move(process_output),
         std::move(mesh_names_for_output), meshes);
 }
@@ -11,6 +11,7 @@
 #include "Output.h"
 
 #include <cassert>
+#include <cstdint>
 #include <fstream>
 #include <vector>
 
@@ -19,8 +20,13 @@
 #include "Applications/InSituLib/Adaptor.h"
 #include "BaseLib/FileTools.h"
 #include "BaseLib/RunTime.h"
+#ifdef OGS_USE_XDMF
+#include "MeshLib/IO/XDMF/XdmfHdfWriter.h"
+#endif
 #include "ProcessLib/Process.h"
 
+#include "AsynchronousOutputWriter.h"
+
 namespace
 {
 //! Converts a vtkXMLWriter's data mode string to an int. See
@@ -35,13 +41,13 @@ int convertVtkDataMode(std::string const& data_mode)
     {
         return 1;
     }
-    if (data_mode == "Appended")
+    if (data_mode == "Appended" || data_mode == "AppendedRaw")
     {
         return 2;
     }
     OGS_FATAL(
         "Unsupported vtk output file data mode '%s'. Expected Ascii, "
-        "Binary, or Appended.",
+        "Binary, Appended, or AppendedRaw.",
         data_mode.c_str());
 }
 
@@ -93,18 +99,22 @@ bool Output::shallDoOutput(int timestep, double const t)
     return make_output;
 }
 
-Output::Output(std::string output_directory, std::string output_file_prefix,
+Output::Output(std::string output_directory, OutputType const output_type,
+               std::string output_file_prefix,
                bool const compress_output, std::string const& data_mode,
                bool const output_nonlinear_iteration_results,
+               bool const asynchronous_output,
                std::vector<PairRepeatEachSteps> repeats_each_steps,
                std::vector<double>&& fixed_output_times,
                ProcessOutput&& process_output,
                std::vector<std::string>&& mesh_names_for_output,
                std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes)
     : _output_directory(std::move(output_directory)),
+      _output_type(output_type),
       _output_file_prefix(std::move(output_file_prefix)),
       _output_file_compression(compress_output),
       _output_file_data_mode(convertVtkDataMode(data_mode)),
+      _output_file_raw_appended_data(data_mode == "AppendedRaw"),
       _output_nonlinear_iteration_results(output_nonlinear_iteration_results),
       _repeats_each_steps(std::move(repeats_each_steps)),
       _fixed_output_times(std::move(fixed_output_times)),
@@ -112,6 +122,31 @@ Output::Output(std::string output_directory, std::string output_file_prefix,
       _mesh_names_for_output(mesh_names_for_output),
       _meshes(meshes)
 {
+    if (asynchronous_output)
+    {
+#ifdef USE_PETSC
+        // The parallel VTU writer communicates between the ranks, which is
+        // not allowed from a second thread.
+        WARN(
+            "Asynchronous output is not supported with PETSc, the output is "
+            "written synchronously.");
+#else
+        // One snapshot is written while the next one is waiting.
+        std::size_t const max_pending_writes = 1;
+        _asynchronous_writer =
+            std::make_unique<AsynchronousOutputWriter>(max_pending_writes);
+#endif
+    }
+}
+
+Output::~Output() = default;
+
+void Output::flush()
+{
+    if (_asynchronous_writer)
+    {
+        _asynchronous_writer->flush();
+    }
 }
 
 void Output::addProcess(ProcessLib::Process const& process,
@@ -151,6 +186,55 @@ Output::ProcessData* Output::findProcessData(Process const& process,
     return process_data;
 }
 
+void Output::writeCheckpoint(std::ostream& os, Process const& process,
+                             const int process_id)
+{
+    // The checkpoint shall only reference completely written files.
+    flush();
+
+    auto const& vtu_files =
+        findProcessData(process, process_id)->pvd_file.getVTUFiles();
+
+    BaseLib::writeValueBinary(os, static_cast<std::uint64_t>(vtu_files.size()));
+    for (auto const& vtu_file : vtu_files)
+    {
+        BaseLib::writeValueBinary(os, vtu_file.first);
+        BaseLib::writeValueBinary(
+            os, static_cast<std::uint64_t>(vtu_file.second.size()));
+        BaseLib::writeArrayBinary(os, vtu_file.second.data(),
+                                  vtu_file.second.size());
+    }
+}
+
+void Output::readCheckpoint(std::istream& is, Process const& process,
+                            const int process_id)
+{
+    // The XDMF writer would truncate the HDF5 file holding the time steps
+    // before the checkpoint.
+    if (_output_type == OutputType::xdmf)
+    {
+        OGS_FATAL("A simulation with XDMF output cannot be restarted.");
+    }
+
+    auto const n_vtu_files = BaseLib::readBinaryValue<std::uint64_t>(is);
+    std::vector<std::pair<double, std::string>> vtu_files;
+    for (std::uint64_t i = 0; is && i < n_vtu_files; ++i)
+    {
+        auto const t = BaseLib::readBinaryValue<double>(is);
+        std::string file_name(BaseLib::readBinaryValue<std::uint64_t>(is),
+                              '\0');
+        BaseLib::readArrayBinary(is, &file_name[0], file_name.size());
+        vtu_files.emplace_back(t, std::move(file_name));
+    }
+    if (!is)
+    {
+        OGS_FATAL("Could not read the output state from the checkpoint.");
+    }
+
+    findProcessData(process, process_id)
+        ->pvd_file.setVTUFiles(std::move(vtu_files));
+}
+
 struct Output::OutputFile
 {
     OutputFile(std::string const& directory, std::string const& prefix,
@@ -184,8 +268,43 @@ void Output::outputBulkMesh(OutputFile const& output_file,
 
     process_data->pvd_file.addVTUFile(output_file.name, t);
 
-    makeOutput(output_file.path, mesh, output_file.compression,
-               output_file.data_mode);
+    writeMeshFile(output_file.path, mesh, output_file.compression,
+                  output_file.data_mode);
+}
+
+void Output::writeMeshFile(std::string const& file_path,
+                           MeshLib::Mesh const& mesh,
+                           bool const compress_output,
+                           int const data_mode) const
+{
+    if (_asynchronous_writer)
+    {
+        _asynchronous_writer->write(file_path, mesh, compress_output,
+                                    data_mode, _output_file_raw_appended_data);
+        return;
+    }
+    makeOutput(file_path, mesh, compress_output, data_mode,
+               _output_file_raw_appended_data);
+}
+
+void Output::writeXdmfStep(std::string const& name,
+                           MeshLib::Mesh const& mesh, double const t)
+{
+#ifdef OGS_USE_XDMF
+    auto& writer = _xdmf_writers[name];
+    if (!writer)
+    {
+        writer = std::make_unique<MeshLib::IO::XdmfHdfWriter>(
+            mesh, BaseLib::joinPaths(_output_directory, name));
+    }
+    DBUG("output to %s.h5 at t = %g", name.c_str(), t);
+    writer->writeStep(t);
+#else
+    (void)mesh;
+    (void)t;
+    OGS_FATAL("Cannot write the XDMF output '%s', OGS was built without XDMF.",
+              name.c_str());
+#endif
 }
 
 void Output::doOutputAlways(Process const& process,
@@ -215,6 +334,13 @@ void Output::doOutputAlways(Process const& process,
     }
 
     auto output_bulk_mesh = [&]() {
+        if (_output_type == OutputType::xdmf)
+        {
+            writeXdmfStep(
+                _output_file_prefix + "_pcs_" + std::to_string(process_id),
+                process.getMesh(), t);
+            return;
+        }
         outputBulkMesh(
             OutputFile(_output_directory, _output_file_prefix, process_id,
                        timestep, t, _output_file_data_mode,
@@ -259,6 +385,14 @@ void Output::doOutputAlways(Process const& process,
                           output_secondary_variable,
                           process.getIntegrationPointWriter(), _process_output);
 
+        if (_output_type == OutputType::xdmf)
+        {
+            writeXdmfStep(
+                mesh.getName() + "_pcs_" + std::to_string(process_id), mesh,
+                t);
+            continue;
+        }
+
         // TODO (TomFischer): add pvd support here. This can be done if the
         // output is mesh related instead of process related. This would also
         // allow for merging bulk mesh output and arbitrary mesh output.
@@ -273,8 +407,8 @@ void Output::doOutputAlways(Process const& process,
 
         DBUG("output to %s", output_file.path.c_str());
 
-        makeOutput(output_file.path, mesh, output_file.compression,
-                   output_file.data_mode);
+        writeMeshFile(output_file.path, mesh, output_file.compression,
+                      output_file.data_mode);
     }
     INFO("[time] Output of timestep %d took %g s.", timestep,
          time_output.elapsed());
@@ -307,6 +441,7 @@ void Output::doOutputLastTimestep(Process const& process,
     {
         doOutputAlways(process, process_id, timestep, t, x);
     }
+    flush();
 #ifdef USE_INSITU
     InSituLib::CoProcess(process.getMesh(), t, timestep, true);
 #endif
@@ -355,7 +490,7 @@ void Output::doOutputNonlinearIteration(Process const& process,
 
     INFO("[time] Output took %g s.", time_output.elapsed());
 
-    makeOutput(output_file_path, process.getMesh(), _output_file_compression,
-               _output_file_data_mode);
+    writeMeshFile(output_file_path, process.getMesh(),
+                  _output_file_compression, _output_file_data_mode);
 }
 }  // namespace ProcessLib
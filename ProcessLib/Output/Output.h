@@ -10,14 +10,25 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <map>
+#include <memory>
 #include <utility>
 
 #include "MeshLib/IO/VtkIO/PVDFile.h"
 #include "ProcessOutput.h"
 
+namespace MeshLib
+{
+namespace IO
+{
+class XdmfHdfWriter;
+}
+}  // namespace MeshLib
+
 namespace ProcessLib
 {
+class AsynchronousOutputWriter;
 class Process;
 
 /*! Manages writing the solution of processes to disk.
@@ -28,6 +39,13 @@ class Process;
 class Output
 {
 public:
+    //! File formats of the output.
+    enum class OutputType
+    {
+        vtk,   //!< One VTU file per timestep referenced by a PVD file.
+        xdmf,  //!< One HDF5 file for all timesteps described by an XDMF file.
+    };
+
     struct PairRepeatEachSteps
     {
         explicit PairRepeatEachSteps(int c, int e) : repeat(c), each_steps(e) {}
@@ -37,15 +55,20 @@ public:
     };
 
 public:
-    Output(std::string output_directory, std::string prefix,
+    Output(std::string output_directory, OutputType const output_type,
+           std::string prefix,
            bool const compress_output, std::string const& data_mode,
            bool const output_nonlinear_iteration_results,
+           bool const asynchronous_output,
            std::vector<PairRepeatEachSteps> repeats_each_steps,
            std::vector<double>&& fixed_output_times,
            ProcessOutput&& process_output,
            std::vector<std::string>&& mesh_names_for_output,
            std::vector<std::unique_ptr<MeshLib::Mesh>> const& meshes);
 
+    //! Waits for pending asynchronous writes.
+    ~Output();
+
     //! TODO doc. Opens a PVD file for each process.
     void addProcess(ProcessLib::Process const& process, const int process_id);
 
@@ -77,6 +100,21 @@ public:
 
     std::vector<double> getFixedOutputTimes() {return _fixed_output_times;}
 
+    //! Blocks until all output files are completely written. Does nothing if
+    //! the output is written synchronously.
+    void flush();
+
+    //! Writes the list of output files of the given process, which is
+    //! referenced from its PVD file, as binary into \c os.
+    void writeCheckpoint(std::ostream& os, Process const& process,
+                         const int process_id);
+
+    //! Restores the list of output files written by writeCheckpoint(), such
+    //! that the PVD file of a restarted simulation also references the output
+    //! files written before the restart.
+    void readCheckpoint(std::istream& is, Process const& process,
+                        const int process_id);
+
 private:
     struct ProcessData
     {
@@ -93,8 +131,20 @@ private:
                         MeshLib::Mesh const& mesh,
                         double const t) const;
 
+    //! Writes the \c mesh to the given path either directly or through the
+    //! asynchronous writer.
+    void writeMeshFile(std::string const& file_path, MeshLib::Mesh const& mesh,
+                       bool const compress_output,
+                       int const data_mode) const;
+
+    //! Appends the properties of the \c mesh as timestep \c t to the XDMF
+    //! output \c name, which is created on the first call.
+    void writeXdmfStep(std::string const& name, MeshLib::Mesh const& mesh,
+                       double const t);
+
 private:
     std::string const _output_directory;
+    OutputType const _output_type;
     std::string const _output_file_prefix;
 
     //! Enables or disables zlib-compression of the output files.
@@ -104,6 +154,10 @@ private:
     /// the vtkXMLWriter: {Ascii, Binary, Appended}.  See vtkXMLWriter
     /// documentation http://www.vtk.org/doc/nightly/html/classvtkXMLWriter.html
     int const _output_file_data_mode;
+    //! Writes the appended data in raw binary instead of base64 encoding
+    //! (data mode AppendedRaw). Raw data is written faster without the VTK
+    //! pipeline, but the files are not valid XML.
+    bool const _output_file_raw_appended_data;
     bool const _output_nonlinear_iteration_results;
 
     //! Describes after which timesteps to write output.
@@ -128,6 +182,16 @@ private:
     ProcessOutput const _process_output;
     std::vector<std::string> const _mesh_names_for_output;
     std::vector<std::unique_ptr<MeshLib::Mesh>> const& _meshes;
+
+    //! Writes the output files in a background thread if set; otherwise the
+    //! output is written synchronously.
+    std::unique_ptr<AsynchronousOutputWriter> _asynchronous_writer;
+
+#ifdef OGS_USE_XDMF
+    //! The XDMF outputs by their file names without extension.
+    std::map<std::string, std::unique_ptr<MeshLib::IO::XdmfHdfWriter>>
+        _xdmf_writers;
+#endif
 };
 
 
@@ -241,11 +241,13 @@ void processOutputData(
 }
 
 void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
-                bool const compress_output, int const data_mode)
+                bool const compress_output, int const data_mode,
+                bool const raw_appended_data)
 {
     // Write output file
     DBUG("Writing output to '%s'.", file_name.c_str());
-    MeshLib::IO::VtuInterface vtu_interface(&mesh, data_mode, compress_output);
+    MeshLib::IO::VtuInterface vtu_interface(&mesh, data_mode, compress_output,
+                                            nullptr, raw_appended_data);
     vtu_interface.writeToFile(file_name);
 }
 
@@ -44,9 +44,11 @@ void processOutputData(
 
 //! Writes output to the given \c file_name using the VTU file format.
 ///
-/// See Output::_output_file_data_mode documentation for the data_mode
-/// parameter.
+/// See Output::_output_file_data_mode and
+/// Output::_output_file_raw_appended_data documentation for the data_mode and
+/// raw_appended_data parameters.
 void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
-                bool const compress_output, int const data_mode);
+                bool const compress_output, int const data_mode,
+                bool const raw_appended_data = false);
 
 }  // namespace ProcessLib
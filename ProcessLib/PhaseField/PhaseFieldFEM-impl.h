@@ -110,7 +110,8 @@ void PhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
 
         auto& eps = _ip_data[ip].eps;
         eps.noalias() = B * u;
-        double const k = _process_data.residual_stiffness(t, x_position)[0];
+        double const k =
+            _process_data.residual_stiffness.scalarValue(t, x_position);
         double const d_ip = N.dot(d);
         double const degradation = d_ip * d_ip * (1 - k) + k;
         _ip_data[ip].updateConstitutiveRelation(t, x_position, dt, u,
@@ -133,7 +134,8 @@ void PhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
                 .noalias() = N;
         }
 
-        auto const rho_sr = _process_data.solid_density(t, x_position)[0];
+        auto const rho_sr =
+            _process_data.solid_density.scalarValue(t, x_position);
         auto const& b = _process_data.specific_body_force;
 
         local_rhs.noalias() -=
@@ -203,13 +205,16 @@ void PhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
         auto const& N = _ip_data[ip].N;
         auto const& dNdx = _ip_data[ip].dNdx;
 
-        double const gc = _process_data.crack_resistance(t, x_position)[0];
-        double const ls = _process_data.crack_length_scale(t, x_position)[0];
+        double const gc =
+            _process_data.crack_resistance.scalarValue(t, x_position);
+        double const ls =
+            _process_data.crack_length_scale.scalarValue(t, x_position);
 
         // for propagating crack, u is rescaled.
         if (_process_data.propagating_crack)
         {
-            double const k = _process_data.residual_stiffness(t, x_position)[0];
+            double const k =
+                _process_data.residual_stiffness.scalarValue(t, x_position);
             double const d_ip = N.dot(d);
             double const degradation = d_ip * d_ip * (1 - k) + k;
             auto const x_coord =
@@ -376,8 +381,10 @@ void PhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
         double const d_ip = N.dot(d);
         auto pressure_ip = _process_data.pressure;
         auto u_corrected = pressure_ip * u;
-        double const gc = _process_data.crack_resistance(t, x_position)[0];
-        double const ls = _process_data.crack_length_scale(t, x_position)[0];
+        double const gc =
+            _process_data.crack_resistance.scalarValue(t, x_position);
+        double const ls =
+            _process_data.crack_length_scale.scalarValue(t, x_position);
 
         typename ShapeMatricesType::template MatrixType<DisplacementDim,
                                                         displacement_size>
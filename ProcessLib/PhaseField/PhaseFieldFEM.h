@@ -177,9 +177,9 @@ public:
             ip_data.sigma_tensile.setZero(kelvin_vector_size);
             ip_data.sigma_compressive.setZero(kelvin_vector_size);
             ip_data.history_variable =
-                _process_data.history_field(0, x_position)[0];
+                _process_data.history_field.scalarValue(0, x_position);
             ip_data.history_variable_prev =
-                _process_data.history_field(0, x_position)[0];
+                _process_data.history_field.scalarValue(0, x_position);
             ip_data.sigma.setZero(kelvin_vector_size);
             ip_data.strain_energy_tensile = 0.0;
             ip_data.elastic_energy = 0.0;
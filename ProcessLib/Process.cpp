@@ -10,8 +10,10 @@
 
 #include "Process.h"
 
+#include "BaseLib/Algorithm.h"
 #include "BaseLib/Functional.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
 #include "ParameterLib/Parameter.h"
@@ -126,7 +128,6 @@ void Process::setInitialConditions(const int process_id, double const t,
          variable_id++)
     {
         MathLib::LinAlg::setLocalAccessibleVector(x);
-        ParameterLib::SpatialPosition pos;
 
         auto const& pv = per_process_variables[variable_id];
         DBUG("Set the initial condition of variable %s of process %d.",
@@ -136,18 +137,31 @@ void Process::setInitialConditions(const int process_id, double const t,
 
         auto const num_comp = pv.get().getNumberOfComponents();
 
+        // The values of all nodes are evaluated at once for all components,
+        // which allows e.g. the parallel evaluation of function parameters.
+        // The components usually share their nodes, then the values are
+        // evaluated only once.
+        Eigen::MatrixXd ic_values;
+        std::vector<MeshLib::Node*> const* evaluated_nodes = nullptr;
+
         for (int component_id = 0; component_id < num_comp; ++component_id)
         {
             auto const& mesh_subset =
                 dof_table_of_process.getMeshSubset(variable_id, component_id);
             auto const mesh_id = mesh_subset.getMeshID();
-            for (auto const* node : mesh_subset.getNodes())
+            auto const& nodes = mesh_subset.getNodes();
+
+            if (evaluated_nodes == nullptr || *evaluated_nodes != nodes)
             {
-                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
-                                          node->getID());
+                ic_values.resize(nodes.size(), ic.getNumberOfComponents());
+                ic.evaluateAtNodes(t, nodes, ic_values);
+                evaluated_nodes = &nodes;
+            }
 
-                pos.setNodeID(node->getID());
-                auto const& ic_value = ic(t, pos);
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+            {
+                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                          nodes[i]->getID());
 
                 auto global_index =
                     std::abs(dof_table_of_process.getGlobalIndex(l, variable_id,
@@ -164,7 +178,7 @@ void Process::setInitialConditions(const int process_id, double const t,
                 if (global_index == x.size())
                     global_index = 0;
 #endif
-                x.set(global_index, ic_value[component_id]);
+                x.set(global_index, ic_values(i, component_id));
             }
         }
     }
@@ -176,7 +190,23 @@ MathLib::MatrixSpecifications Process::getMatrixSpecifications(
 {
     auto const& l = *_local_to_global_index_map;
     return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-            &l.getGhostIndices(), &_sparsity_pattern};
+            &l.getGhostIndices(), &_sparsity_pattern,
+            getCompressedSparsityPattern()};
+}
+
+void Process::setCompactDeactivatedSubdomains(
+    bool const compact_deactivated_subdomains)
+{
+#ifdef USE_PETSC
+    if (compact_deactivated_subdomains)
+    {
+        WARN(
+            "The restriction of the equation system to the active elements is "
+            "not implemented for PETSc. The full equation system is solved.");
+    }
+#else
+    _compact_deactivated_subdomains = compact_deactivated_subdomains;
+#endif
 }
 
 void Process::updateDeactivatedSubdomains(double const time,
@@ -187,6 +217,95 @@ void Process::updateDeactivatedSubdomains(double const time,
     {
         variable.get().updateDeactivatedSubdomains(time);
     }
+
+    if (!_compact_deactivated_subdomains)
+    {
+        return;
+    }
+
+    if (static_cast<int>(_active_indices.size()) <= process_id)
+    {
+        _active_indices.resize(process_id + 1);
+        _active_element_ids.resize(process_id + 1);
+    }
+
+    // The local assemblers are called for the active elements of the first
+    // process variable.
+    auto const& active_element_ids =
+        variables_per_process[0].get().getActiveElementIDs();
+    if (active_element_ids == _active_element_ids[process_id])
+    {
+        return;
+    }
+    _active_element_ids[process_id] = active_element_ids;
+
+    auto& active_indices = _active_indices[process_id];
+    active_indices.clear();
+    auto const& dof_table = getDOFTable(process_id);
+    for (auto const id : active_element_ids)
+    {
+        auto const indices = NumLib::getIndices(id, dof_table);
+        active_indices.insert(active_indices.end(), indices.begin(),
+                              indices.end());
+    }
+    BaseLib::makeVectorUnique(active_indices);
+}
+
+std::vector<GlobalIndexType> const* Process::getActiveIndices() const
+{
+    const auto pcs_id =
+        (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
+    if (static_cast<int>(_active_indices.size()) <= pcs_id ||
+        _active_indices[pcs_id].empty())
+    {
+        return nullptr;
+    }
+    return &_active_indices[pcs_id];
+}
+
+void Process::writeCheckpoint(std::ostream& os) const
+{
+    if (!isCheckpointSupported())
+    {
+        OGS_FATAL("Process '%s' does not support checkpoints.", name.c_str());
+    }
+
+    // The process data is stored with its size, s.t. reading it back can be
+    // checked for consistency.
+    std::ostringstream buffer(std::ios::binary);
+    writeCheckpointConcreteProcess(buffer);
+    auto const data = buffer.str();
+
+    BaseLib::writeValueBinary(os, static_cast<std::uint64_t>(data.size()));
+    BaseLib::writeArrayBinary(os, data.data(), data.size());
+}
+
+void Process::readCheckpoint(std::istream& is)
+{
+    if (!isCheckpointSupported())
+    {
+        OGS_FATAL("Process '%s' does not support checkpoints.", name.c_str());
+    }
+
+    auto const size = BaseLib::readBinaryValue<std::uint64_t>(is);
+    if (!is)
+    {
+        OGS_FATAL("Could not read the checkpoint data of process '%s'.",
+                  name.c_str());
+    }
+    std::string data(size, '\0');
+    BaseLib::readArrayBinary(is, &data[0], data.size());
+
+    std::istringstream buffer(data, std::ios::binary);
+    readCheckpointConcreteProcess(buffer);
+    if (!is || !buffer ||
+        buffer.tellg() != static_cast<std::streamoff>(data.size()))
+    {
+        OGS_FATAL(
+            "The checkpoint data of process '%s' does not match the process "
+            "setup.",
+            name.c_str());
+    }
 }
 
 void Process::preAssemble(const double t, double const dt,
@@ -200,6 +319,7 @@ void Process::assemble(const double t, double const dt, GlobalVector const& x,
 {
     MathLib::LinAlg::setLocalAccessibleVector(x);
 
+    _global_assembler.resetScatterTime();
     assembleConcreteProcess(t, dt, x, M, K, b);
 
     const auto pcs_id =
@@ -221,6 +341,7 @@ void Process::assembleWithJacobian(const double t, double const dt,
     MathLib::LinAlg::setLocalAccessibleVector(x);
     MathLib::LinAlg::setLocalAccessibleVector(xdot);
 
+    _global_assembler.resetScatterTime();
     assembleWithJacobianConcreteProcess(t, dt, x, xdot, dxdot_dx, dx_dx, M, K,
                                         b, Jac);
 
@@ -233,6 +354,32 @@ void Process::assembleWithJacobian(const double t, double const dt,
     _source_term_collections[pcs_id].integrate(t, x, b, &Jac);
 }
 
+void Process::assembleResidualWithJacobian(
+    const double t, double const dt, GlobalVector const& x,
+    GlobalVector const& xdot, const double dxdot_dx, const double dx_dx,
+    GlobalVector& b, GlobalMatrix& Jac)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    MathLib::LinAlg::setLocalAccessibleVector(xdot);
+
+    // The concrete processes pass M and K on to the global assembler, which
+    // does not access them in the residual-only mode. The Jacobian stands in
+    // for both of them.
+    _global_assembler.resetScatterTime();
+    _global_assembler.setResidualOnlyAssembly(true);
+    assembleWithJacobianConcreteProcess(t, dt, x, xdot, dxdot_dx, dx_dx, Jac,
+                                        Jac, b, Jac);
+    _global_assembler.setResidualOnlyAssembly(false);
+
+    // With a Jacobian given, the natural boundary conditions add their K terms
+    // to b, too.
+    const auto pcs_id =
+        (_coupled_solutions) != nullptr ? _coupled_solutions->process_id : 0;
+    _boundary_conditions[pcs_id].applyNaturalBC(t, x, Jac, b, &Jac);
+
+    _source_term_collections[pcs_id].integrate(t, x, b, &Jac);
+}
+
 void Process::constructDofTable()
 {
     if (_use_monolithic_scheme)
@@ -374,10 +521,26 @@ void Process::finishNamedFunctionsInitialization()
     }
 }
 
+GlobalCompressedSparsityPattern const* Process::getCompressedSparsityPattern()
+    const
+{
+    if (_compressed_sparsity_pattern.column_indices.empty())
+    {
+        return nullptr;
+    }
+    return &_compressed_sparsity_pattern;
+}
+
 void Process::computeSparsityPattern()
 {
+#ifdef USE_PETSC
     _sparsity_pattern =
         NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
+#else
+    _compressed_sparsity_pattern = NumLib::computeCompressedSparsityPattern(
+        *_local_to_global_index_map, _mesh);
+    _sparsity_pattern = MathLib::getRowSizes(_compressed_sparsity_pattern);
+#endif
 }
 
 void Process::preTimestep(GlobalVector const& x, const double t,
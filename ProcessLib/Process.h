@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <tuple>
 
 #include "NumLib/NamedFunctionCaller.h"
@@ -79,6 +80,31 @@ public:
 
     NumLib::IterationResult postIteration(GlobalVector const& x) final;
 
+    double getScatterTime() const final
+    {
+        return _global_assembler.getScatterTime();
+    }
+
+    /// Enables caching of the positions of the local matrix entries in the
+    /// global matrices, see VectorMatrixAssembler::setCachedScatter().
+    void setCachedScatter(bool const cached_scatter)
+    {
+        _global_assembler.setCachedScatter(cached_scatter);
+    }
+
+    /// Enables the assembly of the residual and the Jacobian without the
+    /// global matrices M and K for the Newton method, see
+    /// assembleResidualWithJacobian().
+    void setResidualOnlyAssembly(bool const residual_only_assembly)
+    {
+        _residual_only_assembly = residual_only_assembly;
+    }
+
+    /// Restricts the linear equation systems to the unknowns of the active
+    /// elements while subdomains are deactivated, see getActiveIndices().
+    void setCompactDeactivatedSubdomains(
+        bool const compact_deactivated_subdomains);
+
     void initialize();
 
     void setInitialConditions(const int process_id, const double t,
@@ -95,6 +121,21 @@ public:
 
     void updateDeactivatedSubdomains(double const time, const int process_id);
 
+    /// Returns true if writeCheckpoint() stores the complete internal state
+    /// of the process, i.e., if the process has no state besides its solution
+    /// or implements writeCheckpointConcreteProcess() and
+    /// readCheckpointConcreteProcess().
+    virtual bool isCheckpointSupported() const { return false; }
+
+    /// Writes the internal state of the process, e.g. the integration point
+    /// data of the local assemblers, as binary into \c os. Together with the
+    /// solution vectors this is all needed to restart a simulation.
+    void writeCheckpoint(std::ostream& os) const;
+
+    /// Restores the internal state written by writeCheckpoint(). The process
+    /// must have been initialized before.
+    void readCheckpoint(std::istream& is);
+
     bool isMonolithicSchemeUsed() const { return _use_monolithic_scheme; }
     virtual void setCoupledTermForTheStaggeredSchemeToLocalAssemblers() {}
     void preAssemble(const double t, double const dt,
@@ -108,6 +149,24 @@ public:
                               GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
                               GlobalMatrix& Jac) final;
 
+    bool isResidualOnlyAssembly() const final
+    {
+        return _residual_only_assembly;
+    }
+
+    void assembleResidualWithJacobian(const double t, double const dt,
+                                      GlobalVector const& x,
+                                      GlobalVector const& xdot,
+                                      const double dxdot_dx, const double dx_dx,
+                                      GlobalVector& b, GlobalMatrix& Jac) final;
+
+    void setJacobianAssembly(bool const jacobian_assembly) final
+    {
+        _global_assembler.setJacobianAssembly(jacobian_assembly);
+    }
+
+    std::vector<GlobalIndexType> const* getActiveIndices() const final;
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t, GlobalVector const& x) const final
     {
@@ -239,6 +298,10 @@ private:
         return NumLib::IterationResult::SUCCESS;
     }
 
+    virtual void writeCheckpointConcreteProcess(std::ostream& /*os*/) const {}
+
+    virtual void readCheckpointConcreteProcess(std::istream& /*is*/) {}
+
 protected:
     /** This function is for general cases, in which all equations of the
      coupled processes have the same number of unknowns. For the general cases
@@ -274,6 +337,10 @@ protected:
     virtual std::tuple<NumLib::LocalToGlobalIndexMap*, bool>
     getDOFTableForExtrapolatorData() const;
 
+    /// Returns the complete nonzero structure of the global matrix for
+    /// \c _local_to_global_index_map or \c nullptr if it is not available.
+    GlobalCompressedSparsityPattern const* getCompressedSparsityPattern() const;
+
 private:
     void initializeExtrapolator();
 
@@ -303,6 +370,16 @@ protected:
 
     VectorMatrixAssembler _global_assembler;
 
+    bool _residual_only_assembly = false;
+
+    bool _compact_deactivated_subdomains = false;
+
+    /// The sorted global indices of the unknowns of the active elements for
+    /// each process id. Empty if no subdomain is deactivated.
+    std::vector<std::vector<GlobalIndexType>> _active_indices;
+    /// The active element ids the active indices have been computed for.
+    std::vector<std::vector<std::size_t>> _active_element_ids;
+
     const bool _use_monolithic_scheme;
 
     /// Pointer to CoupledSolutionsForStaggeredScheme, which contains the
@@ -322,6 +399,10 @@ protected:
 
     GlobalSparsityPattern _sparsity_pattern;
 
+    /// Complete nonzero structure of the global matrix for
+    /// \c _local_to_global_index_map. Empty if not available, e.g. with PETSc.
+    GlobalCompressedSparsityPattern _compressed_sparsity_pattern;
+
 protected:
     /// Variables used by this process.  For the monolithic scheme or a
     /// single process, the size of the outer vector is one. For the
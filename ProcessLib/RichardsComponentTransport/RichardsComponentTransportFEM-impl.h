@@ -136,12 +136,12 @@ void LocalAssemblerData<ShapeFunction, IntegrationMethod, GlobalDim>::assemble(
                 t, pos, 0.0, C_int_pt);
 
         auto const retardation_factor =
-            _process_data.retardation_factor(t, pos)[0];
+            _process_data.retardation_factor.scalarValue(t, pos);
 
         auto const solute_dispersivity_transverse =
-            _process_data.solute_dispersivity_transverse(t, pos)[0];
+            _process_data.solute_dispersivity_transverse.scalarValue(t, pos);
         auto const solute_dispersivity_longitudinal =
-            _process_data.solute_dispersivity_longitudinal(t, pos)[0];
+            _process_data.solute_dispersivity_longitudinal.scalarValue(t, pos);
 
         // Use the fluid density model to compute the density
         vars[static_cast<int>(MaterialLib::Fluid::PropertyVariableType::C)] =
@@ -150,9 +150,9 @@ void LocalAssemblerData<ShapeFunction, IntegrationMethod, GlobalDim>::assemble(
             p_int_pt;
         auto const density = _process_data.fluid_properties->getValue(
             MaterialLib::Fluid::FluidPropertyType::Density, vars);
-        auto const decay_rate = _process_data.decay_rate(t, pos)[0];
+        auto const decay_rate = _process_data.decay_rate.scalarValue(t, pos);
         auto const molecular_diffusion_coefficient =
-            _process_data.molecular_diffusion_coefficient(t, pos)[0];
+            _process_data.molecular_diffusion_coefficient.scalarValue(t, pos);
 
         auto const& K = _process_data.porous_media_properties
                             .getIntrinsicPermeability(t, pos)
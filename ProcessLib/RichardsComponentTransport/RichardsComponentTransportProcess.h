@@ -123,6 +123,8 @@ public:
     bool isLinear() const override { return false; }
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+
 private:
     void initializeConcreteProcess(
         NumLib::LocalToGlobalIndexMap const& dof_table,
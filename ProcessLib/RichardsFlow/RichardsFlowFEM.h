@@ -171,7 +171,8 @@ public:
             pos.setIntegrationPoint(ip);
             double p_int_pt = 0.0;
             NumLib::shapeFunctionInterpolate(local_x, _ip_data[ip].N, p_int_pt);
-            const double& temperature = _process_data.temperature(t, pos)[0];
+            const double temperature =
+                _process_data.temperature.scalarValue(t, pos);
             auto const porosity = _process_data.material->getPorosity(
                 material_id, t, pos, p_int_pt, temperature, 0);
 
@@ -293,7 +294,8 @@ public:
             double p_int_pt = 0.0;
             NumLib::shapeFunctionInterpolate(local_x, _ip_data[ip].N, p_int_pt);
             double const pc_int_pt = -p_int_pt;
-            const double& temperature = _process_data.temperature(t, pos)[0];
+            const double temperature =
+                _process_data.temperature.scalarValue(t, pos);
             double const Sw = _process_data.material->getSaturation(
                 material_id, t, pos, p_int_pt, temperature, pc_int_pt);
             double const k_rel =
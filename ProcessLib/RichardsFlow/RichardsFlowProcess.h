@@ -47,6 +47,8 @@ public:
     bool isLinear() const override { return false; }
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+
 private:
     void initializeConcreteProcess(
         NumLib::LocalToGlobalIndexMap const& dof_table,
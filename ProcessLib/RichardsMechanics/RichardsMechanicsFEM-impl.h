@@ -194,11 +194,16 @@ void RichardsMechanicsLocalAssembler<
         auto& eps = _ip_data[ip].eps;
         auto& S_L = _ip_data[ip].saturation;
 
-        auto const alpha = _process_data.biot_coefficient(t, x_position)[0];
-        auto const rho_SR = _process_data.solid_density(t, x_position)[0];
-        auto const K_SR = _process_data.solid_bulk_modulus(t, x_position)[0];
-        auto const K_LR = _process_data.fluid_bulk_modulus(t, x_position)[0];
-        auto const temperature = _process_data.temperature(t, x_position)[0];
+        auto const alpha =
+            _process_data.biot_coefficient.scalarValue(t, x_position);
+        auto const rho_SR =
+            _process_data.solid_density.scalarValue(t, x_position);
+        auto const K_SR =
+            _process_data.solid_bulk_modulus.scalarValue(t, x_position);
+        auto const K_LR =
+            _process_data.fluid_bulk_modulus.scalarValue(t, x_position);
+        auto const temperature =
+            _process_data.temperature.scalarValue(t, x_position);
         auto const porosity = _process_data.flow_material->getPorosity(
             material_id, t, x_position, -p_cap_ip, temperature, p_cap_ip);
         auto const rho_LR = _process_data.flow_material->getFluidDensity(
@@ -407,11 +412,16 @@ void RichardsMechanicsLocalAssembler<ShapeFunctionDisplacement,
         auto& S_L = _ip_data[ip].saturation;
         auto const& sigma_eff = _ip_data[ip].sigma_eff;
 
-        auto const alpha = _process_data.biot_coefficient(t, x_position)[0];
-        auto const rho_SR = _process_data.solid_density(t, x_position)[0];
-        auto const K_SR = _process_data.solid_bulk_modulus(t, x_position)[0];
-        auto const K_LR = _process_data.fluid_bulk_modulus(t, x_position)[0];
-        auto const temperature = _process_data.temperature(t, x_position)[0];
+        auto const alpha =
+            _process_data.biot_coefficient.scalarValue(t, x_position);
+        auto const rho_SR =
+            _process_data.solid_density.scalarValue(t, x_position);
+        auto const K_SR =
+            _process_data.solid_bulk_modulus.scalarValue(t, x_position);
+        auto const K_LR =
+            _process_data.fluid_bulk_modulus.scalarValue(t, x_position);
+        auto const temperature =
+            _process_data.temperature.scalarValue(t, x_position);
 
         auto const porosity = _process_data.flow_material->getPorosity(
             material_id, t, x_position, -p_cap_ip, temperature, p_cap_ip);
@@ -685,7 +695,8 @@ std::vector<double> const& RichardsMechanicsLocalAssembler<
         double p_cap_ip;
         NumLib::shapeFunctionInterpolate(-p_L, N_p, p_cap_ip);
 
-        auto const temperature = _process_data.temperature(t, x_position)[0];
+        auto const temperature =
+            _process_data.temperature.scalarValue(t, x_position);
         GlobalDimMatrixType const K_over_mu =
             intrinsicPermeability<DisplacementDim>(
                 t, x_position, material_id, *_process_data.flow_material) /
@@ -815,7 +826,8 @@ void RichardsMechanicsLocalAssembler<ShapeFunctionDisplacement,
         x_position.setIntegrationPoint(ip);
         auto const& N_u = _ip_data[ip].N_u;
         auto const& dNdx_u = _ip_data[ip].dNdx_u;
-        auto const temperature = _process_data.temperature(t, x_position)[0];
+        auto const temperature =
+            _process_data.temperature.scalarValue(t, x_position);
 
         auto const x_coord =
             interpolateXCoordinate<ShapeFunctionDisplacement,
@@ -862,7 +874,8 @@ void RichardsMechanicsLocalAssembler<ShapeFunctionDisplacement,
     {
         x_position.setIntegrationPoint(ip);
         auto const& N_p = _ip_data[ip].N_p;
-        auto const temperature = _process_data.temperature(t, x_position)[0];
+        auto const temperature =
+            _process_data.temperature.scalarValue(t, x_position);
 
         double p_cap_ip;
         NumLib::shapeFunctionInterpolate(-p_L, N_p, p_cap_ip);
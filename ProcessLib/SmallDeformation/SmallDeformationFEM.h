@@ -10,9 +10,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+#include "BaseLib/FileTools.h"
 #include "MaterialLib/PhysicalConstant.h"
 #include "MaterialLib/SolidModels/SelectSolidConstitutiveRelation.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
@@ -67,6 +69,26 @@ struct IntegrationPointData final
         material_state_variables->pushBackState();
     }
 
+    void writeCheckpoint(std::ostream& os) const
+    {
+        for (auto const* v : {&sigma, &sigma_prev, &eps, &eps_prev})
+        {
+            BaseLib::writeArrayBinary(os, v->data(), v->size());
+        }
+        BaseLib::writeValueBinary(os, free_energy_density);
+        material_state_variables->writeCheckpoint(os);
+    }
+
+    void readCheckpoint(std::istream& is)
+    {
+        for (auto* v : {&sigma, &sigma_prev, &eps, &eps_prev})
+        {
+            BaseLib::readArrayBinary(is, v->data(), v->size());
+        }
+        free_energy_density = BaseLib::readBinaryValue<double>(is);
+        material_state_variables->readCheckpoint(is);
+    }
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
@@ -295,19 +317,16 @@ public:
                 Eigen::Map<typename BMatricesType::NodalForceVectorType const>(
                     local_x.data(), ShapeFunction::NPOINTS * DisplacementDim);
 
-            auto&& solution = _ip_data[ip].solid_material.integrateStress(
-                t, x_position, dt, eps_prev, eps, sigma_prev, *state,
-                _process_data.reference_temperature);
-
-            if (!solution)
+            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+            if (!_ip_data[ip].solid_material.integrateStressInPlace(
+                    t, x_position, dt, eps_prev, eps, sigma_prev, state,
+                    _process_data.reference_temperature, sigma, C))
             {
                 OGS_FATAL("Computation of local constitutive relation failed.");
             }
 
-            MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-            std::tie(sigma, state, C) = std::move(*solution);
-
-            auto const rho = _process_data.solid_density(t, x_position)[0];
+            auto const rho =
+                _process_data.solid_density.scalarValue(t, x_position);
             auto const& b = _process_data.specific_body_force;
             local_b.noalias() -=
                 (B.transpose() * sigma - N_u_op.transpose() * rho * b) * w;
@@ -492,6 +511,33 @@ public:
         return *_ip_data[integration_point].material_state_variables;
     }
 
+    void writeIntegrationPointCheckpoint(std::ostream& os) const override
+    {
+        BaseLib::writeValueBinary(os,
+                                  static_cast<std::uint32_t>(_ip_data.size()));
+        for (auto const& ip_data : _ip_data)
+        {
+            ip_data.writeCheckpoint(os);
+        }
+    }
+
+    void readIntegrationPointCheckpoint(std::istream& is) override
+    {
+        auto const n_integration_points =
+            BaseLib::readBinaryValue<std::uint32_t>(is);
+        if (!is || n_integration_points != _ip_data.size())
+        {
+            OGS_FATAL(
+                "The checkpoint does not match the number of integration "
+                "points of element %d.",
+                _element.getID());
+        }
+        for (auto& ip_data : _ip_data)
+        {
+            ip_data.readCheckpoint(is);
+        }
+    }
+
 private:
     SmallDeformationProcessData<DisplacementDim>& _process_data;
 
@@ -302,6 +302,26 @@ void SmallDeformationProcess<DisplacementDim>::postTimestepConcreteProcess(
     material_forces->copyValues(*_material_forces);
 }
 
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::writeCheckpointConcreteProcess(
+    std::ostream& os) const
+{
+    for (auto const& local_asm : _local_assemblers)
+    {
+        local_asm->writeIntegrationPointCheckpoint(os);
+    }
+}
+
+template <int DisplacementDim>
+void SmallDeformationProcess<DisplacementDim>::readCheckpointConcreteProcess(
+    std::istream& is)
+{
+    for (auto& local_asm : _local_assemblers)
+    {
+        local_asm->readIntegrationPointCheckpoint(is);
+    }
+}
+
 template class SmallDeformationProcess<2>;
 template class SmallDeformationProcess<3>;
 
@@ -41,6 +41,8 @@ public:
     bool isLinear() const override;
     //! @}
 
+    bool isCheckpointSupported() const override { return true; }
+
 private:
     using LocalAssemblerInterface =
         SmallDeformationLocalAssemblerInterface<DisplacementDim>;
@@ -64,6 +66,10 @@ private:
                                      const double delta_t,
                                      int const process_id) override;
 
+    void writeCheckpointConcreteProcess(std::ostream& os) const override;
+
+    void readCheckpointConcreteProcess(std::istream& is) override;
+
 private:
     SmallDeformationProcessData<DisplacementDim> _process_data;
 
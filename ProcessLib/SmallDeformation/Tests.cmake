@@ -32,6 +32,7 @@ if (NOT OGS_USE_MPI)
     OgsTest(PROJECTFILE Mechanics/Linear/PressureBC/hollow_sphere.prj LARGE)
     OgsTest(PROJECTFILE Mechanics/Linear/PressureBC/axisymmetric_sphere.prj)
     OgsTest(PROJECTFILE Mechanics/Linear/square_with_deactivated_hole.prj)
+    OgsTest(PROJECTFILE Mechanics/Linear/square_with_deactivated_hole_compact.prj)
     OgsTest(PROJECTFILE Mechanics/Ehlers/axisymmetric_sphere_pl.prj LARGE)
     #OgsTest(PROJECTFILE Mechanics/InitialStates/into_initial_state.prj)
     #OgsTest(PROJECTFILE Mechanics/InitialStates/equilibrium_restart.prj)
@@ -47,6 +48,35 @@ if (OGS_USE_MPI)
     # OgsTest(WRAPPER mpirun -np 4 PROJECTFILE Mechanics/Linear/disc_with_hole.prj)
 endif()
 
+# Continues from the checkpoint at step 60 and compares the last step, which
+# depends on the plastic state of the Ehlers model, with the uninterrupted run.
+RestartTest(
+    NAME Mechanics_SDL_Ehlers_cube_1e0_restart
+    PATH Mechanics/Ehlers
+    PROJECTFILE cube_1e0_restart.prj
+    CHECKPOINT cube_1e0_restart_checkpoint.bin
+    REQUIREMENTS NOT OGS_USE_MPI
+    DIFF_DATA
+    cube_1e0_restart_pcs_0_ts_101_t_2.550000.vtu displacement
+    cube_1e0_restart_pcs_0_ts_101_t_2.550000.vtu sigma
+    cube_1e0_restart_pcs_0_ts_101_t_2.550000.vtu epsilon
+    cube_1e0_restart_pcs_0_ts_101_t_2.550000.vtu sigma_ip
+)
+
+RestartTest(
+    NAME Mechanics_SDL_Ehlers_cube_1e0_restart_PETSc
+    PATH Mechanics/Ehlers
+    PROJECTFILE cube_1e0_restart.prj
+    CHECKPOINT cube_1e0_restart_checkpoint.bin
+    WRAPPER mpirun -np 1
+    REQUIREMENTS OGS_USE_MPI
+    DIFF_DATA
+    cube_1e0_restart_pcs_0_ts_101_t_2_550000_0.vtu displacement
+    cube_1e0_restart_pcs_0_ts_101_t_2_550000_0.vtu sigma
+    cube_1e0_restart_pcs_0_ts_101_t_2_550000_0.vtu epsilon
+    cube_1e0_restart_pcs_0_ts_101_t_2_550000_0.vtu sigma_ip
+)
+
 if (OGS_USE_MFRONT)
     OgsTest(PROJECTFILE Mechanics/MohrCoulombAbboSloan/load_test_mc.prj)
 
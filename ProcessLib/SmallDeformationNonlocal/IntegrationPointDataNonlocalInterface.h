@@ -10,6 +10,10 @@
 
 #pragma once
 
+#include <atomic>
+
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 namespace SmallDeformationNonlocal
@@ -18,23 +22,49 @@ struct IntegrationPointDataNonlocalInterface;
 
 struct NonlocalIP final
 {
-    IntegrationPointDataNonlocalInterface* const ip_l_pointer;
+    IntegrationPointDataNonlocalInterface* ip_l_pointer;
     double alpha_kl_times_w_l;
-    double distance2;  ///< Squared distance to current integration point.
+};
+
+/// The neighbouring integration points of an integration point, a row of the
+/// compressed storage of all neighbourhoods held by the process.
+struct NonlocalIPRange final
+{
+    NonlocalIP const* begin() const { return first; }
+    NonlocalIP const* end() const { return last; }
+
+    NonlocalIP const* first = nullptr;
+    NonlocalIP const* last = nullptr;
 };
 
 struct IntegrationPointDataNonlocalInterface
 {
+    IntegrationPointDataNonlocalInterface() = default;
+
+    IntegrationPointDataNonlocalInterface(
+        IntegrationPointDataNonlocalInterface const& other)
+        : non_local_assemblers(other.non_local_assemblers),
+          kappa_d(other.kappa_d),
+          integration_weight(other.integration_weight),
+          nonlocal_internal_length(other.nonlocal_internal_length),
+          coordinates(other.coordinates),
+          active_self(other.active_self),
+          activated(other.activated.load(std::memory_order_relaxed))
+    {
+    }
+
     virtual ~IntegrationPointDataNonlocalInterface() = default;
 
-    std::vector<NonlocalIP> non_local_assemblers;
+    NonlocalIPRange non_local_assemblers;
 
     double kappa_d = 0;      ///< damage driving variable.
     double integration_weight;
     double nonlocal_internal_length;
     Eigen::Vector3d coordinates;
     bool active_self = false;
-    bool activated = false;
+    /// Set by the neighbouring integration points during the pre-assembly,
+    /// which runs concurrently for the local assemblers.
+    std::atomic<bool> activated{false};
 
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
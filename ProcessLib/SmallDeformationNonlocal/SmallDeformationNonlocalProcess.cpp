@@ -13,6 +13,7 @@
 #include <nlohmann/json.hpp>
 #include <iostream>
 
+#include "GeoLib/findPointsWithinRadius.h"
 #include "ProcessLib/Output/IntegrationPointWriter.h"
 
 // Reusing local assembler creation code.
@@ -140,9 +141,7 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
         makeExtrapolator(1, getExtrapolator(), _local_assemblers,
                          &LocalAssemblerInterface::getIntPtDamage));
 
-    GlobalExecutor::executeMemberOnDereferenced(
-        &LocalAssemblerInterface::nonlocal, _local_assemblers,
-        _local_assemblers);
+    initializeNonlocalNeighbourhoods();
 
     // Set initial conditions for integration point data.
     for (auto const& ip_writer : _integration_point_writer)
@@ -229,6 +228,76 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
         *_local_to_global_index_map);
 }
 
+template <int DisplacementDim>
+void SmallDeformationNonlocalProcess<
+    DisplacementDim>::initializeNonlocalNeighbourhoods()
+{
+    std::vector<IntegrationPointDataNonlocalInterface*> ip_data;
+    std::vector<MathLib::Point3d> coordinates;
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        unsigned const n_integration_points =
+            local_assembler->getNumberOfIntegrationPoints();
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            auto* const data = local_assembler->getIPDataPtr(ip);
+            ip_data.push_back(data);
+            auto const& xyz = data->coordinates;
+            coordinates.emplace_back(
+                std::array<double, 3>{{xyz[0], xyz[1], xyz[2]}});
+        }
+    }
+
+    double const internal_length2 = _process_data.internal_length_squared;
+    auto const neighbourhoods =
+        GeoLib::findPointsWithinRadius(coordinates, internal_length2);
+    auto const& offsets = neighbourhoods.offsets;
+    for (std::size_t k = 0; k < ip_data.size(); ++k)
+    {
+        if (offsets[k] == offsets[k + 1])
+        {
+            OGS_FATAL("no neighbours found!");
+        }
+    }
+
+    auto alpha_0 = [internal_length2](double const distance2) {
+        return (1 - distance2 / internal_length2) *
+               (1 - distance2 / internal_length2);
+    };
+
+    _nonlocal_ips.resize(neighbourhoods.indices.size());
+    auto const n_ips = static_cast<std::ptrdiff_t>(ip_data.size());
+#pragma omp parallel for schedule(dynamic, 256)
+    for (std::ptrdiff_t k = 0; k < n_ips; ++k)
+    {
+        double a_k_sum_m = 0;
+        for (auto m = offsets[k]; m < offsets[k + 1]; ++m)
+        {
+            auto const w_m =
+                ip_data[neighbourhoods.indices[m]]->integration_weight;
+            a_k_sum_m += w_m * alpha_0(neighbourhoods.squared_distances[m]);
+        }
+
+        //
+        // Calculate alpha_kl =
+        //       alpha_0(|x_k - x_l|) / int_{m \in ip} alpha_0(|x_k - x_m|)
+        //
+        // and store it already multiplied with the integration weight of that
+        // l integration point.
+        for (auto l = offsets[k]; l < offsets[k + 1]; ++l)
+        {
+            auto* const ip_l = ip_data[neighbourhoods.indices[l]];
+            double const a_kl =
+                alpha_0(neighbourhoods.squared_distances[l]) / a_k_sum_m;
+            _nonlocal_ips[l] = {ip_l, a_kl * ip_l->integration_weight};
+        }
+
+        ip_data[k]->non_local_assemblers = {
+            _nonlocal_ips.data() + offsets[k],
+            _nonlocal_ips.data() + offsets[k + 1]};
+    }
+}
+
 template <int DisplacementDim>
 void SmallDeformationNonlocalProcess<DisplacementDim>::assembleConcreteProcess(
     const double t, double const dt, GlobalVector const& x, GlobalMatrix& M,
@@ -53,6 +53,10 @@ private:
         MeshLib::Mesh const& mesh,
         unsigned const integration_order) override;
 
+    /// Finds for each integration point the neighbouring integration points
+    /// within the internal length and computes their weights.
+    void initializeNonlocalNeighbourhoods();
+
     void assembleConcreteProcess(const double t, double const dt,
                                  GlobalVector const& x, GlobalMatrix& M,
                                  GlobalMatrix& K, GlobalVector& b) override;
@@ -80,6 +84,10 @@ private:
         SmallDeformationNonlocalLocalAssemblerInterface<DisplacementDim>;
     std::vector<std::unique_ptr<LocalAssemblerInterface>> _local_assemblers;
 
+    /// The neighbouring integration points of all integration points. The
+    /// integration point data refer to their ranges in this vector.
+    std::vector<NonlocalIP> _nonlocal_ips;
+
     std::unique_ptr<NumLib::LocalToGlobalIndexMap>
         _local_to_global_index_map_single_component;
 
@@ -75,6 +75,15 @@ PythonSourceTerm::PythonSourceTerm(
         *_source_term_dof_table, shapefunction_order, _local_assemblers,
         _source_term_data.source_term_mesh.isAxiallySymmetric(),
         integration_order, _source_term_data);
+
+    _integration_point_offsets.reserve(_local_assemblers.size() + 1);
+    _integration_point_offsets.push_back(0);
+    for (auto const& local_assembler : _local_assemblers)
+    {
+        _integration_point_offsets.push_back(
+            _integration_point_offsets.back() +
+            local_assembler->getNumberOfIntegrationPoints());
+    }
 }
 
 void PythonSourceTerm::integrate(const double t, const GlobalVector& x,
@@ -82,11 +91,72 @@ void PythonSourceTerm::integrate(const double t, const GlobalVector& x,
 {
     FlushStdoutGuard guard(_flush_stdout);
 
+    if (_source_term_data.source_term_object->isOverriddenBatched() &&
+        integrateBatched(t, x, b, Jac))
+    {
+        return;
+    }
+
     GlobalExecutor::executeMemberOnDereferenced(
         &PythonSourceTermLocalAssemblerInterface::assemble, _local_assemblers,
         *_source_term_dof_table, t, x, b, Jac);
 }
 
+bool PythonSourceTerm::integrateBatched(const double t, const GlobalVector& x,
+                                        GlobalVector& b,
+                                        GlobalMatrix* Jac) const
+{
+    auto const n_integration_points =
+        static_cast<Eigen::Index>(_integration_point_offsets.back());
+    auto const num_comp_total = _source_term_dof_table->getNumberOfComponents();
+
+    PythonSourceTermPythonSideInterface::Matrix coords(n_integration_points,
+                                                       3);
+    PythonSourceTermPythonSideInterface::Matrix primary_variables(
+        n_integration_points, num_comp_total);
+    for (std::size_t id = 0; id < _local_assemblers.size(); ++id)
+    {
+        auto const offset = _integration_point_offsets[id];
+        auto const n = _integration_point_offsets[id + 1] - offset;
+        _local_assemblers[id]->getIntegrationPointData(
+            *_source_term_dof_table, x, coords.middleRows(offset, n),
+            primary_variables.middleRows(offset, n));
+    }
+
+    auto const fluxes_dfluxes = _source_term_data.source_term_object->getFluxes(
+        t, coords, primary_variables);
+    if (!_source_term_data.source_term_object->isOverriddenBatched())
+    {
+        DBUG(
+            "Method `getFluxes' not overridden in Python script. Calling "
+            "`getFlux' for each integration point.");
+        return false;
+    }
+
+    auto const& fluxes = fluxes_dfluxes.first;
+    auto const& dfluxes = fluxes_dfluxes.second;
+    if (fluxes.size() != n_integration_points ||
+        dfluxes.rows() != n_integration_points)
+    {
+        OGS_FATAL(
+            "The Python source term must return one flux and one row of "
+            "derivatives per integration point. %d integration points "
+            "expected. %d fluxes and %d rows of derivatives returned from "
+            "Python.",
+            n_integration_points, fluxes.size(), dfluxes.rows());
+    }
+
+    for (std::size_t id = 0; id < _local_assemblers.size(); ++id)
+    {
+        auto const offset = _integration_point_offsets[id];
+        auto const n = _integration_point_offsets[id + 1] - offset;
+        _local_assemblers[id]->assembleFromFluxes(
+            id, *_source_term_dof_table, fluxes.segment(offset, n),
+            dfluxes.middleRows(offset, n), b, Jac);
+    }
+    return true;
+}
+
 }  // namespace Python
 }  // namespace SourceTerms
 }  // namespace ProcessLib
@@ -56,6 +56,12 @@ public:
                    GlobalMatrix* jac) const override;
 
 private:
+    //! Computes the fluxes at all integration points by a single call of
+    //! PythonSourceTermPythonSideInterface::getFluxes(). Returns false if that
+    //! method is not overridden in the Python script.
+    bool integrateBatched(const double t, GlobalVector const& x,
+                          GlobalVector& b, GlobalMatrix* jac) const;
+
     //! Auxiliary data.
     PythonSourceTermData _source_term_data;
 
@@ -63,6 +69,10 @@ private:
     std::vector<std::unique_ptr<PythonSourceTermLocalAssemblerInterface>>
         _local_assemblers;
 
+    //! The integration points of the i-th local assembler are the rows
+    //! [offsets[i], offsets[i+1]) of the arrays passed to getFluxes().
+    std::vector<std::size_t> _integration_point_offsets;
+
     //! Whether or not to flush standard output before and after each call to
     //! Python code. Ensures right order of output messages and therefore
     //! simplifies debugging.
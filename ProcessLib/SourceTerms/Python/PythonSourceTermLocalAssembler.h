@@ -91,8 +91,66 @@ public:
                   double const t, const GlobalVector& x, GlobalVector& b,
                   GlobalMatrix* Jac) override
     {
-        using ShapeMatricesType =
-            ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+        unsigned const num_integration_points =
+            _integration_method.getNumberOfPoints();
+        auto const num_comp_total =
+            dof_table_source_term.getNumberOfComponents();
+
+        PythonSourceTermPythonSideInterface::Matrix coords(
+            num_integration_points, 3);
+        PythonSourceTermPythonSideInterface::Matrix primary_variables(
+            num_integration_points, num_comp_total);
+        getIntegrationPointData(dof_table_source_term, x, coords,
+                                primary_variables);
+
+        Eigen::VectorXd fluxes(num_integration_points);
+        PythonSourceTermPythonSideInterface::Matrix dfluxes(
+            num_integration_points, num_comp_total);
+        std::vector<double> prim_vars_data(num_comp_total);
+        auto prim_vars = MathLib::toVector(prim_vars_data);
+
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            prim_vars = primary_variables.row(ip).transpose();
+            auto const flux_dflux = _data.source_term_object->getFlux(
+                t, {coords(ip, 0), coords(ip, 1), coords(ip, 2)},
+                prim_vars_data);
+            auto const& dflux = flux_dflux.second;
+
+            if (static_cast<int>(dflux.size()) != num_comp_total)
+            {
+                // This strict check is technically mandatory only if a
+                // Jacobian is assembled. However, it is done as a
+                // consistency check also for cases without Jacobian
+                // assembly.
+                OGS_FATAL(
+                    "The Python source term must return the derivative of "
+                    "the flux w.r.t. each primary variable. %d components "
+                    "expected. %d components returned from Python.",
+                    num_comp_total, dflux.size());
+            }
+
+            fluxes[ip] = flux_dflux.first;
+            dfluxes.row(ip) =
+                Eigen::Map<Eigen::RowVectorXd const>(dflux.data(), dflux.size());
+        }
+
+        assembleFromFluxes(source_term_element_id, dof_table_source_term,
+                           fluxes, dfluxes, b, Jac);
+    }
+
+    unsigned getNumberOfIntegrationPoints() const override
+    {
+        return _integration_method.getNumberOfPoints();
+    }
+
+    void getIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        GlobalVector const& x,
+        Eigen::Ref<PythonSourceTermPythonSideInterface::Matrix> coords,
+        Eigen::Ref<PythonSourceTermPythonSideInterface::Matrix>
+            primary_variables) const override
+    {
         auto const fe = NumLib::createIsoparametricFiniteElement<
             ShapeFunction, ShapeMatricesType>(_element);
 
@@ -149,39 +207,49 @@ public:
             }
         }
 
+        for (unsigned ip = 0; ip < num_integration_points; ip++)
+        {
+            auto const& N = _ip_data[ip].N;
+            auto const ip_coords = fe.interpolateCoordinates(N);
+            coords.row(ip) = Eigen::Map<Eigen::RowVector3d const>(
+                ip_coords.data());
+            // Assumption: all primary variables have same shape functions.
+            primary_variables.row(ip).noalias() = N * primary_variables_mat;
+        }
+    }
+
+    void assembleFromFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_source_term,
+        Eigen::Ref<Eigen::VectorXd const> fluxes,
+        Eigen::Ref<PythonSourceTermPythonSideInterface::Matrix const> dfluxes,
+        GlobalVector& b, GlobalMatrix* Jac) override
+    {
+        unsigned const num_integration_points =
+            _integration_method.getNumberOfPoints();
+        auto const num_nodes = ShapeFunction::NPOINTS;
+        auto const num_comp_total =
+            dof_table_source_term.getNumberOfComponents();
+
+        if (static_cast<int>(dfluxes.cols()) != num_comp_total)
+        {
+            OGS_FATAL(
+                "The Python source term must return the derivative of the "
+                "flux w.r.t. each primary variable. %d components expected. "
+                "%d components returned from Python.",
+                num_comp_total, dfluxes.cols());
+        }
+
         NodalRowVectorType local_rhs = Eigen::VectorXd::Zero(num_nodes);
         NodalMatrixType local_Jac =
             Eigen::MatrixXd::Zero(num_nodes, num_nodes * num_comp_total);
-        std::vector<double> prim_vars_data(num_comp_total);
-        auto prim_vars = MathLib::toVector(prim_vars_data);
 
         for (unsigned ip = 0; ip < num_integration_points; ip++)
         {
             auto const& ip_data = _ip_data[ip];
             auto const& N = ip_data.N;
-            auto const& coords = fe.interpolateCoordinates(N);
-            // Assumption: all primary variables have same shape functions.
-            prim_vars = N * primary_variables_mat;
-
             auto const& w = ip_data.integration_weight;
-            auto const flux_dflux =
-                _data.source_term_object->getFlux(t, coords, prim_vars_data);
-            auto const& flux = flux_dflux.first;
-            auto const& dflux = flux_dflux.second;
-            local_rhs.noalias() += N * (flux * w);
-
-            if (static_cast<int>(dflux.size()) != num_comp_total)
-            {
-                // This strict check is technically mandatory only if a
-                // Jacobian is assembled. However, it is done as a
-                // consistency check also for cases without Jacobian
-                // assembly.
-                OGS_FATAL(
-                    "The Python source term must return the derivative of "
-                    "the flux w.r.t. each primary variable. %d components "
-                    "expected. %d components returned from Python.",
-                    num_comp_total, dflux.size());
-            }
+            local_rhs.noalias() += N * (fluxes[ip] * w);
 
             if (Jac)
             {
@@ -194,21 +262,19 @@ public:
                     // The assignement -= takes into account the sign convention
                     // of 1st-order in time ODE systems in OpenGeoSys.
                     local_Jac.block(top, left, width, height).noalias() -=
-                        ip_data.N.transpose() * (dflux[comp] * w) * N;
+                        ip_data.N.transpose() * (dfluxes(ip, comp) * w) * N;
                 }
             }
         }
 
-        auto const& indices_specific_component =
-            dof_table_source_term(source_term_element_id,
-                                  _data.global_component_id)
-                .rows;
+        auto const indices_specific_component = dof_table_source_term(
+            source_term_element_id, _data.global_component_id);
         b.add(indices_specific_component, local_rhs);
 
         if (Jac)
         {
             // only assemble a block of the Jacobian, not the whole local matrix
-            auto const indices_all_components = NumLib::getIndices(
+            auto const& indices_all_components = NumLib::getIndices(
                 source_term_element_id, dof_table_source_term);
             MathLib::RowColumnIndices<GlobalIndexType> rci{
                 indices_specific_component, indices_all_components};
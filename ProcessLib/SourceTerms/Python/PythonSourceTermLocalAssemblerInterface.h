@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "PythonSourceTermPythonSideInterface.h"
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -26,6 +28,28 @@ public:
         double const t, const GlobalVector& x, GlobalVector& b,
         GlobalMatrix* Jac) = 0;
 
+    virtual unsigned getNumberOfIntegrationPoints() const = 0;
+
+    //! Writes the coordinates and the values of all primary variables at the
+    //! integration points of the element to the rows of \c coords and
+    //! \c primary_variables, respectively.
+    virtual void getIntegrationPointData(
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        GlobalVector const& x,
+        Eigen::Ref<PythonSourceTermPythonSideInterface::Matrix> coords,
+        Eigen::Ref<PythonSourceTermPythonSideInterface::Matrix>
+            primary_variables) const = 0;
+
+    //! Assembles the given fluxes at the integration points and their
+    //! derivatives w.r.t. the primary variables (one row per integration
+    //! point).
+    virtual void assembleFromFluxes(
+        std::size_t const source_term_element_id,
+        NumLib::LocalToGlobalIndexMap const& source_term_dof_table,
+        Eigen::Ref<Eigen::VectorXd const> fluxes,
+        Eigen::Ref<PythonSourceTermPythonSideInterface::Matrix const> dfluxes,
+        GlobalVector& b, GlobalMatrix* Jac) = 0;
+
     virtual ~PythonSourceTermLocalAssemblerInterface() = default;
 };
 
@@ -10,6 +10,7 @@
 
 #include "PythonSourceTermModule.h"
 
+#include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "PythonSourceTermPythonSideInterface.h"
@@ -38,6 +39,15 @@ public:
         PYBIND11_OVERLOAD_PURE(Ret, PythonSourceTermPythonSideInterface,
                                getFlux, t, x, primary_variables);
     }
+
+    std::pair<Eigen::VectorXd, Matrix> getFluxes(
+        double t, Eigen::Ref<Matrix const> coords,
+        Eigen::Ref<Matrix const> primary_variables) const override
+    {
+        using Ret = std::pair<Eigen::VectorXd, Matrix>;
+        PYBIND11_OVERLOAD(Ret, PythonSourceTermPythonSideInterface, getFluxes,
+                          t, coords, primary_variables);
+    }
 };
 
 void pythonBindSourceTerm(pybind11::module& m)
@@ -51,6 +61,7 @@ void pythonBindSourceTerm(pybind11::module& m)
     pybc.def(py::init());
 
     pybc.def("getFlux", &PythonSourceTermPythonSideInterface::getFlux);
+    pybc.def("getFluxes", &PythonSourceTermPythonSideInterface::getFluxes);
 }
 
 }  // namespace Python
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <Eigen/Core>
+
 namespace ProcessLib
 {
 namespace SourceTerms
@@ -22,6 +24,11 @@ namespace Python
 class PythonSourceTermPythonSideInterface
 {
 public:
+    //! Row-major s.t. each row, e.g. the coordinates of one point, is
+    //! contiguous in memory.
+    using Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                                 Eigen::RowMajor>;
+
     /*!
      * Computes the flux for the provided arguments (time, position of the node,
      * primary variables at the node).
@@ -33,7 +40,40 @@ public:
         double /*t*/, std::array<double, 3> const& /*x*/,
         std::vector<double> const& /*primary_variables*/) const = 0;
 
+    /*!
+     * Computes the fluxes at all integration points of the source term mesh
+     * at once. This is the batched version of getFlux(), which is called for
+     * each integration point separately if this method is not overridden.
+     *
+     * The arguments are the time, the coordinates of the integration points
+     * (one row per point), and the primary variables at the integration points
+     * (one row per point). On the Python side they are NumPy arrays
+     * referencing the memory of OpenGeoSys, which are only valid during the
+     * call.
+     *
+     * \return a pair (fluxes, dfluxes) of the flux at each integration point
+     * and its derivatives w.r.t. all primary variables (one row per point).
+     */
+    virtual std::pair<Eigen::VectorXd, Matrix> getFluxes(
+        double /*t*/, Eigen::Ref<Matrix const> /*coords*/,
+        Eigen::Ref<Matrix const> /*primary_variables*/) const
+    {
+        _overridden_batched = false;
+        return {};
+    }
+
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    //!
+    //! \pre getFluxes() must already have been called once.
+    bool isOverriddenBatched() const { return _overridden_batched; }
+
     virtual ~PythonSourceTermPythonSideInterface() = default;
+
+private:
+    //! Tells if getFluxes() has been overridden in the derived class in
+    //! Python.
+    mutable bool _overridden_batched = true;
 };
 }  // namespace Python
 }  // namespace SourceTerms
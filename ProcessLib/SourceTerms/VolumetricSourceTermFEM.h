@@ -104,12 +104,12 @@ public:
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
             pos.setIntegrationPoint(ip);
-            auto const st_val = _volumetric_source_term(t, pos)[0];
+            auto const st_val = _volumetric_source_term.scalarValue(t, pos);
 
             _local_rhs.noalias() +=
                 st_val * _ip_data[ip].integration_weight_times_N;
         }
-        auto const indices = NumLib::getIndices(id, source_term_dof_table);
+        auto const& indices = NumLib::getIndices(id, source_term_dof_table);
         b.add(indices, _local_rhs);
     }
 
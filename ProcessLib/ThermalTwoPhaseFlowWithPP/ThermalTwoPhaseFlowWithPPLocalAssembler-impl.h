@@ -223,7 +223,8 @@ void ThermalTwoPhaseFlowWithPPLocalAssembler<
             p_vapor_nonwet * water_mol_mass / IdealGasConstant / T_int_pt;
         double const density_nonwet = density_nonwet_gas + density_nonwet_vapor;
         double const density_wet = density_water;
-        double const density_solid = _process_data.density_solid(t, pos)[0];
+        double const density_solid =
+            _process_data.density_solid.scalarValue(t, pos);
         // Derivative of nonwet phase density in terms of T
         double const d_density_nonwet_d_T =
             _process_data.material->calculatedDensityNonwetdT (
@@ -245,7 +246,7 @@ void ThermalTwoPhaseFlowWithPPLocalAssembler<
             _process_data.material->getSpecificHeatCapacitySolid(pg_int_pt,
                                                                  T_int_pt);
         double const latent_heat_evaporation =
-            _process_data.latent_heat_evaporation(t, pos)[0];
+            _process_data.latent_heat_evaporation.scalarValue(t, pos);
 
         double const enthalpy_nonwet_gas =
             _process_data.material->getAirEnthalpySimple(
@@ -332,7 +333,7 @@ void ThermalTwoPhaseFlowWithPPLocalAssembler<
             _pressure_wetting[ip], T_int_pt);
         double const lambda_nonwet = k_rel_nonwet / mu_nonwet;
         double const diffusion_coeff_component_gas =
-            _process_data.diffusion_coeff_component_b(t, pos)[0];
+            _process_data.diffusion_coeff_component_b.scalarValue(t, pos);
 
         // wet
         double const k_rel_wet =
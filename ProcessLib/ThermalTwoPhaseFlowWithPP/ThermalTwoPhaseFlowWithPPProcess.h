@@ -56,6 +56,9 @@ public:
             curves);
 
     bool isLinear() const override { return false; }
+
+    bool isCheckpointSupported() const override { return true; }
+
 private:
     void initializeConcreteProcess(
         NumLib::LocalToGlobalIndexMap const& dof_table,
@@ -80,15 +80,13 @@ struct IntegrationPointData final
         DisplacementVectorType const& /*u*/,
         double const T)
     {
-        auto&& solution = solid_material.integrateStress(
-            t, x_position, dt, eps_m_prev, eps_m, sigma_eff_prev,
-            *material_state_variables, T);
-
-        if (!solution)
-            OGS_FATAL("Computation of local constitutive relation failed.");
-
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma_eff, material_state_variables, C) = std::move(*solution);
+        if (!solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_m_prev, eps_m, sigma_eff_prev,
+                material_state_variables, T, sigma_eff, C))
+        {
+            OGS_FATAL("Computation of local constitutive relation failed.");
+        }
 
         return C;
     }
@@ -108,15 +106,13 @@ struct IntegrationPointData final
 
         // assume isotropic thermal expansion
         eps_m.noalias() = eps - thermal_strain * identity2;
-        auto&& solution = solid_material.integrateStress(
-            t, x_position, dt, eps_m_prev, eps_m, sigma_eff_prev,
-            *material_state_variables, T);
-
-        if (!solution)
-            OGS_FATAL("Computation of local constitutive relation failed.");
-
         MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma_eff, material_state_variables, C) = std::move(*solution);
+        if (!solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_m_prev, eps_m, sigma_eff_prev,
+                material_state_variables, T, sigma_eff, C))
+        {
+            OGS_FATAL("Computation of local constitutive relation failed.");
+        }
 
         return C;
     }
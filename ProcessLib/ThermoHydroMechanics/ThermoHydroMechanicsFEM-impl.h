@@ -267,7 +267,8 @@ void ThermoHydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
                 .template value<double>(vars, x_position, t);
         GlobalDimMatrixType K_over_mu = intrinsic_permeability / viscosity;
 
-        double const T0 = _process_data.reference_temperature(t, x_position)[0];
+        double const T0 =
+            _process_data.reference_temperature.scalarValue(t, x_position);
 
         auto const& b = _process_data.specific_body_force;
         auto const& identity2 = MathLib::KelvinVector::Invariants<
@@ -290,7 +291,7 @@ void ThermoHydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
         eps.noalias() = B * u;
         auto C = _ip_data[ip].updateConstitutiveRelationThermal(
             t, x_position, dt, u,
-            _process_data.reference_temperature(t, x_position)[0],
+            _process_data.reference_temperature.scalarValue(t, x_position),
             thermal_strain);
 
         local_Jac
@@ -560,7 +561,8 @@ void ThermoHydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
                                           typename BMatricesType::BMatrixType>(
                 dNdx_u, N_u, x_coord, _is_axially_symmetric);
 
-        double const T0 = _process_data.reference_temperature(t, x_position)[0];
+        double const T0 =
+            _process_data.reference_temperature.scalarValue(t, x_position);
 
         double const T_int_pt = N_T * T;
         vars[static_cast<int>(MaterialPropertyLib::Variable::temperature)] =
@@ -583,7 +585,7 @@ void ThermoHydroMechanicsLocalAssembler<ShapeFunctionDisplacement,
 
         _ip_data[ip].updateConstitutiveRelationThermal(
             t, x_position, dt, u,
-            _process_data.reference_temperature(t, x_position)[0],
+            _process_data.reference_temperature.scalarValue(t, x_position),
             thermal_strain);
     }
 }
@@ -67,7 +67,8 @@ ThermoHydroMechanicsProcess<DisplacementDim>::getMatrixSpecifications(
     {
         auto const& l = *_local_to_global_index_map;
         return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-                &l.getGhostIndices(), &this->_sparsity_pattern};
+                &l.getGhostIndices(), &this->_sparsity_pattern,
+                this->getCompressedSparsityPattern()};
     }
 
     // For staggered scheme and T or H process (pressure).
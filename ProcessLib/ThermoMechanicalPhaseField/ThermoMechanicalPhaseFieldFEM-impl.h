@@ -120,10 +120,12 @@ void ThermoMechanicalPhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
 
         auto const& sigma = _ip_data[ip].sigma;
 
-        auto const k = _process_data.residual_stiffness(t, x_position)[0];
-        auto rho_sr = _process_data.solid_density(t, x_position)[0];
-        auto const alpha = _process_data.linear_thermal_expansion_coefficient(
-            t, x_position)[0];
+        auto const k =
+            _process_data.residual_stiffness.scalarValue(t, x_position);
+        auto rho_sr = _process_data.solid_density.scalarValue(t, x_position);
+        auto const alpha =
+            _process_data.linear_thermal_expansion_coefficient.scalarValue(
+                t, x_position);
         double const T0 = _process_data.reference_temperature;
         auto const& b = _process_data.specific_body_force;
 
@@ -212,14 +214,17 @@ void ThermoMechanicalPhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
         auto& eps_m = _ip_data[ip].eps_m;
         auto& heatflux = _ip_data[ip].heatflux;
 
-        auto rho_sr = _process_data.solid_density(t, x_position)[0];
-        auto const alpha = _process_data.linear_thermal_expansion_coefficient(
-            t, x_position)[0];
-        double const c = _process_data.specific_heat_capacity(t, x_position)[0];
+        auto rho_sr = _process_data.solid_density.scalarValue(t, x_position);
+        auto const alpha =
+            _process_data.linear_thermal_expansion_coefficient.scalarValue(
+                t, x_position);
+        double const c =
+            _process_data.specific_heat_capacity.scalarValue(t, x_position);
         auto const lambda =
-            _process_data.thermal_conductivity(t, x_position)[0];
+            _process_data.thermal_conductivity.scalarValue(t, x_position);
         auto const lambda_res =
-            _process_data.residual_thermal_conductivity(t, x_position)[0];
+            _process_data.residual_thermal_conductivity.scalarValue(
+                t, x_position);
         double const T0 = _process_data.reference_temperature;
 
         double const d_ip = N.dot(d);
@@ -306,8 +311,10 @@ void ThermoMechanicalPhaseFieldLocalAssembler<ShapeFunction, IntegrationMethod,
 
         auto const& strain_energy_tensile = _ip_data[ip].strain_energy_tensile;
 
-        auto const gc = _process_data.crack_resistance(t, x_position)[0];
-        auto const ls = _process_data.crack_length_scale(t, x_position)[0];
+        auto const gc =
+            _process_data.crack_resistance.scalarValue(t, x_position);
+        auto const ls =
+            _process_data.crack_length_scale.scalarValue(t, x_position);
 
         double const d_ip = N.dot(d);
 
@@ -66,7 +66,8 @@ ThermoMechanicalPhaseFieldProcess<DisplacementDim>::getMatrixSpecifications(
     {
         auto const& l = *_local_to_global_index_map;
         return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-                &l.getGhostIndices(), &this->_sparsity_pattern};
+                &l.getGhostIndices(), &this->_sparsity_pattern,
+                this->getCompressedSparsityPattern()};
     }
 
     // For staggered scheme and phase field process or heat conduction.
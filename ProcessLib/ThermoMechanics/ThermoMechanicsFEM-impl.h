@@ -71,7 +71,7 @@ ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         ParameterLib::SpatialPosition x_position;
         x_position.setElementID(_element.getID());
         ip_data.solid_density =
-            _process_data.reference_solid_density(0, x_position)[0];
+            _process_data.reference_solid_density.scalarValue(0, x_position);
         ip_data.solid_density_prev = ip_data.solid_density;
         ip_data.N = shape_matrices[ip].N;
         ip_data.dNdx = shape_matrices[ip].dNdx;
@@ -195,8 +195,9 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         double const dT = N.dot(T_dot) * dt;
         // calculate thermally induced strain
         // assume isotropic thermal expansion
-        auto const alpha = _process_data.linear_thermal_expansion_coefficient(
-            t, x_position)[0];
+        auto const alpha =
+            _process_data.linear_thermal_expansion_coefficient.scalarValue(
+                t, x_position);
         double const linear_thermal_strain_increment = alpha * dT;
 
         //
@@ -214,17 +215,14 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
             eps_m_prev + eps - eps_prev -
             linear_thermal_strain_increment * Invariants::identity2;
 
-        auto&& solution = _ip_data[ip].solid_material.integrateStress(
-            t, x_position, dt, eps_m_prev, eps_m, sigma_prev, *state, T_ip);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+        if (!_ip_data[ip].solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_m_prev, eps_m, sigma_prev, state, T_ip,
+                sigma, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
-
         local_Jac
             .template block<displacement_size, displacement_size>(
                 displacement_index, displacement_index)
@@ -277,10 +275,11 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         // temperature equation, temperature part;
         //
         auto const lambda =
-            _process_data.thermal_conductivity(t, x_position)[0];
+            _process_data.thermal_conductivity.scalarValue(t, x_position);
         KTT.noalias() += dNdx.transpose() * lambda * dNdx * w;
 
-        auto const c = _process_data.specific_heat_capacity(t, x_position)[0];
+        auto const c =
+            _process_data.specific_heat_capacity.scalarValue(t, x_position);
         DTT.noalias() += N.transpose() * rho_s * c * N * w;
     }
 
@@ -406,8 +405,9 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         double const dT_ip = T_ip - N.dot(local_T0);
         // calculate thermally induced strain
         // assume isotropic thermal expansion
-        auto const alpha = _process_data.linear_thermal_expansion_coefficient(
-            t, x_position)[0];
+        auto const alpha =
+            _process_data.linear_thermal_expansion_coefficient.scalarValue(
+                t, x_position);
         double const linear_thermal_strain_increment = alpha * dT_ip;
 
         //
@@ -424,17 +424,14 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
             eps_m_prev + eps - eps_prev -
             linear_thermal_strain_increment * Invariants::identity2;
 
-        auto&& solution = _ip_data[ip].solid_material.integrateStress(
-            t, x_position, dt, eps_m_prev, eps_m, sigma_prev, *state, T_ip);
-
-        if (!solution)
+        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
+        if (!_ip_data[ip].solid_material.integrateStressInPlace(
+                t, x_position, dt, eps_m_prev, eps_m, sigma_prev, state, T_ip,
+                sigma, C))
         {
             OGS_FATAL("Computation of local constitutive relation failed.");
         }
 
-        MathLib::KelvinVector::KelvinMatrixType<DisplacementDim> C;
-        std::tie(sigma, state, C) = std::move(*solution);
-
         local_Jac.noalias() += B.transpose() * C * B * w;
 
         typename ShapeMatricesType::template MatrixType<DisplacementDim,
@@ -528,18 +525,20 @@ void ThermoMechanicsLocalAssembler<ShapeFunction, IntegrationMethod,
         auto& rho_s = _ip_data[ip].solid_density;
         // calculate thermally induced strain
         // assume isotropic thermal expansion
-        auto const alpha = _process_data.linear_thermal_expansion_coefficient(
-            t, x_position)[0];
+        auto const alpha =
+            _process_data.linear_thermal_expansion_coefficient.scalarValue(
+                t, x_position);
 
         double const dT_ip = N.dot(local_dT);
         double const linear_thermal_strain_increment = alpha * dT_ip;
         rho_s = _ip_data[ip].solid_density_prev /
                 (1 + 3 * linear_thermal_strain_increment);
-        auto const c_p = _process_data.specific_heat_capacity(t, x_position)[0];
+        auto const c_p =
+            _process_data.specific_heat_capacity.scalarValue(t, x_position);
         mass.noalias() += N.transpose() * rho_s * c_p * N * w;
 
         auto const lambda =
-            _process_data.thermal_conductivity(t, x_position)[0];
+            _process_data.thermal_conductivity.scalarValue(t, x_position);
         laplace.noalias() += dNdx.transpose() * lambda * dNdx * w;
     }
     local_Jac.noalias() += laplace + mass / dt;
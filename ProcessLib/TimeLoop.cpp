@@ -10,7 +10,13 @@
 
 #include "TimeLoop.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
 #include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
 #include "BaseLib/RunTime.h"
 #include "ChemistryLib/ChemicalSolverInterface.h"
 #include "MathLib/LinAlg/LinAlg.h"
@@ -19,6 +25,7 @@
 #include "ProcessLib/CreateProcessData.h"
 #include "ProcessLib/Output/CreateOutput.h"
 
+#include "Checkpoint.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "ProcessData.h"
 
@@ -214,6 +221,7 @@ TimeLoop::TimeLoop(
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
         global_coupling_conv_crit,
     std::unique_ptr<ChemistryLib::ChemicalSolverInterface>&& chemical_system,
+    std::unique_ptr<CheckpointControl>&& checkpoint_control,
     const double start_time, const double end_time)
     : _output(std::move(output)),
       _per_process_data(std::move(per_process_data)),
@@ -221,7 +229,8 @@ TimeLoop::TimeLoop(
       _end_time(end_time),
       _global_coupling_max_iterations(global_coupling_max_iterations),
       _global_coupling_conv_crit(std::move(global_coupling_conv_crit)),
-      _chemical_system(std::move(chemical_system))
+      _chemical_system(std::move(chemical_system)),
+      _checkpoint_control(std::move(checkpoint_control))
 {
 }
 
@@ -381,12 +390,28 @@ double TimeLoop::computeTimeStepping(const double prev_dt, double& t,
 }
 
 /// initialize output, convergence criterion, etc.
-void TimeLoop::initialize()
+void TimeLoop::initialize(std::string const& restart_file_name)
 {
+    // Unsupported setups are rejected here instead of at the first checkpoint.
+    bool const uses_checkpoints =
+        _checkpoint_control != nullptr || !restart_file_name.empty();
+    if (uses_checkpoints && _chemical_system != nullptr)
+    {
+        OGS_FATAL(
+            "Checkpoints do not contain the state of the chemical solver.");
+    }
+
     int process_id = 0;
     for (auto& process_data : _per_process_data)
     {
         auto& pcs = process_data->process;
+        if (uses_checkpoints && !pcs.isCheckpointSupported())
+        {
+            OGS_FATAL(
+                "Process '%s' does not support checkpoints; its integration "
+                "point data would not be stored.",
+                pcs.name.c_str());
+        }
         _output->addProcess(pcs, process_id);
 
         process_data->process_id = process_id;
@@ -421,13 +446,159 @@ void TimeLoop::initialize()
         setCoupledSolutions();
     }
 
+    if (!restart_file_name.empty())
+    {
+        readCheckpoint(getCheckpointFileNameOfRank(restart_file_name));
+        return;
+    }
+
     // Output initial conditions
     {
         const bool output_initial_condition = true;
         outputSolutions(output_initial_condition, 0, _start_time, *_output,
                         &Output::doOutput);
     }
+}
+
+void TimeLoop::writeCheckpoint(std::string const& file_name, double const t,
+                               double const dt,
+                               std::size_t const accepted_steps,
+                               std::size_t const rejected_steps) const
+{
+    BaseLib::RunTime time_checkpoint;
+    time_checkpoint.start();
+
+    // A temporary file is renamed after it is complete, s.t. the previous
+    // checkpoint remains usable if the program is killed while writing.
+    auto const tmp_file_name = file_name + ".tmp";
+    {
+        std::ofstream os(tmp_file_name, std::ios::binary);
+        if (!os)
+        {
+            OGS_FATAL("Could not open the checkpoint file '%s' for writing.",
+                      tmp_file_name.c_str());
+        }
+
+        writeCheckpointHeader(os);
+        BaseLib::writeValueBinary(
+            os, static_cast<std::uint32_t>(_per_process_data.size()));
+        BaseLib::writeValueBinary(os, t);
+        BaseLib::writeValueBinary(os, dt);
+        BaseLib::writeValueBinary(os,
+                                  static_cast<std::uint64_t>(accepted_steps));
+        BaseLib::writeValueBinary(os,
+                                  static_cast<std::uint64_t>(rejected_steps));
+
+        std::vector<Process const*> written_processes;
+        for (std::size_t i = 0; i < _per_process_data.size(); i++)
+        {
+            auto const& ppd = *_per_process_data[i];
+            BaseLib::writeValueBinary(
+                os, static_cast<std::int32_t>(
+                        ppd.nonlinear_solver_status.number_iterations));
+            MathLib::LinAlg::writeBinary(os, *_process_solutions[i]);
+            ppd.time_disc->writeCheckpoint(os);
+            ppd.timestepper->writeCheckpoint(os);
+            _output->writeCheckpoint(os, ppd.process, i);
+
+            // The processes of a staggered scheme share one Process object.
+            if (std::find(written_processes.begin(), written_processes.end(),
+                          &ppd.process) == written_processes.end())
+            {
+                ppd.process.writeCheckpoint(os);
+                written_processes.push_back(&ppd.process);
+            }
+        }
+
+        if (!os)
+        {
+            OGS_FATAL("Could not write the checkpoint file '%s'.",
+                      tmp_file_name.c_str());
+        }
+    }
+    if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+    {
+        OGS_FATAL("Could not rename the checkpoint file '%s' to '%s'.",
+                  tmp_file_name.c_str(), file_name.c_str());
+    }
+
+    INFO("[time] Writing checkpoint '%s' at time %g took %g s.",
+         file_name.c_str(), t, time_checkpoint.elapsed());
+}
+
+void TimeLoop::readCheckpoint(std::string const& file_name)
+{
+    std::ifstream is(file_name, std::ios::binary);
+    if (!is)
+    {
+        OGS_FATAL("Could not open the checkpoint file '%s'.",
+                  file_name.c_str());
+    }
+
+    readCheckpointHeader(is, file_name);
+    auto const n_processes = BaseLib::readBinaryValue<std::uint32_t>(is);
+    if (n_processes != _per_process_data.size())
+    {
+        OGS_FATAL(
+            "The checkpoint '%s' contains %d processes, but %d are "
+            "configured.",
+            file_name.c_str(), n_processes, _per_process_data.size());
+    }
+
+    TimeSteppingState state;
+    state.t = BaseLib::readBinaryValue<double>(is);
+    state.dt = BaseLib::readBinaryValue<double>(is);
+    state.accepted_steps = BaseLib::readBinaryValue<std::uint64_t>(is);
+    state.rejected_steps = BaseLib::readBinaryValue<std::uint64_t>(is);
+
+    std::vector<Process*> read_processes;
+    for (std::size_t i = 0; i < _per_process_data.size(); i++)
+    {
+        auto& ppd = *_per_process_data[i];
+        // Checkpoints are only written after accepted time steps.
+        ppd.nonlinear_solver_status.error_norms_met = true;
+        ppd.nonlinear_solver_status.number_iterations =
+            BaseLib::readBinaryValue<std::int32_t>(is);
+
+        auto& x = *_process_solutions[i];
+        MathLib::LinAlg::readBinary(is, x);
+        MathLib::LinAlg::setLocalAccessibleVector(x);
+        ppd.time_disc->readCheckpoint(is);
+        ppd.timestepper->readCheckpoint(is);
+        _output->readCheckpoint(is, ppd.process, i);
+
+        if (std::find(read_processes.begin(), read_processes.end(),
+                      &ppd.process) == read_processes.end())
+        {
+            ppd.process.readCheckpoint(is);
+            read_processes.push_back(&ppd.process);
+        }
+
+        if (i < _solutions_of_last_cpl_iteration.size())
+        {
+            MathLib::LinAlg::copy(x, *_solutions_of_last_cpl_iteration[i]);
+        }
+
+        // The internal matrices of the Crank-Nicolson scheme are not stored
+        // but assembled again for the restored solution.
+        if (ppd.time_disc->needsPreload())
+        {
+            setEquationSystem(ppd.nonlinear_solver, *ppd.tdisc_ode_sys,
+                              *ppd.conv_crit, ppd.nonlinear_solver_tag);
+            ppd.nonlinear_solver.assemble(x);
+            ppd.time_disc->pushState(state.t, x, *ppd.mat_strg);
+        }
+    }
+
+    if (!is)
+    {
+        OGS_FATAL("Could not read the checkpoint file '%s'.",
+                  file_name.c_str());
+    }
 
+    _restart_state = state;
+    INFO("Restarting from checkpoint '%s' at time %g after %u time steps.",
+         file_name.c_str(), state.t, state.accepted_steps);
 }
 
 /*
@@ -449,7 +620,19 @@ bool TimeLoop::loop()
     std::size_t rejected_steps = 0;
     NumLib::NonlinearSolverStatus nonlinear_solver_status;
 
-    double dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+    double dt;
+    if (_restart_state)
+    {
+        t = _restart_state->t;
+        dt = _restart_state->dt;
+        accepted_steps = _restart_state->accepted_steps;
+        rejected_steps = _restart_state->rejected_steps;
+        nonlinear_solver_status.error_norms_met = true;
+    }
+    else
+    {
+        dt = computeTimeStepping(0.0, t, accepted_steps, rejected_steps);
+    }
 
     while (t < _end_time)
     {
@@ -509,6 +692,14 @@ bool TimeLoop::loop()
                 dt, timesteps, t);
             break;
         }
+
+        if (_checkpoint_control && !_last_step_rejected &&
+            _checkpoint_control->isCheckpointDue(accepted_steps))
+        {
+            writeCheckpoint(_checkpoint_control->getFileName(), t, dt,
+                            accepted_steps, rejected_steps);
+            _checkpoint_control->checkpointWritten();
+        }
     }
 
     INFO(
@@ -616,6 +807,7 @@ NumLib::NonlinearSolverStatus TimeLoop::solveUncoupledEquationSystems(
                     process_data->process, process_data->process_id,
                     timestep_id, t,
                     *_process_solutions[process_data->process_id]);
+                _output->flush();
                 OGS_FATAL(nonlinear_fixed_dt_fails_info.data());
             }
 
@@ -696,6 +888,7 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                     // save unsuccessful solution
                     _output->doOutputAlways(process_data->process, process_id,
                                             timestep_id, t, x);
+                    _output->flush();
                     OGS_FATAL(nonlinear_fixed_dt_fails_info.data());
                 }
                 break;
@@ -11,8 +11,11 @@
 #pragma once
 
 #include <functional>
+#include <iosfwd>
 #include <memory>
 
+#include <boost/optional.hpp>
+
 #include <logog/include/logog.hpp>
 
 #include "NumLib/ODESolver/NonlinearSolver.h"
@@ -33,6 +36,7 @@ class ChemicalSolverInterface;
 
 namespace ProcessLib
 {
+class CheckpointControl;
 struct ProcessData;
 
 /// Time loop capable of time-integrating several processes at once.
@@ -46,9 +50,13 @@ public:
                  global_coupling_conv_crit,
              std::unique_ptr<ChemistryLib::ChemicalSolverInterface>&&
                  chemical_system,
+             std::unique_ptr<CheckpointControl>&& checkpoint_control,
              const double start_time, const double end_time);
 
-    void initialize();
+    /// Sets the initial conditions and writes them as output. If a
+    /// \c restart_file_name is given, the state of the simulation is instead
+    /// restored from that checkpoint and loop() continues from there.
+    void initialize(std::string const& restart_file_name = "");
     bool loop();
 
     ~TimeLoop();
@@ -104,6 +112,17 @@ private:
                                std::size_t& accepted_steps,
                                std::size_t& rejected_steps);
 
+    /// Writes the complete state of the time loop, i.e., the time stepping
+    /// state, the solutions and the internal states of the time
+    /// discretizations, time steppers, processes and output to the given file.
+    void writeCheckpoint(std::string const& file_name, double const t,
+                         double const dt, std::size_t const accepted_steps,
+                         std::size_t const rejected_steps) const;
+
+    /// Restores the state written by writeCheckpoint(). Must be called after
+    /// the initial conditions have been set.
+    void readCheckpoint(std::string const& file_name);
+
     template <typename OutputClass, typename OutputClassMember>
     void outputSolutions(bool const output_initial_condition, unsigned timestep,
                          const double t, OutputClass& output_object,
@@ -126,6 +145,18 @@ private:
         _global_coupling_conv_crit;
 
     std::unique_ptr<ChemistryLib::ChemicalSolverInterface> _chemical_system;
+
+    std::unique_ptr<CheckpointControl> _checkpoint_control;
+
+    /// Time stepping state read from a checkpoint, from which loop() starts.
+    struct TimeSteppingState
+    {
+        double t;
+        double dt;
+        std::size_t accepted_steps;
+        std::size_t rejected_steps;
+    };
+    boost::optional<TimeSteppingState> _restart_state;
     /**
      *  Vector of solutions of the coupled processes.
      *  Each vector element stores the references of the solution vectors
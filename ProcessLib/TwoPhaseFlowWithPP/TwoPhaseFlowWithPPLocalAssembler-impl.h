@@ -121,7 +121,8 @@ void TwoPhaseFlowWithPPLocalAssembler<
 
         _pressure_wet[ip] = pn_int_pt - pc_int_pt;
 
-        const double temperature = _process_data.temperature(t, pos)[0];
+        const double temperature =
+            _process_data.temperature.scalarValue(t, pos);
         double const rho_nonwet =
             _process_data.material->getGasDensity(pn_int_pt, temperature);
         double const rho_wet = _process_data.material->getLiquidDensity(
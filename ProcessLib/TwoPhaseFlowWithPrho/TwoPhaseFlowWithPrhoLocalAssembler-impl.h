@@ -107,7 +107,8 @@ void TwoPhaseFlowWithPrhoLocalAssembler<
         NumLib::shapeFunctionInterpolate(local_x, sm.N, pl_int_pt,
                                          totalrho_int_pt);
 
-        const double temperature = _process_data._temperature(t, pos)[0];
+        const double temperature =
+            _process_data._temperature.scalarValue(t, pos);
 
         double const rho_gas =
             _process_data._material->getGasDensity(pl_int_pt, temperature);
@@ -167,7 +168,7 @@ void TwoPhaseFlowWithPrhoLocalAssembler<
             _pressure_nonwetting[ip], temperature);
         double const lambda_gas = k_rel_gas / mu_gas;
         double const diffusion_coeff_component_h2 =
-            _process_data._diffusion_coeff_component_b(t, pos)[0];
+            _process_data._diffusion_coeff_component_b.scalarValue(t, pos);
 
         // wet
         double const k_rel_wet =
@@ -13,6 +13,7 @@
 #include <cassert>
 #include <functional>  // for std::reference_wrapper.
 
+#include "BaseLib/RunTime.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "LocalAssemblerInterface.h"
@@ -20,6 +21,17 @@
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "Process.h"
 
+namespace
+{
+// Temporary data only stored here in order to avoid frequent memory
+// reallocations. The buffers are thread-local, because the assemble methods
+// might run concurrently, see NumLib::ParallelExecutor.
+thread_local std::vector<double> local_M_data;
+thread_local std::vector<double> local_K_data;
+thread_local std::vector<double> local_b_data;
+thread_local std::vector<double> local_Jac_data;
+}  // namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
@@ -33,7 +45,7 @@ void VectorMatrixAssembler::preAssemble(
     const NumLib::LocalToGlobalIndexMap& dof_table, const double t,
     double const dt, const GlobalVector& x)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    auto const& indices = NumLib::getIndices(mesh_item_id, dof_table);
     auto const local_x = x.get(indices);
 
     local_assembler.preAssemble(t, dt, local_x);
@@ -47,26 +59,32 @@ void VectorMatrixAssembler::assemble(
     GlobalMatrix& K, GlobalVector& b,
     CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
+    // The indices of all processes are only needed for the staggered scheme;
+    // otherwise the indices stored in the DOF table are used without a copy.
     std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    for (auto dof_table : dof_tables)
+    if (cpl_xs != nullptr)
     {
-        indices_of_processes.emplace_back(
-            NumLib::getIndices(mesh_item_id, dof_table.get()));
+        indices_of_processes.reserve(dof_tables.size());
+        for (auto dof_table : dof_tables)
+        {
+            indices_of_processes.emplace_back(
+                NumLib::getIndices(mesh_item_id, dof_table.get()));
+        }
     }
 
-    auto const& indices = (cpl_xs == nullptr)
-                              ? indices_of_processes[0]
-                              : indices_of_processes[cpl_xs->process_id];
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
+    auto const& indices =
+        (cpl_xs == nullptr)
+            ? NumLib::getIndices(mesh_item_id, dof_tables[0].get())
+            : indices_of_processes[cpl_xs->process_id];
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
 
     if (cpl_xs == nullptr)
     {
         auto const local_x = x.get(indices);
-        local_assembler.assemble(t, dt, local_x, _local_M_data, _local_K_data,
-                                 _local_b_data);
+        local_assembler.assemble(t, dt, local_x, local_M_data, local_K_data,
+                                 local_b_data);
     }
     else
     {
@@ -79,8 +97,8 @@ void VectorMatrixAssembler::assemble(
             cpl_xs->process_id, std::move(local_coupled_xs0),
             std::move(local_coupled_xs));
 
-        local_assembler.assembleForStaggeredScheme(t, dt, _local_M_data,
-                                                   _local_K_data, _local_b_data,
+        local_assembler.assembleForStaggeredScheme(t, dt, local_M_data,
+                                                   local_K_data, local_b_data,
                                                    local_coupled_solutions);
     }
 
@@ -88,21 +106,30 @@ void VectorMatrixAssembler::assemble(
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
-    {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty())
-    {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty())
-    {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
-    }
+    GlobalExecutor::scatter([&]() {
+        BaseLib::RunTime time_scatter;
+        time_scatter.start();
+
+        if (!local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            addToGlobalMatrix(mesh_item_id, r_c_indices, local_M, M);
+        }
+        if (!local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            addToGlobalMatrix(mesh_item_id, r_c_indices, local_K, K);
+        }
+        if (!local_b_data.empty())
+        {
+            assert(local_b_data.size() == num_r_c);
+            b.add(indices, local_b_data);
+        }
+
+        _scatter_time += time_scatter.elapsed();
+    });
 }
 
 void VectorMatrixAssembler::assembleWithJacobian(
@@ -114,30 +141,36 @@ void VectorMatrixAssembler::assembleWithJacobian(
     GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
     CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
+    // The indices of all processes are only needed for the staggered scheme;
+    // otherwise the indices stored in the DOF table are used without a copy.
     std::vector<std::vector<GlobalIndexType>> indices_of_processes;
-    indices_of_processes.reserve(dof_tables.size());
-    for (auto dof_table : dof_tables)
+    if (cpl_xs != nullptr)
     {
-        indices_of_processes.emplace_back(
-            NumLib::getIndices(mesh_item_id, dof_table.get()));
+        indices_of_processes.reserve(dof_tables.size());
+        for (auto dof_table : dof_tables)
+        {
+            indices_of_processes.emplace_back(
+                NumLib::getIndices(mesh_item_id, dof_table.get()));
+        }
     }
 
-    auto const& indices = (cpl_xs == nullptr)
-                              ? indices_of_processes[0]
-                              : indices_of_processes[cpl_xs->process_id];
+    auto const& indices =
+        (cpl_xs == nullptr)
+            ? NumLib::getIndices(mesh_item_id, dof_tables[0].get())
+            : indices_of_processes[cpl_xs->process_id];
     auto const local_xdot = xdot.get(indices);
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
+    local_Jac_data.clear();
 
     if (cpl_xs == nullptr)
     {
         auto const local_x = x.get(indices);
         _jacobian_assembler->assembleWithJacobian(
             local_assembler, t, dt, local_x, local_xdot, dxdot_dx, dx_dx,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data);
+            local_M_data, local_K_data, local_b_data, local_Jac_data);
     }
     else
     {
@@ -151,8 +184,8 @@ void VectorMatrixAssembler::assembleWithJacobian(
             std::move(local_coupled_xs));
 
         _jacobian_assembler->assembleWithJacobianForStaggeredScheme(
-            local_assembler, t, dt, local_xdot, dxdot_dx, dx_dx, _local_M_data,
-            _local_K_data, _local_b_data, _local_Jac_data,
+            local_assembler, t, dt, local_xdot, dxdot_dx, dx_dx, local_M_data,
+            local_K_data, local_b_data, local_Jac_data,
             local_coupled_solutions);
     }
 
@@ -160,33 +193,66 @@ void VectorMatrixAssembler::assembleWithJacobian(
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
-    {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty())
-    {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty())
-    {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
-    }
-    if (!_local_Jac_data.empty())
-    {
-        auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
-    }
-    else
+    if (local_Jac_data.empty())
     {
         OGS_FATAL(
             "No Jacobian has been assembled! This might be due to programming "
             "errors in the local assembler of the current process.");
     }
+
+    if (_residual_only_assembly &&
+        !(local_M_data.empty() && local_K_data.empty()))
+    {
+        // b - M * xdot - K * x
+        local_b_data.resize(num_r_c, 0.0);
+        auto local_b = MathLib::toVector(local_b_data);
+        if (!local_M_data.empty())
+        {
+            local_b.noalias() -=
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c) *
+                MathLib::toVector(local_xdot);
+            local_M_data.clear();
+        }
+        if (!local_K_data.empty())
+        {
+            auto const local_x = x.get(indices);
+            local_b.noalias() -=
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c) *
+                MathLib::toVector(local_x);
+            local_K_data.clear();
+        }
+    }
+
+    GlobalExecutor::scatter([&]() {
+        BaseLib::RunTime time_scatter;
+        time_scatter.start();
+
+        if (!local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            addToGlobalMatrix(mesh_item_id, r_c_indices, local_M, M);
+        }
+        if (!local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            addToGlobalMatrix(mesh_item_id, r_c_indices, local_K, K);
+        }
+        if (!local_b_data.empty())
+        {
+            assert(local_b_data.size() == num_r_c);
+            b.add(indices, local_b_data);
+        }
+        if (_jacobian_assembly)
+        {
+            auto const local_Jac =
+                MathLib::toMatrix(local_Jac_data, num_r_c, num_r_c);
+            addToGlobalMatrix(mesh_item_id, r_c_indices, local_Jac, Jac);
+        }
+
+        _scatter_time += time_scatter.elapsed();
+    });
 }
 
 }  // namespace ProcessLib
@@ -11,15 +11,11 @@
 #pragma once
 
 #include <vector>
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/NumericsConfig.h"
 #include "AbstractJacobianAssembler.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 
-namespace NumLib
-{
-class LocalToGlobalIndexMap;
-}  // NumLib
-
 namespace ProcessLib
 {
 struct CoupledSolutionsForStaggeredScheme;
@@ -30,6 +26,11 @@ class LocalAssemblerInterface;
 //!
 //! The methods of this class get the global matrices and vectors as input and
 //! pass only local data on to the local assemblers.
+//!
+//! The assemble methods may be called concurrently for different local
+//! assemblers by the GlobalExecutor. The local data is therefore kept in
+//! thread-local buffers, and the global matrices and vectors are only modified
+//! inside GlobalExecutor::scatter().
 class VectorMatrixAssembler final
 {
 public:
@@ -64,13 +65,67 @@ public:
         GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
         CoupledSolutionsForStaggeredScheme const* const cpl_xs);
 
+    //! Switches adding the local matrices to the global ones via cached value
+    //! offsets on or off, see MathLib::EigenMatrix::add(item_id, ...).
+    //! The cache trades memory (one offset per local matrix entry and global
+    //! matrix) for avoiding the search of each entry in the sparsity pattern.
+    void setCachedScatter(bool const cached_scatter)
+    {
+        _cached_scatter = cached_scatter;
+    }
+
+    //! Switches the residual-only mode of assembleWithJacobian() on or off. In
+    //! this mode the local \c M and \c K are multiplied by the local \c xdot
+    //! and \c x, and the products are subtracted from the local \c b. Only
+    //! the resulting negative residual and the Jacobian are added to the
+    //! global \c b and \c Jac; the global \c M and \c K are not accessed.
+    void setResidualOnlyAssembly(bool const residual_only_assembly)
+    {
+        _residual_only_assembly = residual_only_assembly;
+    }
+
+    //! Switches adding the local Jacobians to the global one in
+    //! assembleWithJacobian() on or off. The local Jacobians are computed
+    //! nevertheless.
+    void setJacobianAssembly(bool const jacobian_assembly)
+    {
+        _jacobian_assembly = jacobian_assembly;
+    }
+
+    //! Returns the time spent adding local to global matrices and vectors since
+    //! the last call of resetScatterTime().
+    double getScatterTime() const { return _scatter_time; }
+
+    void resetScatterTime() { _scatter_time = 0.0; }
+
 private:
-    // temporary data only stored here in order to avoid frequent memory
-    // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
+    //! Adds the local matrix to the global one, using the cached value offsets
+    //! if enabled.
+    template <typename LocalMatrix>
+    void addToGlobalMatrix(
+        std::size_t const mesh_item_id,
+        NumLib::LocalToGlobalIndexMap::RowColumnIndices const& r_c_indices,
+        LocalMatrix const& local_matrix, GlobalMatrix& global_matrix) const
+    {
+        if (_cached_scatter)
+        {
+            global_matrix.add(mesh_item_id, r_c_indices, local_matrix);
+        }
+        else
+        {
+            global_matrix.add(r_c_indices, local_matrix);
+        }
+    }
+
+    bool _cached_scatter = false;
+
+    bool _residual_only_assembly = false;
+
+    bool _jacobian_assembly = true;
+
+    //! Accumulated time of the scatter sections. Those are executed mutually
+    //! exclusive, therefore no synchronization is needed.
+    double _scatter_time = 0.0;
 
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
@@ -0,0 +1,38 @@
+import OpenGeoSys
+import numpy as np
+from math import pi, sin, cos, sinh, cosh
+
+a = 2.0*pi/3.0
+
+# analytical solution used to set the Dirichlet BCs
+def solution(x, y):
+    return np.sin(a*x) * np.sinh(a*y)
+
+# gradient of the analytical solution used to set the Neumann BCs
+def grad_solution(x, y):
+    return a * cos(a*x) * sinh(a*y), \
+            a * sin(a*x) * cosh(a*y)
+
+# Dirichlet BCs, the values of all nodes of a boundary are computed at once
+class BCDirichletBatched(OpenGeoSys.BoundaryCondition):
+    def getDirichletBCValues(self, t, coords, node_ids, primary_vars):
+        x, y = coords[:, 0], coords[:, 1]
+        assert (coords[:, 2] == 0.0).all()
+        is_dirichlet = np.full(len(node_ids), True)
+        return (is_dirichlet, solution(x, y))
+
+# Neumann BC
+class BCRight(OpenGeoSys.BoundaryCondition):
+    def getFlux(self, t, coords, primary_vars):
+        x, y, z = coords
+        assert x == 1.0 and z == 0.0
+        value = grad_solution(x, y)[0]
+        Jac = [ 0.0 ]  # value does not depend on primary variable
+        return (True, value, Jac)
+
+
+# instantiate BC objects referenced in OpenGeoSys' prj file
+bc_top = BCDirichletBatched()
+bc_right = BCRight()
+bc_bottom = BCDirichletBatched()
+bc_left = BCDirichletBatched()
@@ -0,0 +1,25 @@
+import OpenGeoSys
+import numpy as np
+from math import pi
+
+a = 2.0*pi
+b = 2.0*pi
+
+def solution(x, y):
+    return np.sin(a*x-pi/2.0) * np.sin(b*y-pi/2.0)
+
+# - laplace(solution) = source term
+def laplace_solution(x, y):
+    return (a*a + b*b) * solution(x, y)
+
+# source term for the benchmark, the fluxes at all integration points are
+# computed at once
+class SinXSinYSourceTermBatched(OpenGeoSys.SourceTerm):
+    def getFluxes(self, t, coords, primary_vars):
+        x, y = coords[:, 0], coords[:, 1]
+        values = laplace_solution(x, y)
+        Jac = np.zeros(primary_vars.shape)
+        return (values, Jac)
+
+# instantiate source term object referenced in OpenGeoSys' prj file
+sinx_siny_source_term = SinXSinYSourceTermBatched()
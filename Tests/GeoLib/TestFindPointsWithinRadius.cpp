@@ -0,0 +1,98 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "GeoLib/findPointsWithinRadius.h"
+#include "MathLib/MathTools.h"
+
+namespace
+{
+// Compares the neighbourhoods with a search over all pairs of points.
+void checkNeighbourhoods(std::vector<MathLib::Point3d> const& points,
+                         double const radius_squared)
+{
+    auto const neighbourhoods =
+        GeoLib::findPointsWithinRadius(points, radius_squared);
+    ASSERT_EQ(points.size() + 1, neighbourhoods.offsets.size());
+    ASSERT_EQ(neighbourhoods.offsets.back(), neighbourhoods.indices.size());
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        std::vector<std::size_t> expected;
+        for (std::size_t j = 0; j < points.size(); ++j)
+        {
+            if (MathLib::sqrDist(points[i], points[j]) < radius_squared)
+            {
+                expected.push_back(j);
+            }
+        }
+
+        auto const begin = neighbourhoods.offsets[i];
+        auto const end = neighbourhoods.offsets[i + 1];
+        std::vector<std::size_t> found(neighbourhoods.indices.begin() + begin,
+                                       neighbourhoods.indices.begin() + end);
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(expected, found);
+
+        for (auto k = begin; k < end; ++k)
+        {
+            EXPECT_DOUBLE_EQ(
+                MathLib::sqrDist(points[i],
+                                 points[neighbourhoods.indices[k]]),
+                neighbourhoods.squared_distances[k]);
+        }
+    }
+}
+}  // namespace
+
+TEST(GeoLib, FindPointsWithinRadius3D)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 2.0);
+    std::vector<MathLib::Point3d> points;
+    for (int i = 0; i < 2000; ++i)
+    {
+        points.emplace_back(std::array<double, 3>{{distribution(generator),
+                                                   distribution(generator),
+                                                   distribution(generator)}});
+    }
+
+    for (double const radius : {0.05, 0.3, 5.0})
+    {
+        checkNeighbourhoods(points, radius * radius);
+    }
+}
+
+TEST(GeoLib, FindPointsWithinRadiusPlanar)
+{
+    // Integration points of a regular quad mesh in the xy-plane.
+    std::vector<MathLib::Point3d> points;
+    for (int i = 0; i < 40; ++i)
+    {
+        for (int j = 0; j < 30; ++j)
+        {
+            points.emplace_back(
+                std::array<double, 3>{{0.1 * i + 0.02, 0.1 * j + 0.07, 0.0}});
+        }
+    }
+
+    for (double const radius : {0.1, 0.25})
+    {
+        checkNeighbourhoods(points, radius * radius);
+    }
+
+    // Without a radius only the point itself is found.
+    EXPECT_EQ(0u,
+              GeoLib::findPointsWithinRadius(points, 0.0).indices.size());
+}
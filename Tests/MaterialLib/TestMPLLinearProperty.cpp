@@ -46,5 +46,18 @@ TEST(MaterialPropertyLib, LinearProperty)
                   variable_array, MaterialPropertyLib::Variable::temperature,
                   MaterialPropertyLib::Variable::temperature, pos, time)),
               0.0);
+
+    // The scalar fast path yields the same values.
+    ASSERT_EQ(
+        linear_property.scalarValue(variable_array, pos, time),
+        std::get<double>(linear_property.value(variable_array, pos, time)));
+    ASSERT_EQ(linear_property.scalarDValue(
+                  variable_array, MaterialPropertyLib::Variable::phase_pressure,
+                  pos, time),
+              0.0);
+    ASSERT_EQ(linear_property.scalarDValue(
+                  variable_array, MaterialPropertyLib::Variable::temperature,
+                  pos, time),
+              y_ref * m);
 }
 
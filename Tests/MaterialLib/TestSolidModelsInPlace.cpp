@@ -0,0 +1,292 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/RunTime.h"
+#include "MaterialLib/SolidModels/CreepBGRa.h"
+#include "MaterialLib/SolidModels/Ehlers.h"
+#include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
+#include "MaterialLib/SolidModels/Lubby2.h"
+#include "ParameterLib/ConstantParameter.h"
+
+namespace
+{
+constexpr int Dim = 3;
+using MechanicsBase = MaterialLib::Solids::MechanicsBase<Dim>;
+using KelvinVector = MathLib::KelvinVector::KelvinVectorType<Dim>;
+using KelvinMatrix = MathLib::KelvinVector::KelvinMatrixType<Dim>;
+using P = ParameterLib::ConstantParameter<double>;
+
+// Parameters of the benchmarks of the respective models.
+struct SolidModels
+{
+    P const E{"", 25000};
+    P const nu{"", 0.27};
+    MaterialLib::Solids::LinearElasticIsotropic<Dim>::MaterialProperties const
+        linear_elastic_properties{E, nu};
+
+    P const A{"", 0.18};
+    P const n{"", 5};
+    P const sigma_f{"", 1};
+    P const Q{"", 54000};
+
+    P const GK0{"", 0.8};
+    P const GM0{"", 0.8};
+    P const KM0{"", 0.8};
+    P const eta0{"", 0.5};
+    P const mK{"", -0.2};
+    P const mvM{"", -0.3};
+    MaterialLib::Solids::Lubby2::Lubby2MaterialProperties lubby2_properties{
+        GK0, GM0, KM0, eta0, eta0, mK, mK, mvM};
+
+    P const G{"", 150};
+    P const K{"", 200};
+    P const alpha{"", 0.01};
+    P const beta{"", 0.095};
+    P const one{"", 1};
+    P const delta{"", 0.0078};
+    P const epsilon{"", 0.1};
+    P const m{"", 0.54};
+    P const beta_p{"", 0.0608};
+    P const kappa{"", 0.1};
+    P const zero{"", 0};
+    MaterialLib::Solids::Ehlers::MaterialPropertiesParameters const
+        ehlers_properties{G, K, alpha, beta, one, delta, epsilon, m, alpha,
+                          beta_p, one, delta, epsilon, m, kappa, zero};
+
+    std::unique_ptr<MechanicsBase> create(int const i)
+    {
+        switch (i)
+        {
+            case 0:
+                return std::make_unique<
+                    MaterialLib::Solids::LinearElasticIsotropic<Dim>>(
+                    linear_elastic_properties);
+            case 1:
+                return std::make_unique<MaterialLib::Solids::Creep::CreepBGRa<
+                    Dim>>(linear_elastic_properties,
+                          NumLib::NewtonRaphsonSolverParameters{1000, 1e-8}, A,
+                          n, sigma_f, Q);
+            case 2:
+                return std::make_unique<
+                    MaterialLib::Solids::Lubby2::Lubby2<Dim>>(
+                    NumLib::NewtonRaphsonSolverParameters{20, 1e-10},
+                    lubby2_properties);
+            case 3:
+                return std::make_unique<
+                    MaterialLib::Solids::Ehlers::SolidEhlers<Dim>>(
+                    NumLib::NewtonRaphsonSolverParameters{100, 1e-14},
+                    ehlers_properties, nullptr,
+                    MaterialLib::Solids::Ehlers::TangentType::Plastic);
+        }
+        return nullptr;
+    }
+};
+
+int const number_of_models = 4;
+double const T = 273.15;
+
+// Triaxial compression with increasing axial strain, which leads to plastic
+// deformation of the Ehlers model in the last steps.
+KelvinVector strain(int const step)
+{
+    KelvinVector eps = KelvinVector::Zero();
+    if (step > 0)
+    {
+        eps.head<3>() << -1.2e-4, -1.1e-4, -1e-4;
+        eps[0] -= step * 2e-4;
+    }
+    return eps;
+}
+
+struct Reference
+{
+    std::array<double, 3> sigma;  // The shear stresses are zero.
+    std::array<double, 6> C_diagonal;
+};
+
+// Stresses and tangent diagonals in the load steps 1 to 5 computed by
+// integrateStress() before the in-place variant was introduced.
+std::array<std::array<Reference, 5>, number_of_models> const references{{
+     // LinearElasticIsotropic
+     {{{{{-12.4229715850736, -8.28911331735707, -8.09226292365628}},
+        {{31239.301609038, 31239.301609038, 31239.301609038, 19685.0393700787,
+          19685.0393700787, 19685.0393700787}}},
+       {{{-18.6708319068812, -10.5999657651489, -10.4031153714481}},
+        {{31239.301609038, 31239.301609038, 31239.301609038, 19685.0393700787,
+          19685.0393700787, 19685.0393700787}}},
+       {{{-24.9186922286888, -12.9108182129408, -12.71396781924}},
+        {{31239.301609038, 31239.301609038, 31239.301609038, 19685.0393700787,
+          19685.0393700787, 19685.0393700787}}},
+       {{{-31.1665525504964, -15.2216706607326, -15.0248202670318}},
+        {{31239.301609038, 31239.301609038, 31239.301609038, 19685.0393700787,
+          19685.0393700787, 19685.0393700787}}},
+       {{{-37.414412872304, -17.5325231085245, -17.3356727148237}},
+        {{31239.301609038, 31239.301609038, 31239.301609038, 19685.0393700787,
+          19685.0393700787, 19685.0393700787}}}}},
+     // CreepBGRa
+     {{{{{-12.4229488120127, -8.28912390947844, -8.09227510459586}},
+        {{31238.7726892785, 31239.1041765352, 31239.0746652473,
+          19684.8804831286, 19684.8804831286, 19684.8804831286}}},
+       {{{-18.6702007111236, -10.6002695730705, -10.4034427592842}},
+        {{31231.9737368179, 31236.4735951036, 31236.2617477878,
+          19682.8392595552, 19682.8392595552, 19682.8392595552}}},
+       {{{-24.9137254295634, -12.913236951533, -12.7165158797731}},
+        {{31204.1312105383, 31225.5600065765, 31224.8741793522,
+          19674.4639005802, 19674.4639005802, 19674.4639005802}}},
+       {{{-31.1440008011389, -15.2327200809234, -15.0363225961986}},
+        {{31132.0835197696, 31197.0877145894, 31195.5119795558,
+          19652.6593886176, 19652.6593886176, 19652.6593886176}}},
+       {{{-37.3400906823619, -17.5690754416817, -17.3734425716086}},
+        {{30987.7735095077, 31139.5698212397, 31136.6095143334,
+          19608.4013982137, 19608.4013982137, 19608.4013982137}}}}},
+     // Lubby2
+     {{{{{-0.000600688733583047, -0.000341819193682304, -0.00032949207273465}},
+        {{1.62179538877304, 1.62180532126955, 1.62180443701003,
+          1.23271209473932, 1.23271209473932, 1.23271209473932}}},
+       {{{-0.000887077217324633, -0.000437300371040029, -0.000427622411635339}},
+        {{1.62177724099698, 1.6217938989756, 1.62179320429089, 1.23269849385945,
+          1.23269849385945, 1.23269849385945}}},
+       {{{-0.00114853347369838, -0.000545610175292909, -0.000537856351008713}},
+        {{1.62176267274746, 1.62178472915833, 1.62178417251999,
+          1.23268757063922, 1.23268757063922, 1.23268757063922}}},
+       {{{-0.00139170422726525, -0.000663319875708172, -0.000656975897026583}},
+        {{1.62175072986629, 1.62177721608711, 1.62177676063987,
+          1.23267861475603, 1.23267861475603, 1.23267861475603}}},
+       {{{-0.00162131537867822, -0.000787992159778716, -0.000782692461543062}},
+        {{1.62174073388638, 1.62177093202806, 1.62177055154336,
+          1.23267111843731, 1.23267111843731, 1.23267111843731}}}}},
+     // SolidEhlers
+     {{{{{-0.149, -0.086, -0.083}},
+        {{400., 400., 400., 300., 300., 300.}}},
+       {{{-0.229, -0.106, -0.103}},
+        {{400., 400., 400., 300., 300., 300.}}},
+       {{{-0.309, -0.126, -0.123}},
+        {{400., 400., 400., 300., 300., 300.}}},
+       {{{-0.363022482226968, -0.147102858709548, -0.144827798826099}},
+        {{72.394006621068, 378.54196418141, 375.288486453692, 238.933307780074,
+          282.39209967636, 239.317322534218}}},
+       {{{-0.375429530209561, -0.167150855263473, -0.165902404563639}},
+        {{52.5919600764356, 355.709700768021, 353.44618298329, 180.893468568577,
+          258.422443508835, 181.217408787629}}}}}}};
+
+void expectReference(Reference const& reference, KelvinVector const& sigma,
+                     KelvinMatrix const& C, int const model, int const step)
+{
+    KelvinVector sigma_expected = KelvinVector::Zero();
+    sigma_expected.head<3>() =
+        Eigen::Map<Eigen::Vector3d const>(reference.sigma.data());
+    Eigen::Matrix<double, 6, 1> const C_diagonal_expected =
+        Eigen::Map<Eigen::Matrix<double, 6, 1> const>(
+            reference.C_diagonal.data());
+
+    EXPECT_LE((sigma - sigma_expected).norm(), 1e-10 * sigma_expected.norm())
+        << "model " << model << ", step " << step;
+    EXPECT_LE((C.diagonal() - C_diagonal_expected).norm(),
+              1e-10 * C_diagonal_expected.norm())
+        << "model " << model << ", step " << step;
+}
+}  // namespace
+
+// The in-place and the allocating integration reproduce the reference
+// stresses and tangents over several load steps, which also requires the
+// internal state to evolve correctly.
+TEST(MaterialLibSolidModels, IntegrateStressInPlace)
+{
+    SolidModels models;
+    ParameterLib::SpatialPosition const x;
+    double const dt = 0.1;
+
+    for (int i = 0; i < number_of_models; ++i)
+    {
+        auto const model = models.create(i);
+        std::unique_ptr<MechanicsBase::MaterialStateVariables> state =
+            model->createMaterialStateVariables();
+        std::unique_ptr<MechanicsBase::MaterialStateVariables> state_in_place =
+            model->createMaterialStateVariables();
+
+        KelvinVector sigma_prev = KelvinVector::Zero();
+        KelvinVector sigma_prev_in_place = KelvinVector::Zero();
+        for (int step = 1; step <= 5; ++step)
+        {
+            double const t = step * dt;
+            KelvinVector const eps_prev = strain(step - 1);
+            KelvinVector const eps = strain(step);
+
+            auto solution = model->integrateStress(t, x, dt, eps_prev, eps,
+                                                   sigma_prev, *state, T);
+            ASSERT_TRUE(solution) << "model " << i << ", step " << step;
+            KelvinVector sigma;
+            KelvinMatrix C;
+            std::tie(sigma, state, C) = std::move(*solution);
+
+            KelvinVector sigma_in_place;
+            KelvinMatrix C_in_place;
+            ASSERT_TRUE(model->integrateStressInPlace(
+                t, x, dt, eps_prev, eps, sigma_prev_in_place, state_in_place,
+                T, sigma_in_place, C_in_place));
+
+            auto const& reference = references[i][step - 1];
+            expectReference(reference, sigma, C, i, step);
+            expectReference(reference, sigma_in_place, C_in_place, i, step);
+
+            state->pushBackState();
+            state_in_place->pushBackState();
+            sigma_prev = sigma;
+            sigma_prev_in_place = sigma_in_place;
+        }
+    }
+}
+
+TEST(MaterialLibSolidModels, DISABLED_IntegrateStressInPlaceBenchmark)
+{
+    SolidModels models;
+    ParameterLib::SpatialPosition const x;
+    double const dt = 0.1;
+    int const n_calls = 100000;
+    KelvinVector const eps_prev = strain(0);
+    KelvinVector const eps = strain(1);
+    KelvinVector const sigma_prev = KelvinVector::Zero();
+
+    for (int i = 0; i < number_of_models; ++i)
+    {
+        auto const model = models.create(i);
+        auto state = model->createMaterialStateVariables();
+
+        BaseLib::RunTime time_allocating;
+        time_allocating.start();
+        for (int call = 0; call < n_calls; ++call)
+        {
+            auto solution = model->integrateStress(dt, x, dt, eps_prev, eps,
+                                                   sigma_prev, *state, T);
+            ASSERT_TRUE(solution);
+        }
+        double const allocating_time = time_allocating.elapsed();
+
+        KelvinVector sigma;
+        KelvinMatrix C;
+        BaseLib::RunTime time_in_place;
+        time_in_place.start();
+        for (int call = 0; call < n_calls; ++call)
+        {
+            ASSERT_TRUE(model->integrateStressInPlace(
+                dt, x, dt, eps_prev, eps, sigma_prev, state, T, sigma, C));
+        }
+        double const in_place_time = time_in_place.elapsed();
+
+        INFO("Model %d, %d calls: allocating %g s, in place %g s.", i,
+             n_calls, allocating_time, in_place_time);
+    }
+}
@@ -21,6 +21,8 @@
 #include "MathLib/LinAlg/PETSc/PETScMatrix.h"
 #elif defined(OGS_USE_EIGEN)
 #include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenTools.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
 #endif
 
 #include "MathLib/LinAlg/Dense/DenseMatrix.h"
@@ -232,4 +234,213 @@ TEST(Math, CheckInterface_EigenMatrix)
     MathLib::EigenMatrix m(10);
     checkGlobalMatrixInterface(m);
 }
+
+TEST(Math, EigenMatrixCachedAdd)
+{
+    // Two overlapping "elements" scattered repeatedly; the cached add must
+    // give the same matrix as the plain add.
+    std::vector<std::vector<GlobalIndexType>> const element_indices = {
+        {0, 2, 5}, {5, 2, 7}};
+    MathLib::DenseMatrix<double> local_m(3, 3);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            local_m(i, j) = 1.0 + i + 3.0 * j;
+        }
+    }
+
+    MathLib::EigenMatrix reference(10);
+    MathLib::EigenMatrix cached(10);
+    for (int assembly = 0; assembly < 3; ++assembly)
+    {
+        reference.setZero();
+        cached.setZero();
+        for (std::size_t e = 0; e < element_indices.size(); ++e)
+        {
+            MathLib::RowColumnIndices<GlobalIndexType> const indices(
+                element_indices[e], element_indices[e]);
+            reference.add(indices, local_m);
+            cached.add(e, indices, local_m);
+        }
+        finalizeAssembly(reference);
+        finalizeAssembly(cached);
+
+        ASSERT_EQ(reference.getRawMatrix().nonZeros(),
+                  cached.getRawMatrix().nonZeros());
+        for (GlobalIndexType r = 0; r < 10; ++r)
+        {
+            for (GlobalIndexType c = 0; c < 10; ++c)
+            {
+                ASSERT_EQ(reference.get(r, c), cached.get(r, c));
+            }
+        }
+    }
+
+    // Changed indices of an item invalidate its cache entry and new entries
+    // are inserted.
+    cached.setZero();
+    std::vector<GlobalIndexType> const new_element_indices = {1, 8, 9};
+    MathLib::RowColumnIndices<GlobalIndexType> const indices(
+        new_element_indices, new_element_indices);
+    cached.add(0, indices, local_m);
+    finalizeAssembly(cached);
+    ASSERT_EQ(local_m(1, 2), cached.get(8, 9));
+}
+
+TEST(Math, EigenMatrixCompressedSparsity)
+{
+    // 3x3 tridiagonal pattern.
+    GlobalCompressedSparsityPattern const pattern{{0, 2, 5, 7},
+                                                  {0, 1, 0, 1, 2, 1, 2}};
+
+    MathLib::EigenMatrix m(3);
+    setMatrixSparsity(m, pattern);
+
+    ASSERT_TRUE(m.getRawMatrix().isCompressed());
+    ASSERT_EQ(7, m.getRawMatrix().nonZeros());
+    ASSERT_EQ(0.0, m.get(1, 2));
+
+    // Adding to entries of the pattern does not change the storage.
+    auto const* const values = m.getRawMatrix().valuePtr();
+    m.add(1, 2, 3.0);
+    m.add(2, 2, 1.0);
+    ASSERT_TRUE(m.getRawMatrix().isCompressed());
+    ASSERT_EQ(7, m.getRawMatrix().nonZeros());
+    ASSERT_EQ(values, m.getRawMatrix().valuePtr());
+    ASSERT_EQ(3.0, m.get(1, 2));
+    ASSERT_EQ(1.0, m.get(2, 2));
+    ASSERT_EQ(0.0, m.get(0, 2));
+}
+
+TEST(Math, EigenMatrixApplyKnownSolution)
+{
+    // Compares the cached in-place elimination with a dense reference, for
+    // repeated calls on the same pattern and after changing the known ids.
+    GlobalIndexType const n = 8;
+    auto fill = [&](MathLib::EigenMatrix& A, double const shift) {
+        for (GlobalIndexType r = 0; r < n; ++r)
+        {
+            for (GlobalIndexType c = 0; c < n; ++c)
+            {
+                // Row 3 has no diagonal entry.
+                if ((r + 2 * c) % 3 != 0 && !(r == 3 && c == 3))
+                {
+                    A.setValue(r, c, shift + r + 0.5 * c);
+                }
+            }
+            A.setValue(r, r == 3 ? 4 : r, 10.0 + r);
+        }
+        finalizeAssembly(A);
+    };
+
+    auto check = [&](std::vector<GlobalIndexType> const& ids,
+                     std::vector<double> const& values, double const shift,
+                     MathLib::EigenMatrix& A) {
+        A.setZero();
+        fill(A, shift);
+        Eigen::MatrixXd expected_A = A.getRawMatrix();
+        MathLib::EigenVector b(n);
+        MathLib::EigenVector x(n);
+        for (GlobalIndexType i = 0; i < n; ++i)
+        {
+            b.set(i, 1.0 + i);
+        }
+        Eigen::VectorXd expected_b = b.getRawVector();
+
+        for (std::size_t ix = 0; ix < ids.size(); ++ix)
+        {
+            auto const k = ids[ix];
+            for (GlobalIndexType i = 0; i < n; ++i)
+            {
+                if (i != k)
+                {
+                    expected_A(k, i) = 0.0;
+                }
+            }
+        }
+        for (std::size_t ix = 0; ix < ids.size(); ++ix)
+        {
+            auto const k = ids[ix];
+            for (GlobalIndexType i = 0; i < n; ++i)
+            {
+                if (i != k)
+                {
+                    expected_b[i] -= expected_A(i, k) * values[ix];
+                    expected_A(i, k) = 0.0;
+                }
+            }
+            if (expected_A(k, k) != 0.0)
+            {
+                expected_b[k] = values[ix] * expected_A(k, k);
+            }
+            else
+            {
+                expected_b[k] = values[ix];
+                expected_A(k, k) = 1.0;
+            }
+        }
+
+        MathLib::applyKnownSolution(A, b, x, ids, values);
+
+        Eigen::MatrixXd const actual_A = A.getRawMatrix();
+        for (GlobalIndexType r = 0; r < n; ++r)
+        {
+            ASSERT_EQ(expected_b[r], b.getRawVector()[r]);
+            for (GlobalIndexType c = 0; c < n; ++c)
+            {
+                ASSERT_EQ(expected_A(r, c), actual_A(r, c));
+            }
+        }
+    };
+
+    MathLib::EigenMatrix A(n);
+    check({1, 6, 2}, {3.0, -1.0, 0.5}, 0.0, A);
+    check({1, 6, 2}, {2.0, 4.0, -0.5}, 1.0, A);
+    check({0, 3, 5, 0}, {1.5, 2.0, 7.0, 1.5}, 2.0, A);
+    check({0, 3, 5, 0}, {1.5, 2.0, 7.0, 1.5}, 3.0, A);
+}
+
+TEST(Math, EigenMatrixApplyKnownSolutionChangedPattern)
+{
+    // The two patterns have the same number of entries in every row, but the
+    // entries of the known column 1 are in other rows.
+    GlobalIndexType const n = 4;
+    MathLib::EigenMatrix A(n);
+    MathLib::EigenVector b(n);
+    MathLib::EigenVector x(n);
+    std::vector<GlobalIndexType> const ids = {1};
+    std::vector<double> const values = {2.0};
+
+    auto apply = [&](std::vector<std::pair<GlobalIndexType, GlobalIndexType>>
+                         const& off_diagonal_entries) {
+        A.getRawMatrix().setZero();
+        for (GlobalIndexType i = 0; i < n; ++i)
+        {
+            A.setValue(i, i, 4.0);
+            b.set(i, 1.0);
+        }
+        for (auto const& entry : off_diagonal_entries)
+        {
+            A.setValue(entry.first, entry.second, 1.0);
+        }
+        finalizeAssembly(A);
+        ASSERT_EQ(7, A.getRawMatrix().nonZeros());
+        MathLib::applyKnownSolution(A, b, x, ids, values);
+    };
+
+    apply({{0, 1}, {2, 1}, {3, 2}});
+    apply({{0, 1}, {2, 3}, {3, 1}});
+
+    Eigen::MatrixXd const actual_A = A.getRawMatrix();
+    EXPECT_EQ(0.0, actual_A(0, 1));
+    EXPECT_EQ(4.0, actual_A(1, 1));
+    EXPECT_EQ(1.0, actual_A(2, 3));
+    EXPECT_EQ(0.0, actual_A(3, 1));
+    auto const& actual_b = b.getRawVector();
+    EXPECT_EQ(-1.0, actual_b[0]);
+    EXPECT_EQ(8.0, actual_b[1]);
+    EXPECT_EQ(1.0, actual_b[2]);
+    EXPECT_EQ(-1.0, actual_b[3]);
+}
 #endif
@@ -0,0 +1,158 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/MemWatch.h"
+#include "BaseLib/RunTime.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+template <typename Range>
+std::vector<std::size_t> getIDs(Range const& items)
+{
+    std::vector<std::size_t> ids;
+    for (auto const* item : items)
+    {
+        ids.push_back(item->getID());
+    }
+    return ids;
+}
+
+// Computes the elements and the connected nodes of every node from the
+// elements of the mesh and compares them with the nodes' adjacencies.
+void checkNodeAdjacencies(MeshLib::Mesh const& mesh)
+{
+    auto const& nodes = mesh.getNodes();
+    std::vector<std::vector<std::size_t>> expected_elements(nodes.size());
+    std::vector<std::vector<std::size_t>> expected_nodes(nodes.size());
+    for (auto const* element : mesh.getElements())
+    {
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            auto const id = element->getNodeIndex(i);
+            expected_elements[id].push_back(element->getID());
+            for (unsigned j = 0; j < element->getNumberOfNodes(); ++j)
+            {
+                expected_nodes[id].push_back(element->getNodeIndex(j));
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        auto& node_ids = expected_nodes[i];
+        std::sort(node_ids.begin(), node_ids.end());
+        node_ids.erase(std::unique(node_ids.begin(), node_ids.end()),
+                       node_ids.end());
+
+        EXPECT_EQ(expected_elements[i], getIDs(nodes[i]->getElements()));
+        EXPECT_EQ(node_ids, getIDs(nodes[i]->getConnectedNodes()));
+    }
+}
+}  // namespace
+
+TEST(MeshLibMesh, CompressedNodeAdjacency)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 5));
+    checkNodeAdjacencies(*mesh);
+
+    // The adjacencies of all nodes are stored one after another.
+    auto const& nodes = mesh->getNodes();
+    for (std::size_t i = 1; i < nodes.size(); ++i)
+    {
+        EXPECT_EQ(nodes[i - 1]->getElements().end(),
+                  nodes[i]->getElements().begin());
+        EXPECT_EQ(nodes[i - 1]->getConnectedNodes().end(),
+                  nodes[i]->getConnectedNodes().begin());
+    }
+}
+
+TEST(MeshLibMesh, CompressedNodeAdjacencyOfMeshCopy)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    std::unique_ptr<MeshLib::Mesh> copy(new MeshLib::Mesh(*mesh));
+    checkNodeAdjacencies(*copy);
+
+    // The copy refers to its own elements and nodes only.
+    for (auto const* node : copy->getNodes())
+    {
+        for (auto const* element : node->getElements())
+        {
+            EXPECT_EQ(copy->getElement(element->getID()), element);
+        }
+        for (auto const* connected_node : node->getConnectedNodes())
+        {
+            EXPECT_EQ(copy->getNode(connected_node->getID()), connected_node);
+        }
+    }
+}
+
+TEST(MeshLibMesh, CompressedNodeAdjacencyAfterAddElement)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 4));
+    auto const& nodes = mesh->getNodes();
+
+    // Connect the first and the last node.
+    std::array<MeshLib::Node*, 2> const line_nodes{
+        {nodes.front(), nodes.back()}};
+    mesh->addElement(
+        new MeshLib::Line(line_nodes, mesh->getNumberOfElements()));
+
+    checkNodeAdjacencies(*mesh);
+    ASSERT_EQ(2u, nodes.front()->getNumberOfElements());
+    EXPECT_EQ(3u, nodes.front()->getConnectedNodes().size());
+}
+
+// Measures the construction time of a mesh and the resident memory used by
+// it. Not run by default because of the size of the mesh.
+TEST(MeshLibMesh, DISABLED_CompressedNodeAdjacencyBenchmark)
+{
+    BaseLib::MemWatch mem_watch;
+    auto const memory_before = mem_watch.getResMemUsage();
+
+    // 3163^2 nodes, about 10 million.
+    BaseLib::RunTime time_construction;
+    time_construction.start();
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 3162));
+    double const construction_time = time_construction.elapsed();
+
+    auto const memory = mem_watch.getResMemUsage() - memory_before;
+    std::size_t adjacency_entries = 0;
+    for (auto const* node : mesh->getNodes())
+    {
+        adjacency_entries +=
+            node->getElements().size() + node->getConnectedNodes().size();
+    }
+
+    auto const n_nodes = static_cast<double>(mesh->getNumberOfNodes());
+    INFO("Mesh with %d nodes and %d elements constructed in %g s.",
+         mesh->getNumberOfNodes(), mesh->getNumberOfElements(),
+         construction_time);
+    INFO("Resident memory of the mesh: %g bytes per node.", memory / n_nodes);
+    INFO("Node objects and adjacencies: %g bytes per node.",
+         (sizeof(MeshLib::Node) * n_nodes +
+          adjacency_entries * sizeof(void*)) /
+             n_nodes);
+}
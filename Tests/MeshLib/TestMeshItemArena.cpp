@@ -0,0 +1,101 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshItemArena.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+// Two quads side by side, constructed in an arena like the meshes converted
+// from VTK grids.
+std::unique_ptr<MeshLib::Mesh> createMeshInArena()
+{
+    auto arena = std::make_unique<MeshLib::MeshItemArena>();
+
+    std::size_t const n_nodes = 6;
+    auto* const node_block = arena->allocate<MeshLib::Node>(n_nodes);
+    std::vector<MeshLib::Node*> nodes(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; i++)
+    {
+        nodes[i] = new (node_block + i)
+            MeshLib::Node(static_cast<double>(i % 3), i < 3 ? 0. : 1., 0., i);
+    }
+
+    std::array<std::array<std::size_t, 4>, 2> const quad_node_ids{
+        {{{0, 1, 4, 3}}, {{1, 2, 5, 4}}}};
+    std::size_t const n_quads = quad_node_ids.size();
+    auto* const quad_block = arena->allocate<MeshLib::Quad>(n_quads);
+    auto** const node_arrays = arena->allocate<MeshLib::Node*>(
+        n_quads * MeshLib::Quad::n_all_nodes);
+    auto** const neighbor_arrays = arena->allocate<MeshLib::Element*>(
+        n_quads * MeshLib::Quad::n_neighbors);
+    std::vector<MeshLib::Element*> elements(n_quads);
+    for (std::size_t e = 0; e < n_quads; e++)
+    {
+        auto** const quad_nodes = node_arrays + e * MeshLib::Quad::n_all_nodes;
+        for (unsigned k = 0; k < MeshLib::Quad::n_all_nodes; k++)
+        {
+            quad_nodes[k] = nodes[quad_node_ids[e][k]];
+        }
+        elements[e] = new (quad_block + e) MeshLib::Quad(
+            quad_nodes, neighbor_arrays + e * MeshLib::Quad::n_neighbors, e);
+    }
+
+    return std::make_unique<MeshLib::Mesh>("arena", nodes, elements,
+                                           MeshLib::Properties(), 0,
+                                           std::move(arena));
+}
+}  // namespace
+
+TEST(MeshLibMeshItemArena, Contains)
+{
+    MeshLib::MeshItemArena arena;
+    auto* const values = arena.allocate<double>(4);
+    EXPECT_TRUE(arena.contains(values));
+    EXPECT_TRUE(arena.contains(values + 3));
+    EXPECT_FALSE(arena.contains(values + 4));
+
+    double const other = 0;
+    EXPECT_FALSE(arena.contains(&other));
+}
+
+TEST(MeshLibMeshItemArena, MeshWithItemsInArena)
+{
+    auto const mesh = createMeshInArena();
+    ASSERT_EQ(6u, mesh->getNumberOfNodes());
+    ASSERT_EQ(2u, mesh->getNumberOfElements());
+    EXPECT_EQ(2u, mesh->getDimension());
+
+    auto const* const quad = mesh->getElement(0);
+    EXPECT_DOUBLE_EQ(1.0, quad->getContent());
+    EXPECT_EQ(mesh->getElement(1), quad->getNeighbor(1));
+    EXPECT_EQ(2u, mesh->getNode(1)->getNumberOfElements());
+
+    // A line allocated on its own is deleted by the mesh.
+    auto const& nodes = mesh->getNodes();
+    std::array<MeshLib::Node*, 2> const line_nodes{{nodes[0], nodes[1]}};
+    mesh->addElement(new MeshLib::Line(line_nodes, 2));
+    EXPECT_EQ(2u, mesh->getNode(0)->getNumberOfElements());
+
+    // The copy allocates its nodes and elements one by one.
+    MeshLib::Mesh const copy(*mesh);
+    ASSERT_EQ(3u, copy.getNumberOfElements());
+    EXPECT_EQ(copy.getElement(1), copy.getElement(0)->getNeighbor(1));
+    EXPECT_EQ(copy.getNode(4), copy.getElement(1)->getNode(3));
+}
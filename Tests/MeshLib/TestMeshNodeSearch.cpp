@@ -397,3 +397,75 @@ TEST_F(MeshLibMeshNodeSearchInSimpleHexMesh, SurfaceSearch)
     std::for_each(pnts.begin(), pnts.end(), [](GeoLib::Point* pnt) { delete pnt; });
 }
 
+
+TEST_F(MeshLibMeshNodeSearchInSimpleHexMesh, ParallelSearchAlongGeometries)
+{
+    ASSERT_TRUE(_hex_mesh != nullptr);
+    std::vector<GeoLib::Point*> pnts;
+    pnts.push_back(new GeoLib::Point(0.0, 0.0, 0.0));
+    pnts.push_back(new GeoLib::Point(_geometric_size, _geometric_size, 0.0));
+    pnts.push_back(new GeoLib::Point(_geometric_size, _geometric_size,
+                                     _geometric_size));
+    pnts.push_back(new GeoLib::Point(0.0, 0.0, _geometric_size));
+
+    // space diagonal
+    GeoLib::Polyline ply_diagonal(pnts);
+    ply_diagonal.addPoint(0);
+    ply_diagonal.addPoint(2);
+
+    // along the diagonal of the bottom and upwards
+    GeoLib::Polyline ply_bent(pnts);
+    ply_bent.addPoint(0);
+    ply_bent.addPoint(1);
+    ply_bent.addPoint(2);
+
+    // the plane x = y
+    GeoLib::Surface sfc(pnts);
+    sfc.addTriangle(0, 1, 2);
+    sfc.addTriangle(0, 2, 3);
+
+    auto search_length = std::make_unique<MeshGeoToolsLib::SearchLength>();
+    MeshGeoToolsLib::MeshNodeSearcher mesh_node_searcher(
+        *_hex_mesh, std::move(search_length),
+        MeshGeoToolsLib::SearchAllNodes::Yes);
+
+    // The geometries given twice are searched only once.
+    mesh_node_searcher.searchMeshNodesAlongGeometries(
+        {&ply_diagonal, &ply_bent, &ply_diagonal}, {&sfc, &sfc});
+
+    const std::size_t n_nodes_1d = _number_of_subdivisions_per_direction + 1;
+    const std::size_t n_nodes_2d = n_nodes_1d * n_nodes_1d;
+
+    std::vector<std::size_t> const& found_ids_diagonal(
+        mesh_node_searcher.getMeshNodeIDsAlongPolyline(ply_diagonal));
+    ASSERT_EQ(n_nodes_1d, found_ids_diagonal.size());
+    for (std::size_t k(0); k < n_nodes_1d; k++)
+    {
+        ASSERT_EQ(k * (n_nodes_2d + n_nodes_1d + 1), found_ids_diagonal[k]);
+    }
+
+    std::vector<std::size_t> const& found_ids_bent(
+        mesh_node_searcher.getMeshNodeIDsAlongPolyline(ply_bent));
+    ASSERT_EQ(2 * n_nodes_1d - 1, found_ids_bent.size());
+    for (std::size_t k(0); k < n_nodes_1d; k++)
+    {
+        ASSERT_EQ(k * (n_nodes_1d + 1), found_ids_bent[k]);
+        ASSERT_EQ(n_nodes_2d - 1 + k * n_nodes_2d,
+                  found_ids_bent[n_nodes_1d - 1 + k]);
+    }
+
+    std::vector<std::size_t> const& found_ids_sfc(
+        mesh_node_searcher.getMeshNodeIDsAlongSurface(sfc));
+    ASSERT_EQ(n_nodes_2d, found_ids_sfc.size());
+    std::size_t cnt = 0;
+    for (std::size_t k(0); k < n_nodes_1d; k++)
+    {
+        for (std::size_t i(0); i < n_nodes_1d; i++)
+        {
+            ASSERT_EQ(k * n_nodes_2d + i * (n_nodes_1d + 1),
+                      found_ids_sfc[cnt++]);
+        }
+    }
+
+    std::for_each(pnts.begin(), pnts.end(), [](GeoLib::Point* pnt) { delete pnt; });
+}
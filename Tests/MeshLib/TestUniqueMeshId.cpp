@@ -42,3 +42,21 @@ TEST(MeshLib, UniqueMeshId)
 
 }
 
+
+TEST(MeshLib, SortMeshIDs)
+{
+    // Construct the meshes in another order than they are stored.
+    std::vector<std::unique_ptr<Mesh>> meshes(3);
+    for (std::size_t const i : {2, 0, 1})
+    {
+        meshes[i] = std::make_unique<Mesh>("mesh", std::vector<Node*>(),
+                                           std::vector<Element*>());
+    }
+    std::size_t const first_id = meshes[2]->getID();
+
+    sortMeshIDs(meshes);
+    for (std::size_t i = 0; i < meshes.size(); ++i)
+    {
+        EXPECT_EQ(first_id + i, meshes[i]->getID());
+    }
+}
@@ -114,3 +114,61 @@ TEST_F(TestVtkMeshConverter, Conversion)
         ASSERT_EQ((*materialIds)[i], vtkMaterialIds->GetTuple1(i));
     }
 }
+
+TEST_F(TestVtkMeshConverter, MixedCellTypes)
+{
+    // A pixel, whose nodes are numbered row by row, and a line in addition
+    // to the two hexahedra.
+    vtkIdType const pixel[4] = {0, 1, 3, 4};
+    vtu->InsertNextCell(VTK_PIXEL, 4, pixel);
+    vtkIdType const line[2] = {0, 6};
+    vtu->InsertNextCell(VTK_LINE, 2, line);
+
+    auto const mesh = std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::VtkMeshConverter::convertUnstructuredGrid(vtu));
+    ASSERT_EQ(4u, mesh->getNumberOfElements());
+
+    auto const* const quad = mesh->getElement(2);
+    ASSERT_EQ(MeshLib::CellType::QUAD4, quad->getCellType());
+    EXPECT_EQ(0u, quad->getNodeIndex(0));
+    EXPECT_EQ(1u, quad->getNodeIndex(1));
+    EXPECT_EQ(4u, quad->getNodeIndex(2));
+    EXPECT_EQ(3u, quad->getNodeIndex(3));
+
+    auto const* const line_element = mesh->getElement(3);
+    ASSERT_EQ(MeshLib::CellType::LINE2, line_element->getCellType());
+    EXPECT_EQ(0u, line_element->getNodeIndex(0));
+    EXPECT_EQ(6u, line_element->getNodeIndex(1));
+
+    // The hexahedra share the face with the nodes 1, 4, 7 and 10.
+    auto const* const hex = mesh->getElement(0);
+    bool is_neighbor = false;
+    for (unsigned i = 0; i < hex->getNumberOfNeighbors(); i++)
+    {
+        is_neighbor |= hex->getNeighbor(i) == mesh->getElement(1);
+    }
+    EXPECT_TRUE(is_neighbor);
+
+    // A copy of the mesh owns its nodes and elements one by one.
+    MeshLib::Mesh const copy(*mesh);
+    ASSERT_EQ(4u, copy.getNumberOfElements());
+    EXPECT_EQ(MeshLib::CellType::QUAD4, copy.getElement(2)->getCellType());
+    EXPECT_EQ(4u, copy.getElement(2)->getNodeIndex(2));
+}
+
+TEST_F(TestVtkMeshConverter, ReleaseGridData)
+{
+    auto const n_points = vtu->GetNumberOfPoints();
+    auto const n_cells = vtu->GetNumberOfCells();
+
+    auto const mesh = std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::VtkMeshConverter::convertUnstructuredGrid(
+            vtu, "released", true));
+    ASSERT_EQ(n_points, mesh->getNumberOfNodes());
+    ASSERT_EQ(n_cells, mesh->getNumberOfElements());
+    EXPECT_NE(nullptr,
+              mesh->getProperties().getPropertyVector<int>("MaterialIDs"));
+
+    EXPECT_EQ(0, vtu->GetNumberOfCells());
+    EXPECT_EQ(0, vtu->GetPointData()->GetNumberOfArrays());
+}
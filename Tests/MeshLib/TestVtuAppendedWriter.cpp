@@ -0,0 +1,159 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include <logog/include/logog.hpp>
+#include <vtkXMLUnstructuredGridWriter.h>
+
+#include "BaseLib/RunTime.h"
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/VtkIO/VtuAppendedWriter.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+void addProperties(MeshLib::Mesh& mesh)
+{
+    auto* const pressure =
+        mesh.getProperties().createNewPropertyVector<double>(
+            "pressure", MeshLib::MeshItemType::Node, 1);
+    pressure->resize(mesh.getNumberOfNodes());
+    std::iota(pressure->begin(), pressure->end(), 0.5);
+
+    auto* const material_ids =
+        mesh.getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    material_ids->resize(mesh.getNumberOfElements());
+    std::iota(material_ids->begin(), material_ids->end(), -3);
+
+    auto* const sigma_ip =
+        mesh.getProperties().createNewPropertyVector<double>(
+            "sigma_ip", MeshLib::MeshItemType::IntegrationPoint, 4);
+    sigma_ip->resize(mesh.getNumberOfElements() * 4 * 2);
+    std::iota(sigma_ip->begin(), sigma_ip->end(), 1.0);
+}
+
+template <typename T>
+void expectEqualProperty(MeshLib::Mesh const& expected,
+                         MeshLib::Mesh const& actual, std::string const& name)
+{
+    auto const& expected_values =
+        *expected.getProperties().getPropertyVector<T>(name);
+    ASSERT_TRUE(actual.getProperties().existsPropertyVector<T>(name));
+    auto const& actual_values =
+        *actual.getProperties().getPropertyVector<T>(name);
+    ASSERT_EQ(expected_values.getNumberOfComponents(),
+              actual_values.getNumberOfComponents());
+    ASSERT_EQ(expected_values.size(), actual_values.size());
+    for (std::size_t i = 0; i < expected_values.size(); ++i)
+    {
+        EXPECT_EQ(expected_values[i], actual_values[i]);
+    }
+}
+}  // namespace
+
+#ifndef USE_PETSC
+// The written files are read back by VTK, the nodes, elements, and properties
+// have to be identical.
+TEST(MeshLibVtuAppendedWriter, Roundtrip)
+{
+    std::unique_ptr<MeshLib::Mesh> const meshes[] = {
+        std::unique_ptr<MeshLib::Mesh>(
+            MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4)),
+        std::unique_ptr<MeshLib::Mesh>(
+            MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 2.0, 3.0,
+                                                             3, 2, 4))};
+
+    std::string const file_name =
+        TestInfoLib::TestInfo::tests_tmp_path + "/VtuAppendedWriter.vtu";
+
+    for (auto const& mesh : meshes)
+    {
+        addProperties(*mesh);
+        for (bool const compress : {false, true})
+        {
+            ASSERT_TRUE(MeshLib::IO::writeVtuAppended(
+                file_name, *mesh, mesh->getProperties(), compress));
+
+            std::unique_ptr<MeshLib::Mesh> const read_mesh(
+                MeshLib::IO::VtuInterface::readVTUFile(file_name));
+            ASSERT_TRUE(read_mesh != nullptr);
+
+            ASSERT_EQ(mesh->getNumberOfNodes(), read_mesh->getNumberOfNodes());
+            for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    EXPECT_EQ((*mesh->getNode(i))[c],
+                              (*read_mesh->getNode(i))[c]);
+                }
+            }
+
+            ASSERT_EQ(mesh->getNumberOfElements(),
+                      read_mesh->getNumberOfElements());
+            for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+            {
+                auto const& element = *mesh->getElement(e);
+                auto const& read_element = *read_mesh->getElement(e);
+                ASSERT_EQ(element.getCellType(), read_element.getCellType());
+                for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+                {
+                    EXPECT_EQ(element.getNodeIndex(i),
+                              read_element.getNodeIndex(i));
+                }
+            }
+
+            expectEqualProperty<double>(*mesh, *read_mesh, "pressure");
+            expectEqualProperty<int>(*mesh, *read_mesh, "MaterialIDs");
+            expectEqualProperty<double>(*mesh, *read_mesh, "sigma_ip");
+        }
+    }
+}
+
+// Compares the writing times with the VTK writer. Not run by default because
+// of the size of the mesh.
+TEST(MeshLibVtuAppendedWriter, DISABLED_Benchmark)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 100));
+    addProperties(*mesh);
+
+    std::string const file_name =
+        TestInfoLib::TestInfo::tests_tmp_path + "/VtuAppendedWriterBench.vtu";
+
+    for (bool const compress : {false, true})
+    {
+        BaseLib::RunTime time_vtk;
+        time_vtk.start();
+        MeshLib::IO::VtuInterface vtu_interface(
+            mesh.get(), vtkXMLWriter::Appended, compress);
+        ASSERT_TRUE(vtu_interface
+                        .writeVTU<vtkXMLUnstructuredGridWriter>(file_name));
+        double const vtk_time = time_vtk.elapsed();
+
+        BaseLib::RunTime time_native;
+        time_native.start();
+        ASSERT_TRUE(MeshLib::IO::writeVtuAppended(
+            file_name, *mesh, mesh->getProperties(), compress));
+        double const native_time = time_native.elapsed();
+
+        INFO("Writing %d nodes with compression %d: VTK %g s, native %g s.",
+             mesh->getNumberOfNodes(), compress, vtk_time, native_time);
+    }
+}
+#endif
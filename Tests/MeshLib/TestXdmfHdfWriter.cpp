@@ -0,0 +1,149 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#if defined(OGS_USE_XDMF) && !defined(USE_PETSC)
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/XDMF/XdmfHdfWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+template <typename T>
+std::vector<T> readDataset(hid_t const file, std::string const& path,
+                           hid_t const type, std::vector<hsize_t>& dims)
+{
+    hid_t const dataset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+    EXPECT_LE(0, dataset) << path;
+    if (dataset < 0)
+    {
+        return {};
+    }
+    hid_t const space = H5Dget_space(dataset);
+    dims.resize(H5Sget_simple_extent_ndims(space));
+    H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+    std::vector<T> values(H5Sget_simple_extent_npoints(space));
+    H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+    H5Sclose(space);
+    H5Dclose(dataset);
+    return values;
+}
+}  // namespace
+
+// The geometry and topology are written once, the properties for each step.
+TEST(MeshLibXdmfHdfWriter, WriteTimeSeries)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 3));
+    auto* const pressure =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "pressure", MeshLib::MeshItemType::Node, 1);
+    pressure->resize(mesh->getNumberOfNodes());
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    material_ids->resize(mesh->getNumberOfElements(), 7);
+    auto* const sigma_ip =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "sigma_ip", MeshLib::MeshItemType::IntegrationPoint, 6);
+    sigma_ip->resize(mesh->getNumberOfElements() * 6 * 8, 2.5);
+
+    std::string const file_name =
+        TestInfoLib::TestInfo::tests_tmp_path + "/XdmfHdfWriter";
+    int const number_of_steps = 3;
+    {
+        MeshLib::IO::XdmfHdfWriter writer(*mesh, file_name);
+        for (int step = 0; step < number_of_steps; ++step)
+        {
+            std::fill(pressure->begin(), pressure->end(), step);
+            writer.writeStep(0.5 * step);
+        }
+    }
+
+    hid_t const file =
+        H5Fopen((file_name + ".h5").c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_LE(0, file);
+
+    std::vector<hsize_t> dims;
+    auto const geometry =
+        readDataset<double>(file, "/geometry", H5T_NATIVE_DOUBLE, dims);
+    ASSERT_EQ((std::vector<hsize_t>{mesh->getNumberOfNodes(), 3}), dims);
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            EXPECT_EQ((*mesh->getNode(i))[c], geometry[3 * i + c]);
+        }
+    }
+
+    // Hexahedra have the same node order in OGS and XDMF.
+    auto const topology =
+        readDataset<std::int64_t>(file, "/topology", H5T_NATIVE_INT64, dims);
+    ASSERT_EQ(9 * mesh->getNumberOfElements(), topology.size());
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        EXPECT_EQ(9, topology[9 * e]);
+        for (unsigned i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(
+                static_cast<std::int64_t>(mesh->getElement(e)->getNodeIndex(i)),
+                topology[9 * e + 1 + i]);
+        }
+    }
+
+    for (int step = 0; step < number_of_steps; ++step)
+    {
+        auto const group = "/t_" + std::to_string(step);
+        auto const p = readDataset<double>(file, group + "/pressure",
+                                           H5T_NATIVE_DOUBLE, dims);
+        ASSERT_EQ(pressure->size(), p.size());
+        for (auto const value : p)
+        {
+            EXPECT_EQ(step, value);
+        }
+        auto const ids = readDataset<int>(file, group + "/MaterialIDs",
+                                          H5T_NATIVE_INT, dims);
+        EXPECT_EQ(material_ids->size(), ids.size());
+        auto const sigma = readDataset<double>(file, group + "/sigma_ip",
+                                               H5T_NATIVE_DOUBLE, dims);
+        ASSERT_EQ((std::vector<hsize_t>{mesh->getNumberOfElements() * 8, 6}),
+                  dims);
+    }
+    H5Fclose(file);
+
+    // The XDMF file references all steps.
+    std::ifstream xdmf_file(file_name + ".xdmf");
+    ASSERT_TRUE(xdmf_file.good());
+    std::stringstream xdmf;
+    xdmf << xdmf_file.rdbuf();
+    for (int step = 0; step < number_of_steps; ++step)
+    {
+        EXPECT_NE(std::string::npos,
+                  xdmf.str().find("XdmfHdfWriter.h5:/t_" +
+                                  std::to_string(step) + "/pressure"));
+    }
+    EXPECT_EQ(std::string::npos, xdmf.str().find("sigma_ip"));
+}
+
+#endif
@@ -223,12 +223,59 @@ TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_MultipleVariablesMultipleCompon
     ASSERT_EQ(20, dof_map->getGlobalIndex(l_node1, 1, 0));
 
     auto ele0_c0_indices = (*dof_map)(0, 0);
-    ASSERT_EQ(2u, ele0_c0_indices.rows.size());
+    ASSERT_EQ(2u, ele0_c0_indices.size());
     auto ele0_c2_indices = (*dof_map)(0, 2);
-    ASSERT_EQ(0u, ele0_c2_indices.rows.size());
+    ASSERT_EQ(0u, ele0_c2_indices.size());
 
     auto ele1_c2_indices = (*dof_map)(1, 2);
-    ASSERT_EQ(2u, ele1_c2_indices.rows.size());
+    ASSERT_EQ(2u, ele1_c2_indices.size());
+}
+
+
+#ifndef USE_PETSC
+TEST_F(NumLibLocalToGlobalIndexMapTest, ElementIndicesConcatenateComponents)
+#else
+TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_ElementIndicesConcatenateComponents)
+#endif
+{
+    // test 2 variables
+    // - 1st variable with 2 components for all nodes, elements
+    // - 2nd variable with 1 component for nodes of element id 1
+    std::vector<MeshLib::Node*> var2_nodes{const_cast<MeshLib::Node*>(mesh->getNode(1)), const_cast<MeshLib::Node*>(mesh->getNode(2))};
+    MeshLib::MeshSubset var2_subset{*mesh, var2_nodes};
+    components.emplace_back(var2_subset);
+
+    std::vector<int> vec_var_n_components{2, 1};
+    std::vector<std::vector<MeshLib::Element*>const*> vec_var_elements;
+    vec_var_elements.push_back(&mesh->getElements());
+    std::vector<MeshLib::Element*> var2_elements{const_cast<MeshLib::Element*>(mesh->getElement(1))};
+    vec_var_elements.push_back(&var2_elements);
+
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components),
+        vec_var_n_components,
+        vec_var_elements,
+        NumLib::ComponentOrder::BY_COMPONENT);
+
+    for (std::size_t e = 0; e < dof_map->size(); ++e)
+    {
+        std::vector<GlobalIndexType> expected;
+        for (int c = 0; c < dof_map->getNumberOfComponents(); ++c)
+        {
+            auto const rows = (*dof_map)(e, c);
+            expected.insert(expected.end(), rows.begin(), rows.end());
+        }
+        ASSERT_EQ(expected, dof_map->getElementIndices(e));
+        ASSERT_EQ(dof_map->getNumberOfElementDOF(e),
+                  dof_map->getElementIndices(e).size());
+    }
+
+    ASSERT_EQ(4u, dof_map->getElementIndices(0).size());
+    auto const& ele1_indices = dof_map->getElementIndices(1);
+    ASSERT_EQ(6u, ele1_indices.size());
+    ASSERT_EQ(1, ele1_indices[0]);
+    ASSERT_EQ(11, ele1_indices[2]);
+    ASSERT_EQ(20, ele1_indices[4]);
 }
 
 
@@ -275,11 +322,11 @@ TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_MultipleVariablesMultipleCompon
     ASSERT_EQ(20, dof_map->getGlobalIndex(l_node1, 1, 0));
 
     auto ele0_c0_indices = (*dof_map)(0, 0);
-    ASSERT_EQ(2u, ele0_c0_indices.rows.size());
+    ASSERT_EQ(2u, ele0_c0_indices.size());
     auto ele0_c2_indices = (*dof_map)(0, 2);
-    ASSERT_EQ(0u, ele0_c2_indices.rows.size());
+    ASSERT_EQ(0u, ele0_c2_indices.size());
 
     auto ele1_c2_indices = (*dof_map)(1, 2);
-    ASSERT_EQ(1u, ele1_c2_indices.rows.size());
-    ASSERT_EQ(20u, ele1_c2_indices.rows[0]);
+    ASSERT_EQ(1u, ele1_c2_indices.size());
+    ASSERT_EQ(20u, ele1_c2_indices[0]);
 }
@@ -191,7 +191,7 @@ void NumLibLocalToGlobalIndexMapMultiDOFTest::test(
 
         for (int c = 0; c < dof_map->getNumberOfComponents(); ++c)
         {
-            auto const& global_idcs = (*dof_map)(e, c).rows;
+            auto const global_idcs = (*dof_map)(e, c);
             ASSERT_EQ(element_nodes_size, global_idcs.size());
 
             for (unsigned n = 0; n < element_nodes_size; ++n)
@@ -210,7 +210,7 @@ void NumLibLocalToGlobalIndexMapMultiDOFTest::test(
 
         for (int c = 0; c < 1; ++c)
         {
-            auto const& global_idcs = (*dof_map_boundary)(e, c).rows;
+            auto const global_idcs = (*dof_map_boundary)(e, c);
 
             ASSERT_EQ(2, global_idcs.size()); // boundary of quad is line with two nodes
 
@@ -253,7 +253,7 @@ void NumLibLocalToGlobalIndexMapMultiDOFTest::test(
 
         for (int c = 0; c < dof_map->getNumberOfComponents(); ++c)
         {
-            auto const& global_idcs = (*dof_map)(e, c).rows;
+            auto const global_idcs = (*dof_map)(e, c);
             ASSERT_EQ(element_nodes_size, global_idcs.size());
 
             for (unsigned n = 0; n < element_nodes_size; ++n)
@@ -273,7 +273,7 @@ void NumLibLocalToGlobalIndexMapMultiDOFTest::test(
 
         for (int c = 0; c < static_cast<int>(selected_components.size()); ++c)
         {
-            auto const& global_idcs = (*dof_map_boundary)(e, c).rows;
+            auto const global_idcs = (*dof_map_boundary)(e, c);
 
             ASSERT_EQ(
                 2,
@@ -302,8 +302,7 @@ void assert_equal(NL::LocalToGlobalIndexMap const& dof1, NL::LocalToGlobalIndexM
     {
         for (int c = 0; c < dof1.getNumberOfComponents(); ++c)
         {
-            EXPECT_EQ(dof1(e, c).rows, dof2(e, c).rows);
-            EXPECT_EQ(dof1(e, c).columns, dof2(e, c).columns);
+            EXPECT_EQ(dof1(e, c), dof2(e, c));
         }
     }
 }
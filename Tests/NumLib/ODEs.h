@@ -12,6 +12,7 @@
 #include <boost/math/constants/constants.hpp>
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "NumLib/ODESolver/ODESystem.h"
 
 // debug
@@ -328,3 +329,88 @@ const double ODETraits<ODE3>::t0 = 0.0;
 const double ODETraits<ODE3>::t_end =
     0.5 * boost::math::constants::pi<double>();
 // ODE 3 end //////////////////////////////////////////////////////
+
+// Residual-only assembly /////////////////////////////////////////
+
+//! Assembles the wrapped ODE by assembleResidualWithJacobian(). The negative
+//! residual is computed from the global M, K, and b of the wrapped ODE.
+template <typename ODE>
+class ResidualOnlyODE final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Newton>
+{
+public:
+    void preAssemble(const double t, double const dt,
+                     GlobalVector const& x) override
+    {
+        _ode.preAssemble(t, dt, x);
+    }
+
+    void assemble(const double t, double const dt, GlobalVector const& x,
+                  GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b) override
+    {
+        _ode.assemble(t, dt, x, M, K, b);
+    }
+
+    void assembleWithJacobian(const double t, double const dt,
+                              GlobalVector const& x, GlobalVector const& xdot,
+                              const double dxdot_dx, const double dx_dx,
+                              GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
+                              GlobalMatrix& Jac) override
+    {
+        _ode.assembleWithJacobian(t, dt, x, xdot, dxdot_dx, dx_dx, M, K, b,
+                                  Jac);
+    }
+
+    bool isResidualOnlyAssembly() const override { return true; }
+
+    void assembleResidualWithJacobian(const double t, double const dt,
+                                      GlobalVector const& x,
+                                      GlobalVector const& xdot,
+                                      const double dxdot_dx, const double dx_dx,
+                                      GlobalVector& b,
+                                      GlobalMatrix& Jac) override
+    {
+        namespace LinAlg = MathLib::LinAlg;
+
+        auto const spec = _ode.getMatrixSpecifications(0);
+        auto& M = NumLib::GlobalMatrixProvider::provider.getMatrix(spec);
+        auto& K = NumLib::GlobalMatrixProvider::provider.getMatrix(spec);
+        auto& tmp = NumLib::GlobalVectorProvider::provider.getVector(spec);
+        M.setZero();
+        K.setZero();
+
+        _ode.assembleWithJacobian(t, dt, x, xdot, dxdot_dx, dx_dx, M, K, b,
+                                  Jac);
+        LinAlg::finalizeAssembly(M);
+        LinAlg::finalizeAssembly(K);
+        LinAlg::finalizeAssembly(b);
+
+        // b -= M * xdot + K * x
+        LinAlg::matMult(M, xdot, tmp);
+        LinAlg::matMultAdd(K, x, tmp, tmp);
+        LinAlg::axpy(b, -1.0, tmp);
+
+        NumLib::GlobalVectorProvider::provider.releaseVector(tmp);
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(K);
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(M);
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int process_id) const override
+    {
+        return _ode.getMatrixSpecifications(process_id);
+    }
+
+    bool isLinear() const override { return _ode.isLinear(); }
+
+private:
+    ODE _ode;
+};
+
+template <typename ODE>
+class ODETraits<ResidualOnlyODE<ODE>> : public ODETraits<ODE>
+{
+};
+// Residual-only assembly end /////////////////////////////////////
@@ -0,0 +1,166 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/CompactLinearSolver.h"
+
+#ifndef USE_PETSC
+namespace
+{
+// A one-dimensional Laplace problem on the nodes [0, n_active), the remaining
+// nodes are decoupled and pinned as after the application of Dirichlet
+// boundary conditions.
+void assemble(GlobalIndexType const n, GlobalIndexType const n_active,
+              GlobalMatrix& A, GlobalVector& b)
+{
+    for (GlobalIndexType i = 0; i < n_active; ++i)
+    {
+        A.add(i, i, 2.0);
+        if (i > 0)
+        {
+            A.add(i, i - 1, -1.0);
+        }
+        if (i < n_active - 1)
+        {
+            A.add(i, i + 1, -1.0);
+        }
+        b.set(i, 1.0);
+    }
+    for (GlobalIndexType i = n_active; i < n; ++i)
+    {
+        A.add(i, i, 4.0);
+        b.set(i, 2.0 * i);
+    }
+}
+
+// Solves the system with the compact solver and compares the solution with
+// the one of the full system with the matrix \c A_full_system.
+void checkCompactSolution(GlobalLinearSolver& linear_solver,
+                          NumLib::CompactLinearSolver& compact_solver,
+                          GlobalMatrix const& A_full_system,
+                          GlobalMatrix const& A, GlobalVector const& b)
+{
+    auto const n = A.getNumberOfRows();
+    GlobalVector x_full(n);
+    x_full.setZero();
+    {
+        GlobalMatrix A_full(A_full_system);
+        GlobalVector b_full(b);
+        ASSERT_TRUE(linear_solver.solve(A_full, b_full, x_full));
+    }
+
+    GlobalMatrix A_compact(A);
+    GlobalVector b_compact(b);
+    GlobalVector x(n);
+    x.setZero();
+    ASSERT_TRUE(compact_solver.solve(A_compact, b_compact, x));
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        EXPECT_NEAR(x_full[i], x[i], 1e-12);
+    }
+}
+}  // namespace
+
+TEST(NumLibCompactLinearSolver, SolveActiveRows)
+{
+    GlobalIndexType const n = 8;
+    GlobalLinearSolver linear_solver("", nullptr);
+    NumLib::CompactLinearSolver compact_solver(linear_solver);
+
+    for (GlobalIndexType const n_active : {5, 3})
+    {
+        GlobalMatrix A(n);
+        GlobalVector b(n);
+        assemble(n, n_active, A, b);
+
+        GlobalVector x_full(n);
+        x_full.setZero();
+        {
+            GlobalMatrix A_full(A);
+            GlobalVector b_full(b);
+            ASSERT_TRUE(linear_solver.solve(A_full, b_full, x_full));
+        }
+
+        std::vector<GlobalIndexType> active_indices;
+        for (GlobalIndexType i = 0; i < n_active; ++i)
+        {
+            active_indices.push_back(i);
+        }
+        compact_solver.setActiveIndices(&active_indices);
+
+        GlobalVector x(n);
+        x.setZero();
+        ASSERT_TRUE(compact_solver.solve(A, b, x));
+        for (GlobalIndexType i = 0; i < n; ++i)
+        {
+            EXPECT_NEAR(x_full[i], x[i], 1e-12);
+        }
+        for (GlobalIndexType i = n_active; i < n; ++i)
+        {
+            EXPECT_DOUBLE_EQ(0.5 * i, x[i]);
+        }
+
+        // The factorization is reused for a scaled right-hand side.
+        MathLib::LinAlg::scale(b, 2.0);
+        ASSERT_TRUE(compact_solver.solveWithPreviousFactorization(b, x));
+        for (GlobalIndexType i = 0; i < n; ++i)
+        {
+            EXPECT_NEAR(2.0 * x_full[i], x[i], 1e-12);
+        }
+    }
+
+    // Without active indices the full system is solved.
+    compact_solver.setActiveIndices(nullptr);
+    GlobalMatrix A(n);
+    GlobalVector b(n);
+    assemble(n, n, A, b);
+    GlobalVector x(n);
+    x.setZero();
+    ASSERT_TRUE(compact_solver.solve(A, b, x));
+    EXPECT_NEAR(10.0, x[3], 1e-12);
+}
+
+TEST(NumLibCompactLinearSolver, ChangedValuesAndSparsityPattern)
+{
+    GlobalIndexType const n = 6;
+    GlobalIndexType const n_active = 4;
+    GlobalLinearSolver linear_solver("", nullptr);
+    NumLib::CompactLinearSolver compact_solver(linear_solver);
+    std::vector<GlobalIndexType> const active_indices = {0, 1, 2, 3};
+    compact_solver.setActiveIndices(&active_indices);
+
+    GlobalMatrix A(n);
+    GlobalVector b(n);
+    assemble(n, n_active, A, b);
+    checkCompactSolution(linear_solver, compact_solver, A, A, b);
+
+    // Same sparsity pattern, other values.
+    A.add(1, 1, 3.0);
+    A.add(2, 1, -0.5);
+    checkCompactSolution(linear_solver, compact_solver, A, A, b);
+
+    // An additional entry within the active rows and columns.
+    A.add(0, 3, -0.5);
+    A.add(3, 0, -0.5);
+    checkCompactSolution(linear_solver, compact_solver, A, A, b);
+
+    // An additional entry coupling an active with an inactive column does not
+    // change the compact system. The full system is solved without it, since
+    // the sparse LU decomposition fails for the stored zero.
+    GlobalMatrix const A_without_coupling(A);
+    A.add(2, 5, 0.0);
+    checkCompactSolution(linear_solver, compact_solver, A_without_coupling, A,
+                         b);
+}
+#endif
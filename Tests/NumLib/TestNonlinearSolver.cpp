@@ -0,0 +1,29 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "NumLib/ODESolver/NonlinearSolver.h"
+
+TEST(NumLibNonlinearSolver, EisenstatWalkerForcingTerm)
+{
+    NumLib::EisenstatWalkerForcingTerm const forcing_term;
+
+    // Fast convergence yields a small forcing term ...
+    EXPECT_DOUBLE_EQ(0.9 * 0.01 * 0.01, forcing_term.compute(0.1, 1e-3, 1e-1));
+
+    // ... unless the previous forcing term was large (safeguard).
+    EXPECT_DOUBLE_EQ(0.9 * 0.5 * 0.5, forcing_term.compute(0.5, 1e-3, 1e-1));
+
+    // Stagnation is bounded by the maximum forcing term.
+    EXPECT_DOUBLE_EQ(forcing_term.max, forcing_term.compute(0.1, 2.0, 1.0));
+
+    // An exactly vanishing previous residual keeps the forcing term.
+    EXPECT_DOUBLE_EQ(0.3, forcing_term.compute(0.3, 0.0, 0.0));
+}
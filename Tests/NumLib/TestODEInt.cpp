@@ -292,6 +292,46 @@ TYPED_TEST(NumLibODEIntTyped, DISABLED_T1)
     TestFixture::test();
 }
 
+// The residual-only assembly has to yield the same Newton iterates as the
+// assembly of the global M and K matrices.
+template <typename ODE, typename TimeDisc>
+void testResidualOnlyAssembly()
+{
+    const unsigned num_timesteps = 100;
+
+    auto const sol_newton =
+        run_test_case<TimeDisc, ODE, NumLib::NonlinearSolverTag::Newton>(
+            num_timesteps);
+    auto const sol_residual_only =
+        run_test_case<TimeDisc, ResidualOnlyODE<ODE>,
+                      NumLib::NonlinearSolverTag::Newton>(num_timesteps);
+
+    ASSERT_EQ(sol_newton.ts.size(), sol_residual_only.ts.size());
+    for (std::size_t i = 0; i < sol_newton.ts.size(); ++i)
+    {
+        ASSERT_EQ(sol_newton.ts[i], sol_residual_only.ts[i]);
+        for (int comp = 0;
+             comp < static_cast<int>(sol_newton.solutions[i].size()); ++comp)
+        {
+            EXPECT_NEAR(sol_newton.solutions[i][comp],
+                        sol_residual_only.solutions[i][comp], 1e-14);
+        }
+    }
+}
+
+#ifndef USE_PETSC
+TEST(NumLibODEInt, ResidualOnlyAssembly)
+#else
+TEST(NumLibODEInt, DISABLED_ResidualOnlyAssembly)
+#endif
+{
+    testResidualOnlyAssembly<ODE2, NumLib::BackwardEuler>();
+    testResidualOnlyAssembly<ODE3, NumLib::BackwardEuler>();
+    testResidualOnlyAssembly<ODE3, NumLib::BackwardDifferentiationFormula>();
+    // Falls back to the assembly of M and K.
+    testResidualOnlyAssembly<ODE3, NumLib::CrankNicolson>();
+}
+
 
 /* TODO Other possible test cases:
  *
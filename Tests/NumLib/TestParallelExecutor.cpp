@@ -0,0 +1,120 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "NumLib/Assembler/ParallelExecutor.h"
+
+namespace
+{
+struct OrderRecorder
+{
+    // Computes a value "locally" and records it in the shared output inside
+    // the scatter section.
+    void record(std::size_t const index, int const value,
+                std::vector<int>& output)
+    {
+        int const local_value = 2 * value;
+        NumLib::ParallelExecutor::scatter(
+            [&]() { output.push_back(local_value + static_cast<int>(index)); });
+    }
+
+    void throwAt(std::size_t const index, int const value,
+                 std::size_t const throwing_index)
+    {
+        (void)value;
+        if (index == throwing_index)
+        {
+            throw std::runtime_error("expected failure");
+        }
+    }
+};
+
+struct NumLibParallelExecutor : public ::testing::Test
+{
+    NumLibParallelExecutor()
+    {
+        values.resize(1000);
+        std::iota(values.begin(), values.end(), 0);
+        for (auto& v : values)
+        {
+            pointers.push_back(&v);
+        }
+    }
+
+    std::vector<int> values;
+    std::vector<int*> pointers;
+    OrderRecorder recorder;
+};
+}  // namespace
+
+TEST_F(NumLibParallelExecutor, DeterministicScatterOrder)
+{
+    NumLib::ParallelExecutor::deterministic = true;
+
+    std::vector<int> output;
+    NumLib::ParallelExecutor::executeMemberDereferenced(
+        recorder, &OrderRecorder::record, pointers, output);
+
+    ASSERT_EQ(values.size(), output.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(3 * values[i], output[i]);
+    }
+}
+
+TEST_F(NumLibParallelExecutor, SelectedElements)
+{
+    NumLib::ParallelExecutor::deterministic = true;
+
+    std::vector<std::size_t> const active_ids = {3, 5, 7, 11, 13, 17};
+
+    std::vector<int> output;
+    NumLib::ParallelExecutor::executeSelectedMemberDereferenced(
+        recorder, &OrderRecorder::record, pointers, active_ids, output);
+
+    // The method is called with the ids of the selected elements.
+    ASSERT_EQ(active_ids.size(), output.size());
+    for (std::size_t i = 0; i < active_ids.size(); ++i)
+    {
+        EXPECT_EQ(3 * values[active_ids[i]], output[i]);
+    }
+}
+
+TEST_F(NumLibParallelExecutor, NondeterministicScatterIsComplete)
+{
+    NumLib::ParallelExecutor::deterministic = false;
+
+    std::vector<int> output;
+    NumLib::ParallelExecutor::executeMemberDereferenced(
+        recorder, &OrderRecorder::record, pointers, output);
+
+    NumLib::ParallelExecutor::deterministic = true;
+
+    std::sort(output.begin(), output.end());
+    ASSERT_EQ(values.size(), output.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(3 * values[i], output[i]);
+    }
+}
+
+TEST_F(NumLibParallelExecutor, ExceptionIsRethrown)
+{
+    std::size_t const throwing_index = 42;
+    EXPECT_THROW(NumLib::ParallelExecutor::executeMemberDereferenced(
+                     recorder, &OrderRecorder::throwAt, pointers,
+                     throwing_index),
+                 std::runtime_error);
+}
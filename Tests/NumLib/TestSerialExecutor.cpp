@@ -13,6 +13,7 @@
 #include <vector>
 #include <functional>
 #include <numeric>
+#include <utility>
 #include "NumLib/Assembler/SerialExecutor.h"
 
 template <typename ContainerElement_>
@@ -101,3 +102,39 @@ TYPED_TEST(NumLibSerialExecutor, ContainerArgument)
         }
     );
 }
+
+TYPED_TEST(NumLibSerialExecutor, SelectedElementsGetTheirIds)
+{
+    using Elem = typename TestFixture::ContainerElement;
+    using Container = typename TestFixture::Container;
+
+    Container values(TestFixture::size);
+    std::iota(values.begin(), values.end(), 0);
+    std::vector<Elem*> container;
+    for (auto& v : values)
+    {
+        container.push_back(&v);
+    }
+
+    struct IdRecorder
+    {
+        void record(std::size_t const id, Elem const value,
+                    std::vector<std::pair<std::size_t, Elem>>& ids)
+        {
+            ids.emplace_back(id, value);
+        }
+    } recorder;
+
+    std::vector<std::size_t> const active_ids = {3, 5, 7, 11, 13, 17};
+    std::vector<std::pair<std::size_t, Elem>> ids;
+    NumLib::SerialExecutor::executeSelectedMemberDereferenced(
+        recorder, &IdRecorder::record, container, active_ids, ids);
+
+    // The method is called with the id of each selected element.
+    ASSERT_EQ(active_ids.size(), ids.size());
+    for (std::size_t i = 0; i < active_ids.size(); ++i)
+    {
+        EXPECT_EQ(active_ids[i], ids[i].first);
+        EXPECT_EQ(values[active_ids[i]], ids[i].second);
+    }
+}
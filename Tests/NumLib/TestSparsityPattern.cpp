@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "MeshLib/Elements/Utils.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
@@ -141,3 +143,53 @@ TEST(NumLib_SparsityPattern, DISABLED_MultipleComponentsLinearQuadraticMesh)
     EXPECT_EQ(5u, sp[10]);
 }
 
+
+
+#ifndef USE_PETSC
+TEST(NumLib_SparsityPattern, CompressedMultipleComponentsLinearQuadraticMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> linear_mesh(
+        MeshLib::MeshGenerator::generateLineMesh(3u, 1.));
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::createQuadraticOrderMesh(*linear_mesh));
+    auto base_nodes = MeshLib::getBaseNodes(mesh->getElements());
+    auto baseNodesSubset =
+        std::make_unique<MeshLib::MeshSubset const>(*mesh, base_nodes);
+    auto allNodesSubset =
+        std::make_unique<MeshLib::MeshSubset const>(*mesh, mesh->getNodes());
+
+    std::vector<MeshLib::MeshSubset> components{*baseNodesSubset,
+                                                *allNodesSubset};
+    NumLib::LocalToGlobalIndexMap dof_map(
+                      std::move(components),
+                      NumLib::ComponentOrder::BY_COMPONENT);
+
+    GlobalSparsityPattern const sp =
+        NumLib::computeSparsityPattern(dof_map, *mesh);
+    GlobalCompressedSparsityPattern const csp =
+        NumLib::computeCompressedSparsityPattern(dof_map, *mesh);
+
+    ASSERT_EQ(11u, csp.getNumberOfRows());
+    ASSERT_EQ(sp, MathLib::getRowSizes(csp));
+    ASSERT_EQ(csp.row_offsets.back(),
+              static_cast<GlobalIndexType>(csp.column_indices.size()));
+
+    for (std::size_t r = 0; r < csp.getNumberOfRows(); ++r)
+    {
+        auto const begin = csp.column_indices.begin() + csp.row_offsets[r];
+        auto const end = csp.column_indices.begin() + csp.row_offsets[r + 1];
+        EXPECT_TRUE(std::is_sorted(begin, end));
+        // The diagonal entry is always part of the pattern.
+        EXPECT_TRUE(std::binary_search(begin, end,
+                                       static_cast<GlobalIndexType>(r)));
+    }
+
+    // The first node of the 1st component is coupled with both components of
+    // the first two base nodes and with the middle node of the first element.
+    std::vector<GlobalIndexType> const expected_row_0 = {0, 1, 4, 5, 8};
+    EXPECT_EQ(expected_row_0,
+              std::vector<GlobalIndexType>(
+                  csp.column_indices.begin(),
+                  csp.column_indices.begin() + csp.row_offsets[1]));
+}
+#endif
@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include <logog/include/logog.hpp>
@@ -109,3 +110,45 @@ TEST(NumLibTimeStepping, testEvolutionaryPIDcontroller)
     ASSERT_NEAR(t_previous + h_new, ts.current(), tol);
     ASSERT_TRUE(PIDStepper->accepted());
 }
+
+TEST(NumLibTimeStepping, testEvolutionaryPIDcontrollerCheckpoint)
+{
+    const char xml[] =
+        "<time_stepping>"
+        "   <type>EvolutionaryPIDcontroller</type>"
+        "   <t_initial> 0.0 </t_initial>"
+        "   <t_end> 10 </t_end>"
+        "   <dt_guess> 0.01 </dt_guess>"
+        "   <dt_min> 0.001 </dt_min>"
+        "   <dt_max> 1 </dt_max>"
+        "   <rel_dt_min> 0.01 </rel_dt_min>"
+        "   <rel_dt_max> 5 </rel_dt_max>"
+        "   <tol> 1.e-3 </tol>"
+        "</time_stepping>";
+    auto const PIDStepper = createTestTimeStepper(xml);
+    auto const restarted_PIDStepper = createTestTimeStepper(xml);
+
+    int const number_iterations = 0;
+    PIDStepper->next(0., number_iterations);
+    PIDStepper->next(1.0e-4, number_iterations);
+    PIDStepper->next(0.5e-3, number_iterations);
+
+    std::stringstream checkpoint;
+    PIDStepper->writeCheckpoint(checkpoint);
+    restarted_PIDStepper->readCheckpoint(checkpoint);
+
+    // Both steppers continue with identical time steps.
+    for (double const solution_error : {0.01, 0.4e-3, 0.2e-3})
+    {
+        PIDStepper->next(solution_error, number_iterations);
+        restarted_PIDStepper->next(solution_error, number_iterations);
+
+        auto const ts = PIDStepper->getTimeStep();
+        auto const restarted_ts = restarted_PIDStepper->getTimeStep();
+        ASSERT_EQ(ts.steps(), restarted_ts.steps());
+        ASSERT_EQ(ts.previous(), restarted_ts.previous());
+        ASSERT_EQ(ts.current(), restarted_ts.current());
+        ASSERT_EQ(ts.dt(), restarted_ts.dt());
+        ASSERT_EQ(PIDStepper->accepted(), restarted_PIDStepper->accepted());
+    }
+}
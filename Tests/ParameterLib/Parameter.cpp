@@ -255,3 +255,137 @@ TEST_F(ParameterLibParameter, GetNodalValuesOnElement_curveScaledNode)
     ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
                                          expected_value, *parameter, t));
 }
+
+// The allocation-free evaluation yields the same values as operator() and
+// getNodalValuesOnElement().
+TEST_F(ParameterLibParameter, EvaluateIntoBuffer)
+{
+    std::vector<double> node_values({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    MeshLib::addPropertyToMesh(*meshes[0], "NodeValues",
+                               MeshLib::MeshItemType::Node, 2, node_values);
+    std::vector<double> element_values({0, 1, 2, 3, 4, 5, 6, 7});
+    MeshLib::addPropertyToMesh(*meshes[0], "ElementValues",
+                               MeshLib::MeshItemType::Cell, 2, element_values);
+    std::vector<int> mat_ids({0, 1, 1, 0});
+    MeshLib::addPropertyToMesh(*meshes[0], "MaterialIDs",
+                               MeshLib::MeshItemType::Cell, 1, mat_ids);
+
+    std::vector<std::unique_ptr<Parameter<double>>> parameters;
+    parameters.push_back(
+        constructParameterFromString("<name>constant</name>"
+                                     "<type>Constant</type>"
+                                     "<values>1.5 2.5</values>",
+                                     meshes));
+    parameters.push_back(
+        constructParameterFromString("<name>node</name>"
+                                     "<type>MeshNode</type>"
+                                     "<field_name>NodeValues</field_name>",
+                                     meshes));
+    parameters.push_back(
+        constructParameterFromString("<name>element</name>"
+                                     "<type>MeshElement</type>"
+                                     "<field_name>ElementValues</field_name>",
+                                     meshes));
+    parameters.push_back(constructParameterFromString(
+        "<name>function</name>"
+        "<type>Function</type>"
+        "<expression>x</expression>"
+        "<expression>2*x+1</expression>",
+        meshes));
+    parameters.push_back(constructParameterFromString(
+        "<name>group</name>"
+        "<type>Group</type>"
+        "<group_id_property>MaterialIDs</group_id_property>"
+        "<index_values><index>0</index><values>3 4</values></index_values>"
+        "<index_values><index>1</index><values>5 6</values></index_values>",
+        meshes));
+
+    double const t = 0;
+    for (auto const& parameter : parameters)
+    {
+        for (auto const* const e : meshes[0]->getElements())
+        {
+            for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+            {
+                SpatialPosition x;
+                x.setAll(e->getNodeIndex(i), e->getID(), boost::none,
+                         boost::none);
+                auto const expected = (*parameter)(t, x);
+
+                Eigen::Vector2d values;
+                parameter->evaluate(t, x, values);
+                EXPECT_EQ(expected[0], values[0]) << parameter->name;
+                EXPECT_EQ(expected[1], values[1]) << parameter->name;
+                EXPECT_EQ(expected[0], parameter->scalarValue(t, x))
+                    << parameter->name;
+            }
+
+            // Only the first node is requested.
+            Eigen::Matrix<double, 1, 2> first_node_values;
+            parameter->evaluateNodalValuesOnElement(*e, t, first_node_values);
+            Eigen::Matrix2d const nodal_values =
+                parameter->getNodalValuesOnElement(*e, t);
+            EXPECT_EQ(nodal_values.row(0), first_node_values)
+                << parameter->name;
+        }
+    }
+}
+
+// The nodes are evaluated at once, possibly by several threads, with the same
+// result as the evaluation one by one.
+TEST_F(ParameterLibParameter, FunctionParameterEvaluateAtNodes)
+{
+    meshes[0].reset(MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 50));
+    auto const parameter = constructParameterFromString(
+        "<name>function</name>"
+        "<type>Function</type>"
+        "<expression>x</expression>"
+        "<expression>2*x+1</expression>",
+        meshes);
+
+    double const t = 0;
+    auto const& nodes = meshes[0]->getNodes();
+    Eigen::MatrixXd values(nodes.size(), 2);
+    parameter->evaluateAtNodes(t, nodes, values);
+
+    SpatialPosition x;
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        x.setNodeID(nodes[i]->getID());
+        auto const expected = (*parameter)(t, x);
+        ASSERT_EQ(expected[0], values(i, 0));
+        ASSERT_EQ(expected[1], values(i, 1));
+    }
+}
+
+// Single points are evaluated concurrently, as done by the parallel global
+// assembly, with the same result as the sequential evaluation.
+TEST_F(ParameterLibParameter, FunctionParameterConcurrentEvaluation)
+{
+    meshes[0].reset(MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 50));
+    auto const parameter = constructParameterFromString(
+        "<name>function</name>"
+        "<type>Function</type>"
+        "<expression>x*y</expression>"
+        "<expression>2*x+1</expression>",
+        meshes);
+
+    double const t = 0;
+    auto const& nodes = meshes[0]->getNodes();
+    auto const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+    Eigen::MatrixXd values(nodes.size(), 2);
+#pragma omp parallel for
+    for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+    {
+        SpatialPosition x;
+        x.setNodeID(nodes[i]->getID());
+        parameter->evaluate(t, x, values.row(i).transpose());
+    }
+
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        auto const& node = *nodes[i];
+        ASSERT_EQ(node[0] * node[1], values(i, 0));
+        ASSERT_EQ(2 * node[0] + 1, values(i, 1));
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "InfoLib/TestInfo.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "ProcessLib/Output/AsynchronousOutputWriter.h"
+
+#ifndef USE_PETSC
+// The written files contain the property values at the time of the write()
+// call, even if they are modified before the background thread writes them.
+TEST(ProcessLibAsynchronousOutputWriter, WritesSnapshots)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 10));
+    auto* const pressure =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "pressure", MeshLib::MeshItemType::Node);
+    pressure->resize(mesh->getNumberOfNodes());
+
+    int const number_of_files = 4;
+    auto file_name = [](int const i) {
+        return TestInfoLib::TestInfo::tests_tmp_path +
+               "/AsynchronousOutputWriter_" + std::to_string(i) + ".vtu";
+    };
+
+    {
+        ProcessLib::AsynchronousOutputWriter writer(1);
+        for (int i = 0; i < number_of_files; ++i)
+        {
+            std::fill(pressure->begin(), pressure->end(), i);
+            bool const compress_output = true;
+            // Both encodings of the appended data are read back below.
+            bool const raw_appended_data = i % 2 == 1;
+            writer.write(file_name(i), *mesh, compress_output,
+                         vtkXMLWriter::Appended, raw_appended_data);
+        }
+        std::fill(pressure->begin(), pressure->end(), -1);
+        writer.flush();
+    }
+
+    for (int i = 0; i < number_of_files; ++i)
+    {
+        std::unique_ptr<MeshLib::Mesh> written_mesh(
+            MeshLib::IO::VtuInterface::readVTUFile(file_name(i)));
+        ASSERT_TRUE(written_mesh != nullptr);
+        ASSERT_EQ(mesh->getNumberOfNodes(), written_mesh->getNumberOfNodes());
+
+        auto const& written_pressure =
+            *written_mesh->getProperties().getPropertyVector<double>(
+                "pressure");
+        ASSERT_EQ(pressure->size(), written_pressure.size());
+        for (auto const p : written_pressure)
+        {
+            ASSERT_EQ(i, p);
+        }
+    }
+}
+#endif
@@ -0,0 +1,240 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Fem/Integration/IntegrationGaussLegendreRegular.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine2.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/NumericsConfig.h"
+#include "ParameterLib/ConstantParameter.h"
+#include "ProcessLib/BoundaryCondition/RobinBoundaryConditionLocalAssembler.h"
+#include "ProcessLib/CentralDifferencesJacobianAssembler.h"
+#include "ProcessLib/HeatConduction/HeatConductionFEM.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+#include "Tests/VectorUtils.h"
+
+#ifndef USE_PETSC
+namespace
+{
+// The global vectors and matrices of a scalar variable on all nodes of a
+// mesh.
+struct GlobalSystem
+{
+    explicit GlobalSystem(MeshLib::Mesh const& mesh)
+        : mesh_subset(mesh, mesh.getNodes()),
+          dof_table(std::vector<MeshLib::MeshSubset>{mesh_subset},
+                    NumLib::ComponentOrder::BY_LOCATION),
+          specs(dof_table.dofSizeWithoutGhosts(),
+                dof_table.dofSizeWithoutGhosts(), &dof_table.getGhostIndices(),
+                nullptr)
+    {
+    }
+
+    std::unique_ptr<GlobalVector> newVector() const
+    {
+        return MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    }
+
+    std::unique_ptr<GlobalMatrix> newMatrix() const
+    {
+        return MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    }
+
+    MeshLib::MeshSubset const mesh_subset;
+    NumLib::LocalToGlobalIndexMap dof_table;
+    MathLib::MatrixSpecifications const specs;
+};
+
+void expectEqualVectors(GlobalVector const& expected,
+                        GlobalVector const& actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (GlobalIndexType i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(expected[i], actual[i], 1e-12) << "at index " << i;
+    }
+}
+
+// Compares the products with a random vector, which works for all matrix
+// types.
+void expectEqualMatrices(GlobalMatrix const& expected,
+                         GlobalMatrix const& actual, GlobalSystem const& sys)
+{
+    auto const v = sys.newVector();
+    fillVectorRandomly(*v);
+    auto const expected_v = sys.newVector();
+    auto const actual_v = sys.newVector();
+    MathLib::LinAlg::matMult(expected, *v, *expected_v);
+    MathLib::LinAlg::matMult(actual, *v, *actual_v);
+    expectEqualVectors(*expected_v, *actual_v);
+}
+}  // namespace
+
+// The residual-only mode of the VectorMatrixAssembler folds the local M and K
+// into the local b. The result must equal b - M xdot - K x of the global
+// matrices, and the Jacobian must not change.
+TEST(ProcessLibResidualOnlyAssembly, VectorMatrixAssembler)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    GlobalSystem sys(*mesh);
+
+    ParameterLib::ConstantParameter<double> const thermal_conductivity(
+        "k", 2.0);
+    ParameterLib::ConstantParameter<double> const heat_capacity("c", 3.0);
+    ParameterLib::ConstantParameter<double> const density("rho", 0.5);
+    ProcessLib::HeatConduction::HeatConductionProcessData const process_data{
+        thermal_conductivity, heat_capacity, density};
+
+    using LocalAssembler = ProcessLib::HeatConduction::LocalAssemblerData<
+        NumLib::ShapeQuad4, NumLib::IntegrationGaussLegendreRegular<2>, 2>;
+    std::vector<std::unique_ptr<LocalAssembler>> local_assemblers;
+    for (auto const* e : mesh->getElements())
+    {
+        local_assemblers.push_back(std::make_unique<LocalAssembler>(
+            *e, e->getNumberOfNodes(), false, 2, process_data));
+    }
+
+    // HeatConduction has no analytical Jacobian.
+    ProcessLib::VectorMatrixAssembler assembler(
+        std::make_unique<ProcessLib::CentralDifferencesJacobianAssembler>(
+            std::vector<double>{1e-6}));
+    std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>> const
+        dof_tables{sys.dof_table};
+
+    auto const x = sys.newVector();
+    auto const xdot = sys.newVector();
+    fillVectorRandomly(*x);
+    fillVectorRandomly(*xdot);
+    double const t = 0;
+    double const dt = 0.1;
+    double const dxdot_dx = 1 / dt;
+    double const dx_dx = 1;
+
+    auto assemble = [&](GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
+                        GlobalMatrix& Jac) {
+        for (std::size_t id = 0; id < local_assemblers.size(); ++id)
+        {
+            assembler.assembleWithJacobian(id, *local_assemblers[id],
+                                           dof_tables, t, dt, *x, *xdot,
+                                           dxdot_dx, dx_dx, M, K, b, Jac,
+                                           nullptr);
+        }
+        MathLib::LinAlg::finalizeAssembly(b);
+        MathLib::LinAlg::finalizeAssembly(Jac);
+    };
+
+    auto const M = sys.newMatrix();
+    auto const K = sys.newMatrix();
+    auto const b = sys.newVector();
+    auto const Jac = sys.newMatrix();
+    assemble(*M, *K, *b, *Jac);
+    MathLib::LinAlg::finalizeAssembly(*M);
+    MathLib::LinAlg::finalizeAssembly(*K);
+
+    // b - M xdot - K x
+    auto const expected_b = sys.newVector();
+    auto const product = sys.newVector();
+    MathLib::LinAlg::copy(*b, *expected_b);
+    MathLib::LinAlg::matMult(*M, *xdot, *product);
+    MathLib::LinAlg::axpy(*expected_b, -1.0, *product);
+    MathLib::LinAlg::matMult(*K, *x, *product);
+    MathLib::LinAlg::axpy(*expected_b, -1.0, *product);
+
+    // As in Process::assembleResidualWithJacobian() the Jacobian stands in for
+    // the unused M and K.
+    auto const residual_b = sys.newVector();
+    auto const residual_Jac = sys.newMatrix();
+    assembler.setResidualOnlyAssembly(true);
+    assemble(*residual_Jac, *residual_Jac, *residual_b, *residual_Jac);
+    assembler.setResidualOnlyAssembly(false);
+
+    expectEqualVectors(*expected_b, *residual_b);
+    expectEqualMatrices(*Jac, *residual_Jac, sys);
+
+    // Without the Jacobian assembly only the residual is added.
+    auto const residual_only_b = sys.newVector();
+    auto const unused_Jac = sys.newMatrix();
+    assembler.setResidualOnlyAssembly(true);
+    assembler.setJacobianAssembly(false);
+    assemble(*unused_Jac, *unused_Jac, *residual_only_b, *unused_Jac);
+    assembler.setJacobianAssembly(true);
+    assembler.setResidualOnlyAssembly(false);
+
+    expectEqualVectors(*expected_b, *residual_only_b);
+    auto const zero_Jac = sys.newMatrix();
+    expectEqualMatrices(*zero_Jac, *unused_Jac, sys);
+}
+
+// With a Jacobian the Robin boundary condition adds -K x to b instead of
+// adding K to the global K.
+TEST(ProcessLibResidualOnlyAssembly, RobinBoundaryCondition)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 4));
+    GlobalSystem sys(*mesh);
+
+    ParameterLib::ConstantParameter<double> const alpha("alpha", 2.0);
+    ParameterLib::ConstantParameter<double> const u_0("u_0", 3.0);
+    ProcessLib::RobinBoundaryConditionData const data{alpha, u_0};
+
+    using LocalAssembler = ProcessLib::RobinBoundaryConditionLocalAssembler<
+        NumLib::ShapeLine2, NumLib::IntegrationGaussLegendreRegular<1>, 1>;
+    std::vector<std::unique_ptr<LocalAssembler>> local_assemblers;
+    for (auto const* e : mesh->getElements())
+    {
+        local_assemblers.push_back(std::make_unique<LocalAssembler>(
+            *e, e->getNumberOfNodes(), false, 2, data));
+    }
+
+    auto const x = sys.newVector();
+    fillVectorRandomly(*x);
+    double const t = 0;
+
+    auto const K = sys.newMatrix();
+    auto const b = sys.newVector();
+    for (std::size_t id = 0; id < local_assemblers.size(); ++id)
+    {
+        local_assemblers[id]->assemble(id, sys.dof_table, t, *x, *K, *b,
+                                       nullptr);
+    }
+    MathLib::LinAlg::finalizeAssembly(*K);
+    MathLib::LinAlg::finalizeAssembly(*b);
+
+    // b - K x
+    auto const expected_b = sys.newVector();
+    auto const product = sys.newVector();
+    MathLib::LinAlg::copy(*b, *expected_b);
+    MathLib::LinAlg::matMult(*K, *x, *product);
+    MathLib::LinAlg::axpy(*expected_b, -1.0, *product);
+
+    auto const residual_b = sys.newVector();
+    auto const Jac = sys.newMatrix();
+    for (std::size_t id = 0; id < local_assemblers.size(); ++id)
+    {
+        local_assemblers[id]->assemble(id, sys.dof_table, t, *x, *Jac,
+                                       *residual_b, Jac.get());
+    }
+    MathLib::LinAlg::finalizeAssembly(*residual_b);
+
+    expectEqualVectors(*expected_b, *residual_b);
+}
+#endif
@@ -160,6 +160,11 @@ elseif(OGS_BUILD_GUI)
     message(FATAL_ERROR "Shapelib not found but it is required for OGS_BUILD_GUI!")
 endif()
 
+## HDF5 for the XDMF output
+if(OGS_USE_XDMF)
+    find_package(HDF5 REQUIRED COMPONENTS C)
+endif()
+
 ## Sundials cvode ode-solver library
 if(OGS_USE_CVODE)
     find_package(CVODE REQUIRED)
@@ -0,0 +1,77 @@
+#
+# RestartTest
+# -----------
+#
+# Runs a simulation, which writes a checkpoint, and continues it from the
+# checkpoint in a second run. The given data arrays of the output files of both
+# runs are compared with zero tolerance.
+#
+# RestartTest(
+#   NAME <name of the test>
+#   PATH <working directory> # relative to SourceDir/Tests/Data
+#   PROJECTFILE <project file in PATH>
+#   CHECKPOINT <checkpoint file written by the first run>
+#   WRAPPER <wrapper command and its arguments> # optional, e.g. mpirun -np 1
+#   REQUIREMENTS # optional simple boolean expression which has to be true to
+#                  enable the test, e.g. OGS_USE_MPI
+#   RUNTIME <in seconds> # optional for optimizing ctest duration
+#   DIFF_DATA <output file> <data array name> # can be given multiple times
+# )
+
+function (RestartTest)
+    if(NOT BUILD_TESTING OR NOT OGS_BUILD_CLI OR NOT TARGET vtkdiff)
+        return()
+    endif()
+    set(options NONE)
+    set(oneValueArgs NAME PATH PROJECTFILE CHECKPOINT RUNTIME)
+    set(multiValueArgs WRAPPER REQUIREMENTS DIFF_DATA)
+    cmake_parse_arguments(RestartTest "${options}" "${oneValueArgs}"
+        "${multiValueArgs}" ${ARGN})
+
+    if (RestartTest_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "Unparsed argument(s) '${RestartTest_UNPARSED_ARGUMENTS}' to RestartTest call.")
+    endif()
+
+    if (NOT DEFINED RestartTest_REQUIREMENTS)
+        set(RestartTest_REQUIREMENTS TRUE)
+    endif()
+    if (NOT DEFINED RestartTest_RUNTIME)
+        set(RestartTest_RUNTIME 1)
+    endif()
+
+    if(${RestartTest_REQUIREMENTS})
+        # message(STATUS "Enabling test ${RestartTest_NAME}.")
+    else()
+        set(DISABLED_TESTS_LOG "${DISABLED_TESTS_LOG}\nRequirement ${RestartTest_REQUIREMENTS} not met! Disabling test ${RestartTest_NAME}." CACHE INTERNAL "")
+        return()
+    endif()
+
+    list(LENGTH RestartTest_DIFF_DATA DiffDataLength)
+    math(EXPR DiffDataLengthMod2 "${DiffDataLength} % 2")
+    if (${DiffDataLength} EQUAL 0 OR NOT ${DiffDataLengthMod2} EQUAL 0)
+        message(FATAL_ERROR "RestartTest(): ${RestartTest_NAME} - DIFF_DATA must be pairs of an output file and a data array name!")
+    endif()
+
+    set(RestartTest_SOURCE_PATH "${Data_SOURCE_DIR}/${RestartTest_PATH}")
+    set(RestartTest_BINARY_PATH "${Data_BINARY_DIR}/${RestartTest_PATH}/${RestartTest_NAME}")
+    file(MAKE_DIRECTORY ${RestartTest_BINARY_PATH})
+
+    set(TEST_NAME "ogs-${RestartTest_NAME}")
+    add_test(
+        NAME ${TEST_NAME}
+        COMMAND ${CMAKE_COMMAND}
+        -DEXECUTABLE=$<TARGET_FILE:ogs>
+        -DVTKDIFF=$<TARGET_FILE:vtkdiff>
+        "-DWRAPPER=${RestartTest_WRAPPER}" # Quoted because passed as list
+        -DPROJECTFILE=${RestartTest_SOURCE_PATH}/${RestartTest_PROJECTFILE}
+        -DCHECKPOINT=${RestartTest_CHECKPOINT}
+        -DBINARY_PATH=${RestartTest_BINARY_PATH}
+        "-DDIFF_DATA=${RestartTest_DIFF_DATA}"
+        -P ${PROJECT_SOURCE_DIR}/scripts/cmake/test/RestartTestWrapper.cmake
+        WORKING_DIRECTORY ${RestartTest_SOURCE_PATH}
+    )
+    set_tests_properties(${TEST_NAME} PROPERTIES COST ${RestartTest_RUNTIME})
+
+    add_dependencies(ctest ogs vtkdiff)
+    add_dependencies(ctest-large ogs vtkdiff)
+endfunction()
@@ -0,0 +1,46 @@
+# Runs the simulation of a RestartTest, continues it from the checkpoint of the
+# first run in a second run, and compares the outputs of both runs.
+# IMPORTANT: multiple arguments in one variables have to be in list notation (;)
+# and have to be quoted when passed "-DDIFF_DATA=${RestartTest_DIFF_DATA}"
+set(FULL_RUN_PATH ${BINARY_PATH}/full)
+set(RESTART_RUN_PATH ${BINARY_PATH}/restart)
+file(REMOVE_RECURSE ${FULL_RUN_PATH} ${RESTART_RUN_PATH})
+file(MAKE_DIRECTORY ${FULL_RUN_PATH} ${RESTART_RUN_PATH})
+
+function(run_ogs OUTPUT_PATH)
+    string(REPLACE ";" " " CMD
+        "${WRAPPER};${EXECUTABLE};-o;${OUTPUT_PATH};${ARGN};${PROJECTFILE}")
+    string(STRIP "${CMD}" CMD)
+    message(STATUS "running command generating test results: ${CMD}")
+    execute_process(
+        COMMAND ${WRAPPER} ${EXECUTABLE} -o ${OUTPUT_PATH} ${ARGN} ${PROJECTFILE}
+        RESULT_VARIABLE EXIT_CODE
+        OUTPUT_VARIABLE OUTPUT
+        ERROR_VARIABLE OUTPUT
+    )
+    if(NOT EXIT_CODE STREQUAL "0")
+        message(FATAL_ERROR "Test wrapper exited with code: ${EXIT_CODE}\n${OUTPUT}")
+    endif()
+endfunction()
+
+run_ogs(${FULL_RUN_PATH})
+# With MPI each rank reads the checkpoint file with its rank appended.
+run_ogs(${RESTART_RUN_PATH} --restart ${FULL_RUN_PATH}/${CHECKPOINT})
+
+list(LENGTH DIFF_DATA DiffDataLength)
+math(EXPR DiffDataLastIndex "${DiffDataLength}-1")
+foreach(DiffDataIndex RANGE 0 ${DiffDataLastIndex} 2)
+    list(GET DIFF_DATA ${DiffDataIndex} FILE)
+    math(EXPR DiffDataAuxIndex "${DiffDataIndex}+1")
+    list(GET DIFF_DATA ${DiffDataAuxIndex} NAME)
+    execute_process(
+        COMMAND ${VTKDIFF} ${FULL_RUN_PATH}/${FILE} ${RESTART_RUN_PATH}/${FILE}
+            -a ${NAME} -b ${NAME} --abs 0 --rel 0
+        RESULT_VARIABLE EXIT_CODE
+        OUTPUT_VARIABLE OUTPUT
+        ERROR_VARIABLE OUTPUT
+    )
+    if(NOT EXIT_CODE STREQUAL "0")
+        message(FATAL_ERROR "The restarted run differs in '${NAME}' of '${FILE}': ${EXIT_CODE}\n${OUTPUT}")
+    endif()
+endforeach()
@@ -37,6 +37,7 @@ configure_file(
 include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/AddTest.cmake)
 include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/MeshTest.cmake)
 include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/OgsTest.cmake)
+include(${CMAKE_CURRENT_SOURCE_DIR}/scripts/cmake/test/RestartTest.cmake)
 
 set(NUM_CTEST_PROCESSORS 3)
 if(DEFINED ENV{CTEST_NUM_THREADS})